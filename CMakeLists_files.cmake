@@ -55,6 +55,7 @@ list (APPEND MAIN_SOURCE_FILES
       src/opm/material/densead/Evaluation.cpp
       src/opm/material/fluidmatrixinteractions/EclEpsScalingPoints.cpp
       src/opm/material/fluidsystems/BlackOilFluidSystem.cpp
+      src/opm/material/fluidsystems/BlackOilFluidSystemNonStatic.cpp
       src/opm/material/fluidsystems/blackoilpvt/DeadOilPvt.cpp
       src/opm/material/fluidsystems/blackoilpvt/DryGasPvt.cpp
       src/opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.cpp
@@ -89,6 +90,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/json/JsonObject.cpp
     src/opm/input/eclipse/Deck/Deck.cpp
     src/opm/input/eclipse/Deck/DeckView.cpp
+    src/opm/input/eclipse/Deck/DeckCache.cpp
     src/opm/input/eclipse/Deck/DeckTree.cpp
     src/opm/input/eclipse/Deck/FileDeck.cpp
     src/opm/input/eclipse/Deck/DeckItem.cpp
@@ -284,6 +286,7 @@ if(ENABLE_ECL_INPUT)
     src/opm/input/eclipse/Schedule/UDQ/UDQContext.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQDefine.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQEnums.cpp
+    src/opm/input/eclipse/Schedule/UDQ/UDQEvalPlan.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQFunction.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.cpp
     src/opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
@@ -371,6 +374,9 @@ if(ENABLE_ECL_INPUT)
 endif()
 if(ENABLE_ECL_OUTPUT)
   list( APPEND MAIN_SOURCE_FILES
+          src/opm/io/eclipse/ColumnESmry.cpp
+          src/opm/io/eclipse/ColumnSmryFormat.cpp
+          src/opm/io/eclipse/ColumnSmryOutput.cpp
           src/opm/io/eclipse/EclFile.cpp
           src/opm/io/eclipse/EclOutput.cpp
           src/opm/io/eclipse/EclUtil.cpp
@@ -385,6 +391,7 @@ if(ENABLE_ECL_OUTPUT)
           src/opm/io/eclipse/OutputStream.cpp
           src/opm/io/eclipse/ExtSmryOutput.cpp
           src/opm/io/eclipse/RestartFileView.cpp
+          src/opm/io/eclipse/RestartIndex.cpp
           src/opm/io/eclipse/SummaryNode.cpp
           src/opm/io/eclipse/rst/action.cpp
           src/opm/io/eclipse/rst/aquifer.cpp
@@ -444,6 +451,8 @@ list (APPEND TEST_SOURCE_FILES
       tests/test_cubic.cpp
       tests/test_EvaluationFormat.cpp
       tests/test_densead.cpp
+      tests/test_Fnv1aHash.cpp
+      tests/test_densead_simd.cpp
       tests/test_messagelimiter.cpp
       tests/test_nonuniformtablelinear.cpp
       tests/test_OpmInputError_format.cpp
@@ -480,6 +489,7 @@ if(ENABLE_ECL_INPUT)
     tests/test_ERsm.cpp
     tests/test_GuideRate.cpp
     tests/test_RestartFileView.cpp
+    tests/test_ColumnESmry.cpp
     tests/test_EclIO.cpp
     tests/test_EGrid.cpp
     tests/test_EInit.cpp
@@ -776,6 +786,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/common/utility/CSRGraphFromCoordinates_impl.hpp
       opm/common/utility/Demangle.hpp
       opm/common/utility/FileSystem.hpp
+      opm/common/utility/Fnv1aHash.hpp
       opm/common/utility/OpmInputError.hpp
       opm/common/utility/Serializer.hpp
       opm/common/utility/MemPacker.hpp
@@ -870,6 +881,8 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/GasPhase.hpp
       opm/material/fluidsystems/TwoPhaseImmiscibleFluidSystem.hpp
       opm/material/fluidsystems/BlackOilFluidSystem.hpp
+      opm/material/fluidsystems/BlackOilFluidSystem_macrotemplate.hpp
+      opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp
       opm/material/fluidsystems/LiquidPhase.hpp
       opm/material/fluidsystems/PTFlashParameterCache.hpp
       opm/material/fluidsystems/Spe5ParameterCache.hpp
@@ -883,6 +896,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp
       opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp
       opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp
+      opm/material/fluidsystems/blackoilpvt/SolubilityTable.hpp
       opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp
       opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp
       opm/material/fluidsystems/blackoilpvt/DryHumidGasPvt.hpp
@@ -967,6 +981,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/common/Means.hpp
       opm/material/common/IntervalTabulated2DFunction.hpp
       opm/material/common/Tabulated1DFunction.hpp
+      opm/material/common/PackedTabulatedFunctions.hpp
       opm/material/densead/Evaluation9.hpp
       opm/material/densead/Evaluation8.hpp
       opm/material/densead/Evaluation7.hpp
@@ -977,6 +992,7 @@ list( APPEND PUBLIC_HEADER_FILES
       opm/material/densead/Evaluation11.hpp
       opm/material/densead/DynamicEvaluation.hpp
       opm/material/densead/Math.hpp
+      opm/material/densead/SimdValue.hpp
       opm/material/densead/Evaluation1.hpp
       opm/material/densead/Evaluation12.hpp
       opm/material/densead/Evaluation2.hpp
@@ -1342,6 +1358,7 @@ if(ENABLE_ECL_INPUT)
        opm/input/eclipse/Deck/DeckView.hpp
        opm/input/eclipse/Deck/FileDeck.hpp
        opm/input/eclipse/Deck/DeckSection.hpp
+       opm/input/eclipse/Deck/DeckCache.hpp
        opm/input/eclipse/Deck/DeckTree.hpp
        opm/input/eclipse/Deck/DeckOutput.hpp
        opm/input/eclipse/Deck/DeckValue.hpp
@@ -1355,6 +1372,8 @@ endif()
 if(ENABLE_ECL_OUTPUT)
   list(APPEND PUBLIC_HEADER_FILES
         opm/io/eclipse/EclFile.hpp
+        opm/io/eclipse/ColumnESmry.hpp
+        opm/io/eclipse/ColumnSmryOutput.hpp
         opm/io/eclipse/EclIOdata.hpp
         opm/io/eclipse/EclOutput.hpp
         opm/io/eclipse/EclUtil.hpp
@@ -1369,6 +1388,7 @@ if(ENABLE_ECL_OUTPUT)
         opm/io/eclipse/OutputStream.hpp
         opm/io/eclipse/ExtSmryOutput.hpp
         opm/io/eclipse/RestartFileView.hpp
+        opm/io/eclipse/RestartIndex.hpp
         opm/io/eclipse/SummaryNode.hpp
         opm/io/eclipse/rst/action.hpp
         opm/io/eclipse/rst/aquifer.hpp
@@ -20,11 +20,17 @@
 #include <iostream>
 #include <iomanip>
 #include <chrono>
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+#include <getopt.h>
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckCache.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
@@ -42,7 +48,24 @@ void initLogging() {
     Opm::OpmLog::addBackend( "COUT" , cout_log);
 }
 
-inline void loadDeck( const char * deck_file) {
+void print_help_and_exit() {
+    const char * help_text = R"(
+The opmi program will load one or more decks and report the time spent
+creating the Deck, EclipseState, Schedule and SummaryConfig objects.
+
+   opmi [-c cache_dir] DECK1.DATA DECK2.DATA ...
+
+Options:
+
+   -c: Keep parsed decks in cache_dir and load them from there when the
+       input files have not changed.
+
+)";
+    std::cerr << help_text << std::endl;
+    exit(1);
+}
+
+inline void loadDeck( const char * deck_file, const std::optional<Opm::DeckCache>& cache) {
     Opm::ParseContext parseContext;
     Opm::ErrorGuard errors;
     Opm::Parser parser;
@@ -53,7 +76,9 @@ inline void loadDeck( const char * deck_file) {
     Opm::time_point start;
 
     start = Opm::TimeService::now();
-    auto deck = parser.parseFile(deck_file, parseContext, errors);
+    auto deck = cache.has_value()
+        ? cache->parseFile(parser, deck_file, parseContext, errors)
+        : parser.parseFile(deck_file, parseContext, errors);
     auto deck_time = Opm::TimeService::now() - start;
 
     std::cout << "parse complete - creating EclipseState .... ";  std::cout.flush();
@@ -85,8 +110,28 @@ inline void loadDeck( const char * deck_file) {
 
 
 int main(int argc, char** argv) {
+    std::optional<Opm::DeckCache> cache;
+
+    while (true) {
+        int c;
+        c = getopt(argc, argv, "c:");
+        if (c == -1)
+            break;
+
+        switch(c) {
+        case 'c':
+            cache.emplace(optarg);
+            break;
+        default:
+            print_help_and_exit();
+        }
+    }
+
+    if (optind >= argc)
+        print_help_and_exit();
+
     initLogging();
-    for (int iarg = 1; iarg < argc; iarg++)
-        loadDeck( argv[iarg] );
+    for (int iarg = optind; iarg < argc; iarg++)
+        loadDeck( argv[iarg], cache );
 }
 
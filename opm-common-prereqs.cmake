@@ -9,6 +9,7 @@ set (opm-common_CONFIG_VAR
 	HAVE_FINAL
 	HAVE_ECL_INPUT
 	HAVE_CXA_DEMANGLE
+	HAVE_ZLIB
 	)
 
 # dependencies
@@ -29,5 +30,7 @@ list(APPEND opm-common_DEPS
       # as the embedded one.
       "fmt 7.0.3"
       "QuadMath"
+      # compressed restart and init files
+      "ZLIB QUIET"
 )
 find_package_deps(opm-common)
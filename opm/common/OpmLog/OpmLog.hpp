@@ -22,6 +22,8 @@
 
 #include <memory>
 #include <cstdint>
+#include <string>
+#include <vector>
 
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
@@ -90,6 +92,35 @@ public:
 
     static bool stdoutIsTerminal();
 
+    /// A message which has been logged but not yet passed to the backends.
+    struct DeferredMessage
+    {
+        int64_t flag;
+        std::string tag;
+        std::string text;
+    };
+
+    /// While an instance is alive, messages logged on the thread which
+    /// created it are appended to a list instead of being passed to the
+    /// backends.  The backends are not thread safe, so threads other than
+    /// the one owning the log use this and hand the messages over with
+    /// addDeferredMessages().
+    class DeferMessages
+    {
+    public:
+        explicit DeferMessages(std::vector<DeferredMessage>& messages);
+        ~DeferMessages();
+
+        DeferMessages(const DeferMessages&) = delete;
+        DeferMessages& operator=(const DeferMessages&) = delete;
+
+    private:
+        std::vector<DeferredMessage>* previous_;
+    };
+
+    /// Pass messages collected by DeferMessages to the backends, in order.
+    static void addDeferredMessages(const std::vector<DeferredMessage>& messages);
+
 private:
     static std::shared_ptr<Logger> getLogger();
     static std::shared_ptr<Logger> m_logger;
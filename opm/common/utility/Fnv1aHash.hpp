@@ -0,0 +1,72 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_FNV1A_HASH_HPP
+#define OPM_FNV1A_HASH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Opm {
+
+//! \brief Incremental 64 bit FNV-1a hash.
+//! \details Unlike std::hash, the value only depends on the bytes hashed,
+//!          so it may be stored and compared across builds, platforms and
+//!          standard libraries.  Not suitable as a cryptographic hash.
+class Fnv1aHash
+{
+public:
+    //! Hash more data, as if appended to the data hashed so far.
+    void update(const void* data, std::size_t size)
+    {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            this->value_ = (this->value_ ^ bytes[i]) * prime;
+        }
+    }
+
+    void update(std::string_view data)
+    {
+        this->update(data.data(), data.size());
+    }
+
+    std::uint64_t value() const
+    {
+        return this->value_;
+    }
+
+    //! Hash of a single string.
+    static std::uint64_t hash(std::string_view data)
+    {
+        Fnv1aHash hasher;
+        hasher.update(data);
+        return hasher.value();
+    }
+
+private:
+    static constexpr std::uint64_t offset_basis = 0xcbf29ce484222325ULL;
+    static constexpr std::uint64_t prime = 0x100000001b3ULL;
+
+    std::uint64_t value_{offset_basis};
+};
+
+} // namespace Opm
+
+#endif // OPM_FNV1A_HASH_HPP
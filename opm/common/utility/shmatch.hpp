@@ -20,18 +20,77 @@
 #ifndef OPM_UTILITY_SHMATCH_HPP
 #define OPM_UTILITY_SHMATCH_HPP
 
+#include <bitset>
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace Opm {
 
 /*
-  The shmatch() function is an implementation of the shell matching algorithm
-  used in posix function fnmatch(). It is implemented here based on std::regex
-  to avoid using a posix function.
+  The ShellPattern class is a compiled shell pattern with the matching rules
+  of the posix function fnmatch(): '*' matches any sequence of characters,
+  '?' matches one character, '[...]' matches one character from a set which
+  can contain ranges like 'a-z' and be negated with a leading '!' or '^', and
+  '\' makes the next character literal. All other characters only match
+  themselves, and the pattern is anchored at the beginning and the end.
+
+  Compile the pattern once when it is matched against many names:
+
+      const ShellPattern pattern("OP*");
+      for (const auto& well : wells)
+          if (pattern.match(well)) ...
+*/
+
+class ShellPattern
+{
+public:
+    explicit ShellPattern(const std::string& pattern);
+
+    bool match(const std::string& symbol) const;
+
+    // The indices of the names in the table which match the pattern, in
+    // increasing order.
+    std::vector<std::size_t> match(const std::vector<std::string>& names) const;
+
+    const std::string& pattern() const
+    {
+        return this->m_pattern;
+    }
+
+private:
+    enum class Kind : unsigned char { Char, AnyChar, AnySequence, CharSet };
+
+    struct Token
+    {
+        Kind kind;
+        char ch;
+        std::size_t set;
+    };
+
+    std::string m_pattern;
+    std::vector<Token> m_tokens;
+    std::vector<std::bitset<256>> m_sets;
+
+    // Patterns without wildcards, and patterns whose only wildcard is a
+    // trailing '*', are matched with plain string comparisons.
+    bool m_literal = false;
+    bool m_prefix = false;
+    std::string m_text;
+
+    bool match_token(const Token& token, char c) const;
+};
+
+/*
+  The shmatch() function matches one symbol against a shell pattern. The
+  most recently used patterns are kept compiled in a small per-thread
+  cache, so repeated calls with the same pattern do not recompile it.
 */
 
 bool shmatch(const std::string& pattern, const std::string& symbol);
 
+// The indices of the names in the table which match the pattern.
+std::vector<std::size_t> shmatch(const std::string& pattern, const std::vector<std::string>& names);
 
 }
-#endif //OPM_UTILITY_STRING_HPP
+#endif //OPM_UTILITY_SHMATCH_HPP
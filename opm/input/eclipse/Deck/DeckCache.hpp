@@ -0,0 +1,85 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef DECK_CACHE_HPP
+#define DECK_CACHE_HPP
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace Opm {
+
+class ErrorGuard;
+class ParseContext;
+class Parser;
+
+/*
+  The DeckCache class maintains a persistent, binary cache of parsed decks
+  in a directory, one cache file per input deck. A cache file records the
+  size and a content hash of the data file and every file included in the
+  deck, the cache file format, the opm-common version, a hash of the
+  keyword definitions of the Parser and a hash of the ParseContext
+  settings, including the ignored keywords, used when parsing. A cached
+  deck is only used if none of the input files have changed and the same
+  format, version, keywords and ParseContext settings are in effect;
+  otherwise the deck is parsed again and the cache file is replaced. All
+  hashes are 64 bit FNV-1a hashes, so cache files may be shared between
+  builds.
+
+  The cache is used by the opmi program when given a cache directory with
+  the -c option.
+
+  Observe that warnings collected in the ErrorGuard while parsing are not
+  replayed when a deck is loaded from the cache.
+*/
+
+class DeckCache {
+public:
+    explicit DeckCache(const std::filesystem::path& directory);
+
+    // Cached deck for dataFile, or nullopt if there is no valid cache file.
+    std::optional<Deck> load(const Parser& parser,
+                             const std::string& dataFile,
+                             const ParseContext& parseContext) const;
+
+    // Write deck to the cache. Returns false if the deck could not be
+    // cached, e.g. because a single keyword is too large to serialize.
+    bool store(const Parser& parser,
+               const Deck& deck,
+               const ParseContext& parseContext) const;
+
+    // Load the deck from the cache if possible, otherwise parse dataFile
+    // and store the resulting deck in the cache.
+    Deck parseFile(const Parser& parser,
+                   const std::string& dataFile,
+                   const ParseContext& parseContext,
+                   ErrorGuard& errors) const;
+
+    std::filesystem::path cacheFile(const std::string& dataFile) const;
+
+private:
+    std::filesystem::path directory;
+};
+
+}
+
+#endif
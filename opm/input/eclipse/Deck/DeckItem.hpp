@@ -151,6 +151,9 @@ namespace Opm {
         }
 
         void reserve_additionalRawString(std::size_t);
+
+        // Reserve room for n additional int or double values.
+        void reserve_additional(std::size_t n);
     private:
         mutable std::vector< double > dval;
         std::vector< int > ival;
@@ -24,6 +24,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
+#include <vector>
 
 
 namespace Opm {
@@ -47,14 +48,33 @@ public:
     bool has_include(const std::string& fname) const;
     const std::string& root() const;
 
+    // Canonical names of the root file and all included files.
+    std::vector<std::string> files() const;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(root_file);
+        serializer(nodes);
+    }
+
 private:
     class TreeNode {
     public:
+        TreeNode() = default;
         explicit TreeNode(const std::string& fn);
         TreeNode(const std::string& pn, const std::string& fn);
         void add_include(const std::string& include_file);
         bool includes(const std::string& include_file) const;
 
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(fname);
+            serializer(parent);
+            serializer(include_files);
+        }
+
         std::string fname;
         std::optional<std::string> parent;
         std::unordered_set<std::string> include_files;
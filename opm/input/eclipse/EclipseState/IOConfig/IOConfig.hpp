@@ -156,6 +156,18 @@ namespace Opm {
 
         void setEclCompatibleRST(bool ecl_rst);
         bool getEclCompatibleRST() const;
+
+        /// Write binary restart and init files in the compressed format of
+        /// EclIO::EclOutput.  Such files are only readable by OPM tools.
+        void setCompressedOutput(bool compressed);
+        bool getCompressedOutput() const;
+
+        /// Maintain an index of the arrays in unformatted, uncompressed
+        /// unified restart files, written as <CASE>.UNRST.INDEX.  Lets OPM
+        /// tools read a report step without scanning the restart file.
+        void setRestartIndex(bool index);
+        bool getRestartIndex() const;
+
         bool getWriteEGRIDFile() const;
         bool getWriteINITFile() const;
         bool getUNIFOUT() const;
@@ -205,6 +217,8 @@ namespace Opm {
             serializer(m_nosim);
             serializer(m_base_name);
             serializer(ecl_compatible_rst);
+            serializer(compressed_output);
+            serializer(restart_index);
         }
 
     private:
@@ -220,6 +234,8 @@ namespace Opm {
         bool            m_nosim;
         std::string     m_base_name;
         bool            ecl_compatible_rst = true;
+        bool            compressed_output = false;
+        bool            restart_index = false;
 
         IOConfig( const GRIDSection&,
                   const RUNSPECSection&,
@@ -96,6 +96,7 @@ class KeywordLocation;
         void update(InputErrorAction action);
         void update(const std::string& keyString , InputErrorAction action);
         void ignoreKeyword(const std::string& keyword);
+        const std::set<std::string>& ignoredKeywords() const;
         InputErrorAction get(const std::string& key) const;
         std::map<std::string,InputErrorAction>::const_iterator begin() const;
         std::map<std::string,InputErrorAction>::const_iterator end() const;
@@ -20,6 +20,7 @@
 #ifndef OPM_PARSER_HPP
 #define OPM_PARSER_HPP
 
+#include <cstdint>
 #include <filesystem>
 #include <iosfwd>
 #include <list>
@@ -137,6 +138,13 @@ namespace Opm {
          */
         size_t size() const;
 
+        /// Hash of the definitions of all keywords known to the parser,
+        /// including keywords added at runtime.  Decks parsed with
+        /// different keyword definitions have different hashes.  The
+        /// value is a 64 bit FNV-1a hash, so it is the same in all builds
+        /// with the same keyword definitions and may be stored on disk.
+        std::uint64_t keywordHash() const;
+
         template <class T>
         void addKeyword() {
             addParserKeyword( T() );
@@ -168,6 +176,35 @@ namespace Opm {
 
         const std::vector<std::pair<std::string,std::string>> codeKeywords() const;
 
+        /// Whether or not to memory map input files.
+        ///
+        /// In memory mapped mode the input files, including all INCLUDE
+        /// files, are mapped into memory rather than being read into a
+        /// string buffer and comments are stripped lazily on a line by
+        /// line basis.  No cleaned copy of the input file is created.
+        /// Files containing code keywords, such as PYACTION, are always
+        /// read into memory.
+        ///
+        /// \param[in] on Whether or not to enable memory mapped input.
+        void setMemoryMappedInput(bool on);
+
+        /// Whether or not input files are memory mapped.
+        bool memoryMappedInput() const;
+
+        /// Whether or not to convert data keywords in parallel.
+        ///
+        /// When enabled, and the library is built with OpenMP support,
+        /// runs of consecutive data keywords such as PORO, PERMX or ZCORN
+        /// are converted from their raw tokens to DeckKeyword instances on
+        /// multiple threads and added to the Deck in input order.  The
+        /// resulting Deck is identical to the one produced sequentially.
+        ///
+        /// \param[in] on Whether or not to enable parallel conversion.
+        void setParallelDataKeywords(bool on);
+
+        /// Whether or not data keywords are converted in parallel.
+        bool parallelDataKeywords() const;
+
     private:
         bool hasWildCardKeyword(const std::string& keyword) const;
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
@@ -184,6 +221,9 @@ namespace Opm {
         std::map< std::string_view, const ParserKeyword* > m_wildCardKeywords;
 
         std::vector<std::pair<std::string,std::string>> code_keywords;
+
+        bool m_memory_mapped_input{false};
+        bool m_parallel_data_keywords{false};
     };
 
 } // namespace Opm
@@ -23,11 +23,14 @@
 #include <opm/common/utility/TimeService.hpp>
 
 #include <chrono>
+#include <cstddef>
 #include <iosfwd>
+#include <iterator>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -63,11 +66,53 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// All values are stored in flat arrays, the string keys only map to a slot
+// in these arrays.  Code which updates or reads the same variables
+// repeatedly can register them once and use the returned integer handle
+// instead of the string keys:
+//
+//     const auto wwct = st.register_well_var("OPX", "WWCT");
+//     st.update(wwct, 0.75);
+//     st.get(wwct) => 0.75
+//     st.get_well_var("OPX", "WWCT") => 0.75
+//
+// A handle is valid for the lifetime of the SummaryState object, and for
+// copies of it.  Registering a variable does not define a value for it.
 
 class SummaryState
 {
 public:
-    typedef std::unordered_map<std::string, double>::const_iterator const_iterator;
+    using Handle = std::size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<const std::string&, double>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = value_type;
+
+        const_iterator(const SummaryState* st, std::size_t slot);
+
+        value_type operator*() const;
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& other) const
+        { return this->slot_ == other.slot_; }
+
+        bool operator!=(const const_iterator& other) const
+        { return !(*this == other); }
+
+    private:
+        const SummaryState* st_;
+        std::size_t slot_;
+
+        void skip_undefined();
+    };
+
     explicit SummaryState(time_point sim_start_arg);
 
     // The std::time_t constructor is only for export to Python
@@ -89,6 +134,10 @@ public:
 
     bool has(const std::string& key) const;
     bool has_well_var(const std::string& well, const std::string& var) const;
+    // The single argument has_well_var() and has_group_var() only
+    // consider entries which currently hold a value, i.e. they return false
+    // once the last well/group holding 'var' has been erased even though
+    // the internal slot is kept alive for registered handles.
     bool has_well_var(const std::string& var) const;
     bool has_group_var(const std::string& group, const std::string& var) const;
     bool has_group_var(const std::string& var) const;
@@ -115,6 +164,19 @@ public:
     double get_conn_var(const std::string& conn, const std::string& var, std::size_t global_index, double) const;
     double get_segment_var(const std::string& well, const std::string& var, std::size_t segment, double) const;
 
+    // Interned variables.  The update(Handle) method accumulates or
+    // assigns like the corresponding update_xxx() method.
+    Handle register_key(const std::string& key);
+    Handle register_well_var(const std::string& well, const std::string& var);
+    Handle register_group_var(const std::string& group, const std::string& var);
+    Handle register_conn_var(const std::string& well, const std::string& var, std::size_t global_index);
+    Handle register_segment_var(const std::string& well, const std::string& var, std::size_t segment);
+
+    void update(Handle handle, double value);
+    bool has(Handle handle) const;
+    double get(Handle handle) const;
+    double get(Handle handle, double default_value) const;
+
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -129,43 +191,108 @@ public:
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
+      // The serialised form is the nested maps used before the values
+      // were moved to flat storage, this keeps restart files compatible.
+      auto maps = serializer.isSerializing() ? this->to_maps() : NestedMaps{};
+
       serializer(sim_start);
       serializer(elapsed);
-      serializer(values);
-      serializer(well_values);
+      serializer(maps.values);
+      serializer(maps.well_values);
       serializer(m_wells);
       serializer(well_names);
-      serializer(group_values);
+      serializer(maps.group_values);
       serializer(m_groups);
       serializer(group_names);
-      serializer(conn_values);
-      serializer(segment_values);
+      serializer(maps.conn_values);
+      serializer(maps.segment_values);
+
+      if (!serializer.isSerializing())
+          this->from_maps(maps);
     }
 
     static SummaryState serializationTestObject();
 
 private:
+    template <class T>
+    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
+
+    template <class T>
+    using map3 = map2<std::unordered_map<std::size_t, T>>;
+
+    struct NestedMaps
+    {
+        std::unordered_map<std::string, double> values;
+        map2<double> well_values;
+        map2<double> group_values;
+        map3<double> conn_values;
+        map3<double> segment_values;
+    };
+
+    // Flat value storage.  A slot is never released, erasing a variable
+    // only clears its defined flag so handles remain valid.
+    struct Slots
+    {
+        std::vector<double> value;
+        std::vector<unsigned char> defined;
+        std::vector<unsigned char> total;
+        std::vector<Handle> handle;
+
+        std::size_t add(bool is_total);
+        void assign(std::size_t slot, double v);
+        void update(std::size_t slot, double v);
+        bool has(std::size_t slot) const { return this->defined[slot] != 0; }
+        void clear_defined();
+    };
+
+    enum class VarKind : unsigned char { Key, Well, Group, Conn, Segment };
+
+    struct HandleInfo
+    {
+        VarKind kind;
+        std::size_t key_slot;
+        std::size_t var_slot;
+        std::string wgname;
+    };
+
     time_point sim_start;
     double elapsed = 0;
-    std::unordered_map<std::string,double> values;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
+    // The general colon separated keys, 'WWCT:OPX', and the slots of
+    // their values.
+    Slots key_slots;
+    std::vector<std::string> key_names;
+    std::unordered_map<std::string, std::size_t> key_index;
+
+    // Slots of the values in the specialized structures.  For wells and
+    // groups the first key is the variable and the second key is the well
+    // or group.  Connections are additionally indexed by the global index,
+    // with offset 1, and segments by the one-based segment number.
+    Slots var_slots;
+    map2<std::size_t> well_index;
+    map2<std::size_t> group_index;
+    map3<std::size_t> conn_index;
+    map3<std::size_t> segment_index;
+
     std::set<std::string> m_wells;
     mutable std::optional<std::vector<std::string>> well_names;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
     std::set<std::string> m_groups;
     mutable std::optional<std::vector<std::string>> group_names;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    std::vector<HandleInfo> handles;
+
+    std::size_t key_slot(const std::string& key);
+    std::size_t find_key_slot(const std::string& key) const;
+    std::size_t var_slot(map2<std::size_t>& index, const std::string& var, const std::string& wgname);
+    std::size_t var_slot(map3<std::size_t>& index, const std::string& var, const std::string& well, std::size_t number);
+    Handle make_handle(VarKind kind, std::size_t key_slot, std::size_t var_slot, const std::string& wgname);
+
+    void add_well(const std::string& well);
+    void add_group(const std::string& group);
 
-    // The first key is the variable and the second key is the well and the
-    // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
+    NestedMaps to_maps() const;
+    void from_maps(const NestedMaps& maps);
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -75,6 +75,8 @@ public:
     }
 
 private:
+    friend class UDQEvalPlan;
+
     UDQTokenType type;
 
     std::variant<std::string, double> value;
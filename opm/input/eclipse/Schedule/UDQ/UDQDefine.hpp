@@ -40,6 +40,7 @@
 namespace Opm {
 
 class UDQASTNode;
+class UDQEvalPlan;
 class ParseContext;
 class ErrorGuard;
 
@@ -101,6 +102,10 @@ public:
         serializer(string_data);
         serializer(m_update_status);
         serializer(m_report_step);
+
+        if (! serializer.isSerializing()) {
+            this->compile_plan();
+        }
     }
 
 private:
@@ -113,6 +118,12 @@ private:
     UDQUpdate m_update_status;
     mutable std::optional<std::string> string_data;
 
+    // Flattened evaluation of 'ast', if supported.  Derived from 'ast' and
+    // therefore neither serialized nor compared.
+    std::shared_ptr<const UDQEvalPlan> m_plan;
+
+    void compile_plan();
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
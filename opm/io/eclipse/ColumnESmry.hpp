@@ -0,0 +1,92 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ColumnESmry_HPP
+#define OPM_IO_ColumnESmry_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <opm/common/utility/TimeService.hpp>
+
+namespace Opm { namespace EclIO {
+
+namespace ColumnSmry {
+    struct Index;
+}
+
+// Reader for columnar summary files (.CSMRY) written by ColumnSmryOutput.
+// Opening the file only reads the metadata and the chunk indices, and a
+// vector is read with one read per chunk overlapping the requested range
+// of time steps.
+class ColumnESmry
+{
+public:
+    explicit ColumnESmry(const std::string& filename);
+    ~ColumnESmry();
+
+    // Read the chunk indices written since the file was opened or last
+    // refreshed, to pick up time steps appended by a running writer.
+    void refresh();
+
+    std::vector<float> get(const std::string& name) const;
+
+    // Values for time steps [from, to).
+    std::vector<float> get(const std::string& name, std::size_t from, std::size_t to) const;
+
+    // Values for several vectors and time steps [from, to), every chunk
+    // is read once.
+    std::vector<std::vector<float>> get(const std::vector<std::string>& names,
+                                        std::size_t from, std::size_t to) const;
+
+    std::vector<float> get_at_rstep(const std::string& name) const;
+    const std::string& get_unit(const std::string& name) const;
+
+    time_point startdate() const { return m_startdat; }
+    const std::vector<int>& start_v() const;
+    std::vector<time_point> dates() const;
+
+    bool hasKey(const std::string& key) const;
+
+    std::size_t numberOfTimeSteps() const { return m_nTstep; }
+    std::size_t numberOfVectors() const;
+
+    const std::vector<std::string>& keywordList() const;
+    std::vector<std::string> keywordList(const std::string& pattern) const;
+
+private:
+    std::filesystem::path m_inputFileName;
+    std::unique_ptr<ColumnSmry::Index> m_index;
+    std::unordered_map<std::string, std::size_t> m_keyIndex;
+
+    std::size_t m_nTstep;
+    time_point m_startdat;
+
+    std::size_t keyIndex(const std::string& name) const;
+    std::vector<std::vector<std::uint32_t>> readColumns(const std::vector<std::size_t>& columns,
+                                                        std::size_t from, std::size_t to) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ColumnESmry_HPP
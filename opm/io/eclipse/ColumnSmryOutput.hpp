@@ -0,0 +1,76 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_ColumnSmryOutput_HPP
+#define OPM_IO_ColumnSmryOutput_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+// Writer for the columnar summary format (.CSMRY), see ColumnESmry for
+// the reader. Time steps are buffered in memory and written as one
+// compressed chunk every chunkSize time steps. The file is only appended
+// to, and a chunk is published to readers by updating the committed size
+// in the file header once the chunk has been written.
+class ColumnSmryOutput
+{
+public:
+    // startDate: day, month, year, hour, minute, second, millisecond
+    ColumnSmryOutput(const std::string& filename,
+                     const std::vector<std::string>& keys,
+                     const std::vector<std::string>& units,
+                     const std::vector<int>& startDate,
+                     std::size_t chunkSize = 256);
+
+    ~ColumnSmryOutput();
+
+    ColumnSmryOutput(const ColumnSmryOutput&) = delete;
+    ColumnSmryOutput& operator=(const ColumnSmryOutput&) = delete;
+
+    void write(const std::vector<float>& ts_data, bool is_report_step);
+
+    // Write buffered time steps as a (possibly partial) chunk and make
+    // them visible to readers.
+    void flush();
+
+    std::size_t numberOfTimeSteps() const;
+
+private:
+    std::fstream m_file;
+    std::size_t m_chunkSize;
+    std::size_t m_nVect;
+    std::size_t m_numWritten;
+
+    // Committed size of the file.
+    std::uint64_t m_end;
+
+    // Buffered time steps, one column per vector plus report step flags.
+    std::vector<std::vector<std::uint32_t>> m_pending;
+
+    // Flush the file and publish the data up to end to readers.
+    void commit(std::uint64_t end);
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ColumnSmryOutput_HPP
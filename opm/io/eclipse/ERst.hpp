@@ -30,6 +30,7 @@
 
 namespace Opm { namespace EclIO { namespace OutputStream {
     class Restart;
+    class UnifiedRestart;
 }}}
 
 namespace Opm { namespace EclIO {
@@ -38,6 +39,7 @@ class ERst : public EclFile
 {
 public:
     explicit ERst(const std::string& filename);
+    ERst(const std::string& filename, MemoryMapped mmap);
 
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
@@ -45,6 +47,10 @@ public:
 
     void loadReportStepNumber(int number);
 
+    // Load only the arrays of a report step whose names are in the list.
+    // Names which are not present in the report step are ignored.
+    void loadReportStepNumber(int number, const std::vector<std::string>& names);
+
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber)
     {
@@ -64,6 +70,13 @@ public:
     template <typename T>
     const std::vector<T>& getRestartData(const std::string& name, int reportStepNumber, const std::string& lgr_name);
 
+    // In place access to numeric restart arrays, requires a memory mapped file.
+    template <typename T>
+    ArrayView<T> getRestartView(const std::string& name, int reportStepNumber, int occurrence = 0)
+    {
+        return this->view<T>(this->getArrayIndex(name, reportStepNumber, occurrence));
+    }
+
     template <typename T>
     const std::vector<T>& getRestartData(int index, int reportStepNumber, const std::string& lgr_name);
 
@@ -76,6 +89,7 @@ public:
     std::vector<EclEntry> listOfRstArrays(int reportStepNumber, const std::string& lgr_name);
 
     friend class OutputStream::Restart;
+    friend class OutputStream::UnifiedRestart;
 
 private:
     int nReports;
@@ -87,6 +101,12 @@ private:
     void initUnified();
     void initSeparate(const int number);
 
+    // Array headers from restart index, see RestartIndex.  Returns false,
+    // without touching the object, if there is no usable index.
+    bool initIndexed();
+
+    void initRanges(const std::vector<int>& firstIndex);
+
     int get_start_index_lgrname(int number, const std::string& lgr_name);
 
     int getArrayIndex(const std::string& name, int seqnum, int occurrence);
@@ -20,12 +20,14 @@
 #define OPM_IO_ESMRY_HPP
 
 #include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
 #include <vector>
 #include <map>
+#include <mutex>
 #include <stdint.h>
 
 #include <opm/common/utility/TimeService.hpp>
@@ -56,10 +58,14 @@ public:
     std::vector<float> get_at_rstep(const SummaryNode& node) const;
     std::vector<time_point> dates_at_rstep() const;
 
+    // get() and loadData() can be called concurrently from several
+    // threads. Threads loading different vectors read the files in
+    // parallel, a vector requested by several threads is loaded once.
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
     bool make_esmry_file();
+    bool make_csmry_file(std::size_t chunkSize = 256);
 
     time_point startdate() const { return tp_startdat; }
     std::vector<int> start_v() const { return start_vect; }
@@ -117,6 +123,18 @@ private:
     mutable double m_io_opening;
     mutable double m_io_loading;
 
+    // Vectors being loaded by some thread.
+    mutable std::vector<bool> vectorLoading;
+
+    // Protects vectorData, vectorLoaded, vectorLoading and m_io_loading.
+    // Held only while claiming and publishing vectors, not during I/O.
+    mutable std::mutex m_load_mutex;
+    mutable std::condition_variable m_load_cv;
+
+    void loadVectors(const std::vector<int>& keywIndVect, bool allParams) const;
+    void readVectors(const std::vector<int>& loadInd, std::vector<std::vector<float>>& data) const;
+    void readAllVectors(const std::vector<int>& loadInd, std::vector<std::vector<float>>& data) const;
+
     std::vector<std::string> checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const;
 
     void getRstString(const std::vector<std::string>& restartArray,
@@ -20,15 +20,21 @@
 #define OPM_IO_ECLFILE_HPP
 
 #include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <ios>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <string>
 #include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
-#include <cstdint>
 
 namespace Opm { namespace EclIO {
 
@@ -39,10 +45,127 @@ public:
         bool value;
     };
 
+    // Memory map a binary file instead of reading arrays through a file
+    // stream. Numeric arrays can then be accessed in place with view().
+    struct MemoryMapped {
+        bool value;
+    };
+
+    // Read-only view of a numeric array in a memory mapped binary file.
+    // Elements are converted from big endian on access, only the pages
+    // which are actually touched are read from disk.
+    template <typename T>
+    class ArrayView
+    {
+    public:
+        class const_iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = T;
+
+            const_iterator(const ArrayView* view, std::size_t index) : m_view(view), m_index(index) {}
+
+            T operator*() const { return (*m_view)[m_index]; }
+            T operator[](difference_type n) const { return (*m_view)[m_index + n]; }
+            const_iterator& operator++() { ++m_index; return *this; }
+            const_iterator operator++(int) { auto tmp = *this; ++m_index; return tmp; }
+            const_iterator& operator--() { --m_index; return *this; }
+            const_iterator operator--(int) { auto tmp = *this; --m_index; return tmp; }
+            const_iterator& operator+=(difference_type n) { m_index += n; return *this; }
+            const_iterator& operator-=(difference_type n) { m_index -= n; return *this; }
+            const_iterator operator+(difference_type n) const { return { m_view, m_index + n }; }
+            const_iterator operator-(difference_type n) const { return { m_view, m_index - n }; }
+            difference_type operator-(const const_iterator& other) const
+            {
+                return static_cast<difference_type>(m_index) - static_cast<difference_type>(other.m_index);
+            }
+            bool operator==(const const_iterator& other) const { return m_index == other.m_index; }
+            bool operator!=(const const_iterator& other) const { return m_index != other.m_index; }
+            bool operator<(const const_iterator& other) const { return m_index < other.m_index; }
+
+        private:
+            const ArrayView* m_view;
+            std::size_t m_index;
+        };
+
+        // Number of bytes per element on disk, logi values are stored as 4 byte integers.
+        static constexpr std::size_t elementSize = std::is_same_v<T, bool> ? 4 : sizeof(T);
+
+        ArrayView(const char* data, std::size_t size, std::shared_ptr<const void> mapping)
+            : m_data(data), m_size(size), m_mapping(std::move(mapping))
+        {}
+
+        std::size_t size() const { return m_size; }
+        bool empty() const { return m_size == 0; }
+
+        T operator[](std::size_t index) const
+        {
+            // Binary arrays are written in blocks of 1000 elements, each
+            // enclosed by a four byte record marker on either side.
+            const char* ptr = m_data
+                + (index / blockElements) * (blockElements * elementSize + 2 * sizeof(std::int32_t))
+                + sizeof(std::int32_t)
+                + (index % blockElements) * elementSize;
+
+            if constexpr (elementSize == 4) {
+                std::uint32_t raw;
+                std::memcpy(&raw, ptr, sizeof raw);
+                raw = byteSwap(raw);
+
+                if constexpr (std::is_same_v<T, bool>) {
+                    return raw != 0;
+                } else {
+                    T value;
+                    std::memcpy(&value, &raw, sizeof value);
+                    return value;
+                }
+            } else {
+                std::uint64_t raw;
+                std::memcpy(&raw, ptr, sizeof raw);
+                raw = byteSwap(raw);
+
+                T value;
+                std::memcpy(&value, &raw, sizeof value);
+                return value;
+            }
+        }
+
+        T at(std::size_t index) const
+        {
+            if (index >= m_size)
+                throw std::out_of_range("Index " + std::to_string(index) + " out of range in ArrayView");
+
+            return (*this)[index];
+        }
+
+        const_iterator begin() const { return { this, 0 }; }
+        const_iterator end() const { return { this, m_size }; }
+
+        std::vector<T> copy() const { return { this->begin(), this->end() }; }
+
+    private:
+        static constexpr std::size_t blockElements = 1000;
+
+        const char* m_data;
+        std::size_t m_size;
+        std::shared_ptr<const void> m_mapping;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
+
+    bool memoryMapped() const { return static_cast<bool>(mapping); }
     bool formattedInput() const { return formatted; }
 
+    // Whether input is a compressed binary file, see EclOutput::Compressed.
+    // Such files are never memory mapped.
+    bool compressedInput() const { return compressed; }
+
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
     void loadData(int arrIndex);                // load data based on array indices in vector arrIndex
@@ -68,6 +191,14 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    // In place access to int, float, double and bool arrays, only
+    // available for uncompressed binary files opened in memory mapped mode.
+    template <typename T>
+    ArrayView<T> view(int arrIndex) const;
+
+    template <typename T>
+    ArrayView<T> view(const std::string& name) const;
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -102,12 +233,47 @@ protected:
     std::streampos
     seekPosition(const std::vector<std::string>::size_type arrIndex) const;
 
+    template <typename T>
+    ArrayView<T> viewImpl(int arrIndex, eclArrType type, const std::string& typeStr) const;
+
+    // For derived classes which may know the array headers of a binary
+    // file from elsewhere, e.g., from an index.  Does not read the file.
+    // Must be followed by either load() or calls to addArray() and
+    // finally addEndOfFile().
+    struct Deferred {};
+    EclFile(const std::string& filename, MemoryMapped mmap, Deferred);
+
+    void load(bool preload);
+
+    void addArray(const std::string& name, eclArrType type, std::int64_t size,
+                  int elementSize, std::uint64_t dataPos);
+    void addEndOfFile(std::uint64_t fileSize);
+
 private:
+    class Mapping;
+
+    // Location of the compressed blocks of an array.
+    struct CompressedArray {
+        std::uint64_t rawSize = 0;
+        std::uint64_t blockSize = 0;
+        std::vector<std::uint64_t> blockPos;    // file positions of blocks and end of last block
+    };
+
+    bool compressed = false;
+    std::vector<CompressedArray> compressedArrays;
+
     std::vector<bool> arrayLoaded;
+    std::shared_ptr<const Mapping> mapping;
+
+    void mapFile();
+    bool loadMappedArray(std::size_t arrIndex);
 
-    void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void readCompressedIndex(std::fstream& fileH, std::size_t arrIndex);
+    void readCompressedArray(int fd, std::size_t arrIndex, std::vector<char>& buffer) const;
+
+    void loadBinaryArray(std::istream& fileH, std::size_t arrIndex);
+    void loadBinaryArrays(const std::vector<int>& arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
-    void load(bool preload);
 
     std::vector<unsigned int> get_bin_logi_raw_values(int arrIndex) const;
     std::vector<std::string> get_fmt_real_raw_str_values(int arrIndex) const;
@@ -66,6 +66,25 @@ namespace Opm { namespace EclIO {
     const int columnWidthLogi = 3;       // number of characters fore each Inte Element
     const int columnWidthChar = 11;      // number of characters fore each Inte Element
 
+    // named constants related to compressed binary file format
+    //
+    // A compressed file starts with the marker below and otherwise has the
+    // array headers of a binary file.  The data of each non-empty array,
+    // i.e., its binary records including record markers, are split into
+    // blocks which are compressed independently with zlib.  The array
+    // header is followed by a block index and the compressed blocks:
+    //
+    //   8 bytes  total size of the array's binary records
+    //   4 bytes  uncompressed size of each block, except the last
+    //   4 bytes  number of blocks, n
+    //   n * 4    compressed size of each block
+    //   ...      compressed blocks
+    //
+    // All integers are big endian, as in binary files.
+    const char compressedFileMarker[] = "OPMZLIB1";
+    const int sizeOfCompressedFileMarker = 8;
+    const int compressedBlockSize = 1 << 20;    // uncompressed bytes per block when writing
+
 }} // namespace Opm::EclIO
 
 #endif // OPM_IO_ECLIODATA_HPP
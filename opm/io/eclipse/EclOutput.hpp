@@ -18,8 +18,11 @@
 #ifndef OPM_IO_ECLOUTPUT_HPP
 #define OPM_IO_ECLOUTPUT_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <ios>
+#include <memory>
 #include <string>
 #include <typeinfo>
 #include <vector>
@@ -30,17 +33,36 @@
 namespace Opm { namespace EclIO { namespace OutputStream {
     class Restart;
     class SummarySpecification;
+    class UnifiedRestart;
 }}}
 
+namespace Opm { namespace EclIO {
+    class RestartIndex;
+}}
+
 namespace Opm { namespace EclIO {
 
 class EclOutput
 {
 public:
+    /// Compressed binary output.  Array data are stored as blocks which
+    /// are compressed with zlib, see EclIOdata.hpp for the layout.  Such
+    /// files are read transparently by EclFile, but not by other tools.
+    /// Only available if built with zlib.
+    struct Compressed {
+        bool value;
+    };
+
     EclOutput(const std::string&            filename,
               const bool                    formatted,
               const std::ios_base::openmode mode = std::ios::out);
 
+    EclOutput(const std::string&            filename,
+              const Compressed              compressed,
+              const std::ios_base::openmode mode = std::ios::out);
+
+    ~EclOutput();
+
     template<typename T>
     void write(const std::string& name,
                const std::vector<T>& data)
@@ -72,6 +94,8 @@ public:
             if (arrType != MESS)
                 writeBinaryArray(data);
         }
+
+        writeStaged();
     }
 
     // when this function is used array type will be assumed C0NN (not CHAR).
@@ -84,10 +108,18 @@ public:
 
     void set_ix() { ix_standard = true; }
 
+    bool compressedOutput() const { return this->compressor_ != nullptr; }
+
     friend class OutputStream::Restart;
     friend class OutputStream::SummarySpecification;
+    friend class OutputStream::UnifiedRestart;
+    friend class RestartIndex;
 
 private:
+    class Compressor;
+
+    void open(const std::string& filename, const std::ios_base::openmode mode);
+
     void writeBinaryHeader(const std::string& arrName, int64_t size, eclArrType arrType, int element_size);
 
     template <typename T>
@@ -104,6 +136,25 @@ private:
     void writeFormattedCharArray(const std::vector<std::string>& data, int element_size);
     void writeFormattedCharArray(const std::vector<PaddedOutputString<8>>& data);
 
+    /// Reserve space for output at the end of the staging buffer.  Output
+    /// is assembled in the staging buffer and passed on to the file stream
+    /// in large chunks, rather than by many small writes.
+    ///
+    /// \return Start of reserved space.  Valid until next call.
+    char* stage(std::size_t numBytes);
+
+    /// Append characters to the staging buffer.
+    void stage(const char* str, std::size_t len);
+
+    /// Append string to the staging buffer, right aligned in a field of
+    /// given width.
+    void stageRightAligned(const char* str, std::size_t len, std::size_t width);
+
+    /// Pass contents of staging buffer on to the file stream, or to the
+    /// compressor while writing the data of an array in compressed mode.
+    /// Must be called at the end of each public write operation.
+    void writeStaged();
+
     void writeArrayType(const eclArrType arrType);
     std::string make_real_string_ecl(float value) const;
     std::string make_real_string_ix(float value) const;
@@ -112,6 +163,27 @@ private:
 
     bool isFormatted, ix_standard;
     std::ofstream ofileH;
+
+    /// Staging buffer, reused across arrays.
+    std::vector<char> buffer_{};
+
+    /// Number of bytes in staging buffer not yet written to file.
+    std::size_t staged_{0};
+
+    /// Compresses array data.  Null unless writing compressed output.
+    std::unique_ptr<Compressor> compressor_{};
+
+    /// Header of the most recently written binary array.  Used to index
+    /// unified restart files.
+    struct ArrayHeader {
+        std::string name{};
+        eclArrType type{MESS};
+        std::int64_t size{0};
+        int elementSize{0};
+        int headerSize{0};      // bytes from start of header to start of data
+    };
+
+    ArrayHeader lastHeader_{};
 };
 
 
@@ -26,9 +26,24 @@
 #include <vector>
 #include <functional>
 #include <cstdint>
+#include <iosfwd>
 
 namespace Opm { namespace EclIO {
 
+    // Reverse the byte order of a word.  Compilers recognise the shifts
+    // and emit a single byte swap instruction.
+    inline std::uint32_t byteSwap(const std::uint32_t w)
+    {
+        return ((w & 0x000000FFu) << 24) | ((w & 0x0000FF00u) << 8)
+            |  ((w & 0x00FF0000u) >> 8)  | ((w & 0xFF000000u) >> 24);
+    }
+
+    inline std::uint64_t byteSwap(const std::uint64_t w)
+    {
+        return (std::uint64_t{byteSwap(static_cast<std::uint32_t>(w))} << 32)
+            | byteSwap(static_cast<std::uint32_t>(w >> 32));
+    }
+
     int flipEndianInt(int num);
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
@@ -67,16 +82,16 @@ namespace Opm { namespace EclIO {
                       std::int64_t &num, Opm::EclIO::eclArrType &arrType, int& elementSize);
 
     template<typename T, typename T2>
-    std::vector<T> readBinaryArray(std::fstream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
+    std::vector<T> readBinaryArray(std::istream& fileH, const std::int64_t size, Opm::EclIO::eclArrType type,
                                std::function<T(T2)>& flip, int elementSize);
 
-    std::vector<int> readBinaryInteArray(std::fstream &fileH, const std::int64_t size);
-    std::vector<float> readBinaryRealArray(std::fstream& fileH, const std::int64_t size);
-    std::vector<double> readBinaryDoubArray(std::fstream& fileH, const std::int64_t size);
-    std::vector<bool> readBinaryLogiArray(std::fstream &fileH, const std::int64_t size);
-    std::vector<unsigned int> readBinaryRawLogiArray(std::fstream &fileH, const std::int64_t size);
-    std::vector<std::string> readBinaryCharArray(std::fstream& fileH, const std::int64_t size);
-    std::vector<std::string> readBinaryC0nnArray(std::fstream& fileH, const std::int64_t size, int elementSize);
+    std::vector<int> readBinaryInteArray(std::istream& fileH, const std::int64_t size);
+    std::vector<float> readBinaryRealArray(std::istream& fileH, const std::int64_t size);
+    std::vector<double> readBinaryDoubArray(std::istream& fileH, const std::int64_t size);
+    std::vector<bool> readBinaryLogiArray(std::istream& fileH, const std::int64_t size);
+    std::vector<unsigned int> readBinaryRawLogiArray(std::istream& fileH, const std::int64_t size);
+    std::vector<std::string> readBinaryCharArray(std::istream& fileH, const std::int64_t size);
+    std::vector<std::string> readBinaryC0nnArray(std::istream& fileH, const std::int64_t size, int elementSize);
 
     template<typename T>
     std::vector<T> readFormattedArray(const std::string& file_str, const int size, std::int64_t fromPos,
@@ -43,6 +43,11 @@ public:
                int report_step,
                bool is_final_summary);
 
+    // Summary keys with the cell and region numbers of block, connection
+    // and inter-region flow vectors replaced as in ESmry::keywordList().
+    static std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys,
+                                                       const GridDims& dims);
+
 private:
     static constexpr int m_min_write_interval = 15;  // at least 15 seconds between each write
     std::chrono::time_point<std::chrono::system_clock> m_last_write;
@@ -61,10 +66,8 @@ private:
     std::vector<int> m_tstep;
     std::vector<std::vector<float>> m_smrydata;
 
-    std::array<int, 3> ijk_from_global_index(const GridDims& dims,
-                                             int globInd) const;
-    std::vector<std::string> make_modified_keys(const std::vector<std::string>& valueKeys,
-                                                const GridDims& dims);
+    static std::array<int, 3> ijk_from_global_index(const GridDims& dims,
+                                                    int globInd);
     bool rename_tmpfile(const std::string& tmp_fname);
 };
 
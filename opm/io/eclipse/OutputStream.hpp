@@ -26,6 +26,7 @@
 #include <array>
 #include <chrono>
 #include <ios>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,13 +34,17 @@
 namespace Opm { namespace EclIO {
 
     class EclOutput;
+    class ERst;
+    class RestartIndex;
 
 }} // namespace Opm::EclIO
 
 namespace Opm { namespace EclIO { namespace OutputStream {
 
-    struct Formatted { bool set; };
-    struct Unified   { bool set; };
+    struct Formatted  { bool set; };
+    struct Unified    { bool set; };
+    struct Compressed { bool set; };
+    struct Indexed    { bool set; };
 
     /// Abstract representation of an ECLIPSE-style result set.
     struct ResultSet
@@ -62,8 +67,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] rset Output directory and base name of output stream.
         ///
         /// \param[in] fmt Whether or not to create formatted output files.
-        explicit Init(const ResultSet& rset,
-                      const Formatted& fmt);
+        ///
+        /// \param[in] compr Whether or not to create compressed output
+        ///    files.  Ignored for formatted output.
+        explicit Init(const ResultSet&  rset,
+                      const Formatted&  fmt,
+                      const Compressed& compr = Compressed{ false });
 
         ~Init();
 
@@ -119,8 +128,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
+        ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed output file.
         void open(const std::string& fname,
-                  const bool         formatted);
+                  const bool         formatted,
+                  const bool         compressed);
 
         /// Access writable output stream.
         EclOutput& stream();
@@ -152,11 +165,20 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] fmt Whether or not to create formatted output files.
         ///
         /// \param[in] unif Whether or not to create unified output files.
-        explicit Restart(const ResultSet& rset,
-                         const int        seqnum,
-                         const Formatted& fmt,
-                         const Unified&   unif);
+        ///
+        /// \param[in] compr Whether or not to create compressed output
+        ///    files.  Ignored for formatted output.
+        explicit Restart(const ResultSet&  rset,
+                         const int         seqnum,
+                         const Formatted&  fmt,
+                         const Unified&    unif,
+                         const Compressed& compr = Compressed{ false });
 
+        /// Destructor.
+        ///
+        /// Flushes the output stream unless finish() has been called.
+        /// Never throws, and does not add the report step to the index
+        /// since the step might be incomplete.
         ~Restart();
 
         Restart(const Restart& rhs) = delete;
@@ -165,6 +187,14 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         Restart& operator=(const Restart& rhs) = delete;
         Restart& operator=(Restart&& rhs);
 
+        /// Complete output of the report step.
+        ///
+        /// Flushes the output stream and adds the report step to the
+        /// restart file's index, if any.  Call once all arrays of the
+        /// report step have been written.  No further output is possible
+        /// through this object afterwards.
+        void finish();
+
         /// Generate a message string (keyword type 'MESS') in underlying
         /// output stream.
         ///
@@ -223,8 +253,28 @@ namespace Opm { namespace EclIO { namespace OutputStream {
                    const std::vector<PaddedOutputString<8>>& data);
 
     private:
-        /// Restart output stream.
-        std::unique_ptr<EclOutput> stream_;
+        friend class UnifiedRestart;
+
+        /// Restart output stream.  Shared with the owning \c
+        /// UnifiedRestart object if created through that class.
+        std::shared_ptr<EclOutput> stream_;
+
+        /// Index of restart file.  Records all arrays written through
+        /// this object.  Null unless created by a \c UnifiedRestart
+        /// object which maintains an index.
+        std::shared_ptr<RestartIndex> index_;
+
+        /// Constructor.
+        ///
+        /// Attaches to an already open output stream which is positioned
+        /// at the start of a new report step.  Used by \c UnifiedRestart.
+        ///
+        /// \param[in] stream Open output stream.
+        ///
+        /// \param[in] index Index of restart file, possibly null.  The
+        ///    report step is written to the index by finish().
+        Restart(std::shared_ptr<EclOutput> stream,
+                std::shared_ptr<RestartIndex> index);
 
         /// Open unified output file and place stream's output indicator
         /// in appropriate location.
@@ -236,10 +286,14 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
         ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed output file.
+        ///
         /// \param[in] seqnum Sequence number of new report.  One-based
         ///    report step ID.
         void openUnified(const std::string& fname,
                          const bool         formatted,
+                         const bool         compressed,
                          const int          seqnum);
 
         /// Open new output stream.
@@ -251,8 +305,12 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///
         /// \param[in] formatted Whether or not to create a
         ///    formatted output file.
+        ///
+        /// \param[in] compressed Whether or not to create a
+        ///    compressed output file.
         void openNew(const std::string& fname,
-                     const bool         formatted);
+                     const bool         formatted,
+                     const bool         compressed);
 
         /// Open existing output file and place stream's output indicator
         /// in appropriate location.
@@ -266,6 +324,7 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         ///    place output indicator at end of file (i.e, simple append).
         void openExisting(const std::string&   fname,
                           const bool           formatted,
+                          const bool           compressed,
                           const std::streampos writePos);
 
         /// Access writable output stream.
@@ -277,6 +336,111 @@ namespace Opm { namespace EclIO { namespace OutputStream {
         template <typename T>
         void writeImpl(const std::string&    kw,
                        const std::vector<T>& data);
+
+        /// Write a single array and record it in the index, if any.
+        ///
+        /// \param[in] writeArray Function which writes the array to the
+        ///    output stream passed as its argument.
+        template <typename WriteArray>
+        void writeIndexed(WriteArray&& writeArray);
+    };
+
+    /// Long-lived file manager for unified restart output streams.
+    ///
+    /// Keeps the unified restart file open for the duration of the run and
+    /// maintains an index of the write positions of all SEQNUM keywords in
+    /// the file.  Starting a new report step thus does not need to rescan
+    /// the existing file, contrary to constructing a \c Restart object
+    /// directly.  The file is scanned at most once, when the first report
+    /// step is written to a unified restart file which already exists,
+    /// e.g., in a restarted run.
+    ///
+    /// Unformatted, uncompressed files may be accompanied by an index of
+    /// all arrays in the file, see \c RestartIndex, which lets readers
+    /// locate a report step's arrays without scanning the file.
+    class UnifiedRestart
+    {
+    public:
+        /// Constructor.
+        ///
+        /// Does not open or create any files.
+        ///
+        /// \param[in] rset Output directory and base name of output stream.
+        ///
+        /// \param[in] fmt Whether or not to create formatted output files.
+        ///
+        /// \param[in] compr Whether or not to create a compressed output
+        ///    file.  Ignored for formatted output.
+        ///
+        /// \param[in] indexed Whether or not to maintain an index of the
+        ///    restart file.  Ignored for formatted or compressed output.
+        explicit UnifiedRestart(const ResultSet&  rset,
+                                const Formatted&  fmt,
+                                const Compressed& compr   = Compressed{ false },
+                                const Indexed&    indexed = Indexed{ false });
+
+        ~UnifiedRestart();
+
+        UnifiedRestart(const UnifiedRestart& rhs) = delete;
+        UnifiedRestart(UnifiedRestart&& rhs);
+
+        UnifiedRestart& operator=(const UnifiedRestart& rhs) = delete;
+        UnifiedRestart& operator=(UnifiedRestart&& rhs);
+
+        /// Start output of a new report step.
+        ///
+        /// Discards the existing contents of the file from the first report
+        /// step whose sequence number is not less than \p seqnum, if any,
+        /// and outputs a SEQNUM record.  The returned object writes to the
+        /// shared output stream.  Call its finish() member function once
+        /// the report step is complete.  At most one such object should be
+        /// alive at any time.
+        ///
+        /// \param[in] seqnum Sequence number of new report.  One-based
+        ///    report step ID.
+        ///
+        /// \return Restart file manager for report step \p seqnum.
+        Restart prepareStep(const int seqnum);
+
+    private:
+        /// Filename of unified restart file.
+        std::string fname_;
+
+        /// Whether or not to create a formatted output file.
+        bool formatted_;
+
+        /// Whether or not to create a compressed output file.
+        bool compressed_;
+
+        /// Whether or not to maintain an index of the restart file.
+        bool indexed_;
+
+        /// Restart output stream.  Null until first call to \c
+        /// prepareStep.
+        std::shared_ptr<EclOutput> stream_;
+
+        /// Write positions of the SEQNUM keywords in the file.
+        std::map<int, std::streampos> seqnumPos_;
+
+        /// Index of restart file.  Null until first call to \c
+        /// prepareStep, and if not requested or for formatted or
+        /// compressed output.
+        std::shared_ptr<RestartIndex> index_;
+
+        /// Open output stream, scanning existing file if needed.
+        ///
+        /// Writes to \c stream_, \c seqnumPos_ and \c index_.
+        void open();
+
+        /// Create index of the restart file.
+        ///
+        /// \param[in] rst Existing restart file, null if the file is new.
+        void createIndex(const ERst* rst);
+
+        /// Discard file contents from a position onwards.
+        ///
+        /// \param[in] writePos New size of the file.
+        void truncate(const std::streampos writePos);
     };
 
     /// File manager for RFT output streams
@@ -22,6 +22,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -49,6 +50,12 @@ public:
 
     int occurrenceCount(const std::string& vector) const;
 
+    /// Read the named vectors of the report step in a single pass.
+    ///
+    /// Vectors are otherwise read from the file when first requested
+    /// through getKeyword().  Names which are not present are ignored.
+    void loadKeywords(const std::vector<std::string>& vectors) const;
+
     template <typename ElmType>
     bool hasKeyword(const std::string& vector) const;
 
@@ -0,0 +1,140 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_RESTART_INDEX_HPP
+#define OPM_IO_RESTART_INDEX_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+
+#include <cstdint>
+#include <ios>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class EclOutput;
+
+/// Sidecar index of an unformatted, uncompressed unified restart file.
+///
+/// Stored next to the restart file as <CASE>.UNRST.INDEX, and records the
+/// name, type, size and data position of every array of each report step
+/// in the restart file.  Readers can thus locate all arrays without
+/// scanning the restart file, see ERst.  The index is itself an
+/// unformatted file with the following arrays per report step
+///
+///   SEQNUM    INTE   report step number
+///   NAME      CHAR   array names
+///   TYPE      INTE   array types, values of eclArrType
+///   ELMSIZE   INTE   element sizes
+///   SIZE      DOUB   number of elements
+///   DATAPOS   DOUB   file position of first data record
+///   ENDPOS    DOUB   file position after last array of report step
+///
+/// Sizes and positions are stored as double precision values since there
+/// is no 64 bit integer array type.  They are exact up to 2^53.
+///
+/// The index is only used if it is consistent with the restart file.
+/// Otherwise readers fall back to scanning the restart file.
+class RestartIndex
+{
+public:
+    /// Array in restart file.
+    struct Array
+    {
+        std::string name{};
+        eclArrType type{MESS};
+        std::int64_t size{0};
+        int elementSize{0};
+        std::uint64_t dataPos{0};
+    };
+
+    /// Arrays of a single report step, including the SEQNUM array.
+    struct Step
+    {
+        int seqnum{0};
+        std::vector<Array> arrays{};
+        std::uint64_t endPos{0};
+    };
+
+    /// Filename of index pertaining to a unified restart file.
+    static std::string fileName(const std::string& restartFile);
+
+    /// Read index of a unified restart file.
+    ///
+    /// \return Report steps in order of appearance in restart file.  Empty
+    ///    if there is no index or if the index does not match the restart
+    ///    file, e.g., because the restart file has been written to by a
+    ///    process which does not maintain the index.
+    static std::vector<Step> read(const std::string& restartFile);
+
+    /// Constructor.
+    ///
+    /// Does not open or create any files.
+    ///
+    /// \param[in] restartFile Filename of unified restart file.
+    explicit RestartIndex(const std::string& restartFile);
+
+    ~RestartIndex();
+
+    RestartIndex(const RestartIndex& rhs) = delete;
+    RestartIndex& operator=(const RestartIndex& rhs) = delete;
+
+    /// Create new index file, replacing any existing index.
+    ///
+    /// \param[in] steps Report steps already in restart file.
+    void create(const std::vector<Step>& steps);
+
+    /// Discard report steps whose sequence number is not less than \p
+    /// seqnum.  Must match truncation of restart file.
+    void truncate(const int seqnum);
+
+    /// Start recording arrays of a new report step.
+    void beginStep(const int seqnum);
+
+    /// Record array of current report step.
+    void addArray(Array array);
+
+    /// Write current report step to index file.
+    ///
+    /// \param[in] endPos File position after last array of report step.
+    void endStep(const std::uint64_t endPos);
+
+private:
+    /// Filename of index.
+    std::string fname_;
+
+    /// Index output stream.  Null until first call to \c create().
+    std::unique_ptr<EclOutput> stream_;
+
+    /// Write positions of the report steps in the index file.
+    std::map<int, std::streampos> stepPos_;
+
+    /// Report step currently being recorded.
+    Step current_;
+
+    /// Write report step to index file.
+    void write(const Step& step);
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_RESTART_INDEX_HPP
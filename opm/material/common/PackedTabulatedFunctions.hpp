@@ -0,0 +1,391 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Read-only copies of a set of tabulated functions, e.g. one per PVT
+ *        region, which are stored in a single contiguous buffer.
+ */
+#ifndef OPM_PACKED_TABULATED_FUNCTIONS_HPP
+#define OPM_PACKED_TABULATED_FUNCTIONS_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/common/UniformXTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+namespace PackedTabulation {
+
+/*!
+ * \brief A sorted axis of sampling points within a packed buffer.
+ *
+ * Besides the offset of the sampling points, the axis refers to a uniform
+ * grid of buckets over the interior segments. Each bucket stores the index of
+ * the segment which contains its lower end, so locating a segment amounts to
+ * one multiplication and usually not more than one or two comparisons
+ * instead of a bisection.
+ */
+template <class Scalar>
+struct Axis
+{
+    unsigned begin = 0;
+    unsigned size = 0;
+    unsigned bucketBegin = 0;
+    unsigned numBuckets = 0;
+    Scalar bucketOrigin = 0.0;
+    Scalar bucketScale = 0.0;
+};
+
+/*!
+ * \brief Append the sampling points of an axis to a packed buffer.
+ */
+template <class Scalar, class Iterator>
+Axis<Scalar> appendAxis(Iterator first, Iterator last,
+                        std::vector<Scalar>& data,
+                        std::vector<unsigned>& buckets)
+{
+    Axis<Scalar> axis;
+    axis.begin = data.size();
+    axis.size = std::distance(first, last);
+    data.insert(data.end(), first, last);
+
+    // The segment search only needs the acceleration index if there are at
+    // least two interior segments.
+    if (axis.size < 4)
+        return axis;
+
+    const Scalar* x = data.data() + axis.begin;
+    const unsigned n = axis.size;
+
+    axis.bucketBegin = buckets.size();
+    axis.numBuckets = 2*n;
+    axis.bucketOrigin = x[1];
+    axis.bucketScale = axis.numBuckets/(x[n - 2] - x[1]);
+
+    for (unsigned b = 0; b < axis.numBuckets; ++b) {
+        const Scalar lo = axis.bucketOrigin + b/axis.bucketScale;
+        const auto upper = std::upper_bound(x + 1, x + n - 2, lo);
+        buckets.push_back(std::clamp<unsigned>(std::distance(x, upper) - 1, 1, n - 3));
+    }
+
+    return axis;
+}
+
+/*!
+ * \brief Return the index of the segment of an axis to be used for a value.
+ *
+ * The result is the same as the one of the bisection in
+ * Tabulated1DFunction::findSegmentIndex() and
+ * UniformXTabulated2DFunction::xSegmentIndex(): the first or the last
+ * segment for values outside of the interior segments, and otherwise the
+ * segment whose lower end is the largest sampling point not above the
+ * value. Non-finite values are not diagnosed, they lead to non-finite
+ * results instead.
+ */
+template <class Scalar, class ValueType>
+unsigned segmentIndex(const Axis<Scalar>& axis,
+                      const Scalar* data,
+                      const unsigned* buckets,
+                      ValueType value)
+{
+    const Scalar* x = data + axis.begin;
+    const unsigned n = axis.size;
+
+    if (value <= x[1])
+        return 0;
+    else if (value >= x[n - 2])
+        return n - 2;
+    else if (n < 4)
+        return 0; // only reached for NaN
+
+    const ValueType t = (value - axis.bucketOrigin)*axis.bucketScale;
+    unsigned bucketIdx = 0;
+    if (t > 0)
+        bucketIdx = std::min<unsigned>(static_cast<unsigned>(std::min<ValueType>(t, axis.numBuckets - 1)),
+                                       axis.numBuckets - 1);
+
+    unsigned segIdx = buckets[axis.bucketBegin + bucketIdx];
+    while (segIdx + 1 < n - 2 && x[segIdx + 1] <= value)
+        ++segIdx;
+    while (segIdx > 1 && x[segIdx] > value)
+        --segIdx;
+
+    return segIdx;
+}
+
+} // namespace PackedTabulation
+
+/*!
+ * \brief A set of linearly interpolated functions of one variable which are
+ *        stored in a single buffer.
+ *
+ * The functions are copies of Tabulated1DFunction objects and evaluate to
+ * the same values as Tabulated1DFunction::eval() with extrapolation.
+ */
+template <class Scalar>
+class PackedTabulated1DFunctions
+{
+public:
+    PackedTabulated1DFunctions() = default;
+
+    explicit PackedTabulated1DFunctions(const std::vector<Tabulated1DFunction<Scalar>>& functions)
+    {
+        tables_.reserve(functions.size());
+        for (const auto& fn : functions) {
+            Table_ table;
+            table.x = PackedTabulation::appendAxis(fn.xValues().begin(), fn.xValues().end(),
+                                                   data_, buckets_);
+            table.yBegin = data_.size();
+            data_.insert(data_.end(), fn.yValues().begin(), fn.yValues().end());
+            tables_.push_back(table);
+        }
+    }
+
+    /*!
+     * \brief Return the number of functions.
+     */
+    std::size_t size() const
+    { return tables_.size(); }
+
+    bool empty() const
+    { return tables_.empty(); }
+
+    /*!
+     * \brief Evaluate a function at a given position, extrapolating linearly
+     *        outside of its range.
+     */
+    template <class Evaluation>
+    Evaluation eval(unsigned tableIdx, const Evaluation& x) const
+    {
+        const Table_& table = tables_[tableIdx];
+        if (table.x.size < 2)
+            throw std::logic_error("We need at least two sampling points to "
+                                   "do interpolation/extrapolation, "
+                                   "and the table only contains " +
+                                   std::to_string(table.x.size) +
+                                   " sampling points");
+
+        const Scalar* xValues = data_.data() + table.x.begin;
+        const Scalar* yValues = data_.data() + table.yBegin;
+        const unsigned segIdx = PackedTabulation::segmentIndex(table.x, data_.data(), buckets_.data(),
+                                                               scalarValue(x));
+
+        Scalar x0 = xValues[segIdx];
+        Scalar x1 = xValues[segIdx + 1];
+
+        Scalar y0 = yValues[segIdx];
+        Scalar y1 = yValues[segIdx + 1];
+
+        return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
+    }
+
+    /*!
+     * \brief Evaluate the functions for a batch of positions.
+     *
+     * values[i] is set to the value of function tableIdx[i] at x[i].
+     */
+    template <class Evaluation>
+    void eval(const unsigned* tableIdx,
+              const Evaluation* x,
+              Evaluation* values,
+              std::size_t numValues) const
+    {
+        for (std::size_t i = 0; i < numValues; ++i)
+            values[i] = eval(tableIdx[i], x[i]);
+    }
+
+private:
+    struct Table_
+    {
+        PackedTabulation::Axis<Scalar> x;
+        unsigned yBegin = 0;
+    };
+
+    std::vector<Scalar> data_;
+    std::vector<unsigned> buckets_;
+    std::vector<Table_> tables_;
+};
+
+/*!
+ * \brief A set of functions of two variables, sampled uniformly in the X
+ *        direction, which are stored in a single buffer.
+ *
+ * The functions are copies of UniformXTabulated2DFunction objects and
+ * evaluate to the same values as UniformXTabulated2DFunction::eval() with
+ * extrapolation, including the guided interpolation policies.
+ */
+template <class Scalar>
+class PackedUniformXTabulated2DFunctions
+{
+public:
+    using InterpolationPolicy = typename UniformXTabulated2DFunction<Scalar>::InterpolationPolicy;
+
+    PackedUniformXTabulated2DFunctions() = default;
+
+    explicit PackedUniformXTabulated2DFunctions(const std::vector<UniformXTabulated2DFunction<Scalar>>& functions)
+    {
+        std::vector<Scalar> tmp;
+
+        tables_.reserve(functions.size());
+        for (const auto& fn : functions) {
+            Table_ table;
+            table.policy = fn.interpolationGuide();
+            table.x = PackedTabulation::appendAxis(fn.xPos().begin(), fn.xPos().end(),
+                                                   data_, buckets_);
+            table.yPosBegin = data_.size();
+            data_.insert(data_.end(), fn.yPos().begin(), fn.yPos().end());
+            table.columnBegin = columns_.size();
+            table.valid = fn.numX() >= 2;
+
+            for (const auto& samples : fn.samples()) {
+                Column_ column;
+
+                tmp.clear();
+                for (const auto& sample : samples)
+                    tmp.push_back(std::get<1>(sample));
+                column.y = PackedTabulation::appendAxis(tmp.begin(), tmp.end(), data_, buckets_);
+
+                column.valueBegin = data_.size();
+                for (const auto& sample : samples)
+                    data_.push_back(std::get<2>(sample));
+
+                table.valid = table.valid && samples.size() >= 2;
+                columns_.push_back(column);
+            }
+
+            tables_.push_back(table);
+        }
+    }
+
+    /*!
+     * \brief Return the number of functions.
+     */
+    std::size_t size() const
+    { return tables_.size(); }
+
+    bool empty() const
+    { return tables_.empty(); }
+
+    /*!
+     * \brief Evaluate a function at a given (x,y) position, extrapolating
+     *        outside of its range.
+     */
+    template <class Evaluation>
+    Evaluation eval(unsigned tableIdx, const Evaluation& x, const Evaluation& y) const
+    {
+        const Table_& table = tables_[tableIdx];
+        if (!table.valid)
+            throw std::logic_error("We need at least two sampling points in each direction "
+                                   "to do interpolation/extrapolation");
+
+        const Scalar* data = data_.data();
+        const Scalar* xPos = data + table.x.begin;
+        const Scalar* yPos = data + table.yPosBegin;
+
+        const unsigned i = PackedTabulation::segmentIndex(table.x, data, buckets_.data(), scalarValue(x));
+        const Evaluation alpha = (x - xPos[i])/(xPos[i + 1] - xPos[i]);
+
+        // see UniformXTabulated2DFunction::findPoints() for the meaning of
+        // the shift.
+        Evaluation shift = 0.0;
+        if (table.policy == InterpolationPolicy::LeftExtreme) {
+            shift = yPos[i + 1] - yPos[i];
+        }
+        else if (table.policy == InterpolationPolicy::RightExtreme) {
+            shift = yPos[i + 1] - yPos[i];
+            auto yEnd = yPos[i]*(1.0 - alpha) + yPos[i + 1]*alpha;
+            if (yEnd > 0.) {
+                shift = shift * y / yEnd;
+            } else {
+                shift = 0.;
+            }
+        }
+        auto yLower =  y - alpha*shift;
+        auto yUpper =  y + (1 - alpha)*shift;
+
+        const Column_& col1 = columns_[table.columnBegin + i];
+        const Column_& col2 = columns_[table.columnBegin + i + 1];
+        const unsigned j1 = PackedTabulation::segmentIndex(col1.y, data, buckets_.data(), scalarValue(yLower));
+        const unsigned j2 = PackedTabulation::segmentIndex(col2.y, data, buckets_.data(), scalarValue(yUpper));
+
+        const Scalar* y1 = data + col1.y.begin;
+        const Scalar* y2 = data + col2.y.begin;
+        const Evaluation beta1 = (yLower - y1[j1])/(y1[j1 + 1] - y1[j1]);
+        const Evaluation beta2 = (yUpper - y2[j2])/(y2[j2 + 1] - y2[j2]);
+
+        const Scalar* v1 = data + col1.valueBegin;
+        const Scalar* v2 = data + col2.valueBegin;
+        const Evaluation& s1 = v1[j1]*(1.0 - beta1) + v1[j1 + 1]*beta1;
+        const Evaluation& s2 = v2[j2]*(1.0 - beta2) + v2[j2 + 1]*beta2;
+
+        return s1*(1.0 - alpha) + s2*alpha;
+    }
+
+    /*!
+     * \brief Evaluate the functions for a batch of positions.
+     *
+     * values[i] is set to the value of function tableIdx[i] at (x[i], y[i]).
+     */
+    template <class Evaluation>
+    void eval(const unsigned* tableIdx,
+              const Evaluation* x,
+              const Evaluation* y,
+              Evaluation* values,
+              std::size_t numValues) const
+    {
+        for (std::size_t i = 0; i < numValues; ++i)
+            values[i] = eval(tableIdx[i], x[i], y[i]);
+    }
+
+private:
+    struct Column_
+    {
+        PackedTabulation::Axis<Scalar> y;
+        unsigned valueBegin = 0;
+    };
+
+    struct Table_
+    {
+        PackedTabulation::Axis<Scalar> x;
+        unsigned yPosBegin = 0;
+        unsigned columnBegin = 0;
+        InterpolationPolicy policy = InterpolationPolicy::Vertical;
+        bool valid = false;
+    };
+
+    std::vector<Scalar> data_;
+    std::vector<unsigned> buckets_;
+    std::vector<Column_> columns_;
+    std::vector<Table_> tables_;
+};
+
+} // namespace Opm
+
+#endif
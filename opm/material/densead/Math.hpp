@@ -33,6 +33,7 @@
 #define OPM_LOCAL_AD_MATH_HPP
 
 #include "Evaluation.hpp"
+#include "SimdValue.hpp"
 
 #include <opm/material/common/MathToolbox.hpp>
 
@@ -485,6 +486,242 @@ Evaluation<ValueType, numVars, staticSize> log10(const Evaluation<ValueType, num
     return result;
 }
 
+// Evaluations of packed values, i.e., Evaluation<SimdValue<Scalar, width>, ...>. The
+// functions above which branch on the value are overloaded to select the result for each
+// lane separately.
+
+//! take the lanes of a where the mask is set and the ones of b elsewhere
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+select(const SimdMask<width>& mask,
+       const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& a,
+       const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& b)
+{
+    Evaluation<SimdValue<Scalar, width>, numVars, staticSize> result(a);
+
+    result.setValue(select(mask, a.value(), b.value()));
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+        result.setDerivative(curVarIdx, select(mask, a.derivative(curVarIdx), b.derivative(curVarIdx)));
+
+    return result;
+}
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+abs(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x)
+{ return select(laneGreater(x.value(), SimdValue<Scalar, width>(0.0)), x, -x); }
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+min(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x1,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x2)
+{ return select(laneLess(x1.value(), x2.value()), x1, x2); }
+
+template <class Arg1ValueType, class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+min(const Arg1ValueType& x1,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x2)
+{
+    Evaluation<SimdValue<Scalar, width>, numVars, staticSize> ret(x2);
+    ret = x1;
+    return select(laneLess(ret.value(), x2.value()), ret, x2);
+}
+
+template <class Scalar, int width, int numVars, unsigned staticSize, class Arg2ValueType>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+min(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x1,
+    const Arg2ValueType& x2)
+{ return min(x2, x1); }
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+max(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x1,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x2)
+{ return select(laneGreater(x1.value(), x2.value()), x1, x2); }
+
+template <class Arg1ValueType, class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+max(const Arg1ValueType& x1,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x2)
+{
+    Evaluation<SimdValue<Scalar, width>, numVars, staticSize> ret(x2);
+    ret = x1;
+    return select(laneGreater(ret.value(), x2.value()), ret, x2);
+}
+
+template <class Scalar, int width, int numVars, unsigned staticSize, class Arg2ValueType>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+max(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x1,
+    const Arg2ValueType& x2)
+{ return max(x2, x1); }
+
+// exponentiation of arbitrary base with a fixed constant
+template <class Scalar, int width, int numVars, unsigned staticSize, class ExpType>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+pow(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& base,
+    const ExpType& exp)
+{
+    typedef SimdValue<Scalar, width> ValueType;
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+    Evaluation<ValueType, numVars, staticSize> result(base);
+
+    const ValueType& pow_x = ValueTypeToolbox::pow(base.value(), exp);
+    result.setValue(pow_x);
+
+    // derivatives use the chain rule
+    const ValueType& df_dx = pow_x/base.value()*exp;
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+        result.setDerivative(curVarIdx, df_dx*base.derivative(curVarIdx));
+
+    // the lanes with a base of 0 are treated like in the generic function
+    const Evaluation<ValueType, numVars, staticSize> zero(0.0);
+    return select(laneEqual(base.value(), ValueType(0.0)), zero, result);
+}
+
+// exponentiation of constant base with an arbitrary exponent
+template <class BaseType, class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+pow(const BaseType& base,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& exp)
+{
+    typedef SimdValue<Scalar, width> ValueType;
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+    Evaluation<ValueType, numVars, staticSize> result(exp);
+
+    const ValueType& lnBase = ValueTypeToolbox::log(base);
+    result.setValue(ValueTypeToolbox::exp(lnBase*exp.value()));
+
+    // derivatives use the chain rule
+    const ValueType& df_dx = lnBase*result.value();
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+        result.setDerivative(curVarIdx, df_dx*exp.derivative(curVarIdx));
+
+    const Evaluation<ValueType, numVars, staticSize> zero(0.0);
+    return select(laneEqual(ValueType(base), ValueType(0.0)), zero, result);
+}
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<SimdValue<Scalar, width>, numVars, staticSize>
+pow(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& base,
+    const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& exp)
+{
+    typedef SimdValue<Scalar, width> ValueType;
+    typedef MathToolbox<ValueType> ValueTypeToolbox;
+    Evaluation<ValueType, numVars, staticSize> result(base);
+
+    const ValueType& valuePow = ValueTypeToolbox::pow(base.value(), exp.value());
+    result.setValue(valuePow);
+
+    const ValueType& f = base.value();
+    const ValueType& g = exp.value();
+    const ValueType& logF = ValueTypeToolbox::log(f);
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx) {
+        const ValueType& fPrime = base.derivative(curVarIdx);
+        const ValueType& gPrime = exp.derivative(curVarIdx);
+        result.setDerivative(curVarIdx, (g*fPrime/f + logF*gPrime) * valuePow);
+    }
+
+    const Evaluation<ValueType, numVars, staticSize> zero(0.0);
+    return select(laneEqual(f, ValueType(0.0)), zero, result);
+}
+
+// access to the individual lanes of packed values. this allows to apply code which
+// cannot be expressed lane-wise, e.g., because it branches or looks up tabulated
+// values, to each lane separately.
+template <class Scalar, int width>
+Scalar getLane(const SimdValue<Scalar, width>& x, int laneIdx)
+{ return x[laneIdx]; }
+
+template <class Scalar, int width>
+void setLane(SimdValue<Scalar, width>& x, int laneIdx, Scalar laneValue)
+{ x[laneIdx] = laneValue; }
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+Evaluation<Scalar, numVars, staticSize>
+getLane(const Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x, int laneIdx)
+{
+    static_assert(numVars >= 0, "Only statically-sized evaluations can be packed");
+
+    Evaluation<Scalar, numVars, staticSize> result;
+    result.setValue(x.value()[laneIdx]);
+    for (int curVarIdx = 0; curVarIdx < result.size(); ++curVarIdx)
+        result.setDerivative(curVarIdx, x.derivative(curVarIdx)[laneIdx]);
+
+    return result;
+}
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+void setLane(Evaluation<SimdValue<Scalar, width>, numVars, staticSize>& x,
+             int laneIdx,
+             const Evaluation<Scalar, numVars, staticSize>& laneValue)
+{
+    static_assert(numVars >= 0, "Only statically-sized evaluations can be packed");
+
+    SimdValue<Scalar, width> tmp = x.value();
+    tmp[laneIdx] = laneValue.value();
+    x.setValue(tmp);
+    for (int curVarIdx = 0; curVarIdx < x.size(); ++curVarIdx) {
+        tmp = x.derivative(curVarIdx);
+        tmp[laneIdx] = laneValue.derivative(curVarIdx);
+        x.setDerivative(curVarIdx, tmp);
+    }
+}
+
+template <class T>
+struct SimdTraits_;
+
+template <class Scalar, int width>
+struct SimdTraits_<SimdValue<Scalar, width>>
+{
+    static constexpr int laneCount = width;
+};
+
+template <class Scalar, int width, int numVars, unsigned staticSize>
+struct SimdTraits_<Evaluation<SimdValue<Scalar, width>, numVars, staticSize>>
+{
+    static constexpr int laneCount = width;
+};
+
+template <class T, int width>
+struct PackedType_
+{
+    static_assert(std::is_floating_point<T>::value, "Only scalars and evaluations can be packed");
+    typedef SimdValue<T, width> type;
+};
+
+template <class Scalar, int numVars, unsigned staticSize, int width>
+struct PackedType_<Evaluation<Scalar, numVars, staticSize>, width>
+{
+    typedef Evaluation<SimdValue<Scalar, width>, numVars, staticSize> type;
+};
+
+/*!
+ * \brief Apply a function to each lane of some packed arguments.
+ *
+ * The function is called with the scalar values or evaluations of one lane of all
+ * arguments and the results are packed again, e.g.
+ *
+ * \code
+ * auto mu = applyLaneWise([&](const auto& T, const auto& p, const auto& Rs)
+ *                         { return pvt.viscosity(regionIdx, T, p, Rs); },
+ *                         T, p, Rs);
+ * \endcode
+ */
+template <class Fn, class Arg, class... Args>
+auto applyLaneWise(const Fn& fn, const Arg& arg, const Args&... args)
+{
+    constexpr int width = SimdTraits_<Arg>::laneCount;
+    static_assert(((SimdTraits_<Args>::laneCount == width) && ...),
+                  "All arguments must have the same number of lanes");
+
+    typedef typename std::decay<decltype(fn(getLane(arg, 0), getLane(args, 0)...))>::type LaneResult;
+    typename PackedType_<LaneResult, width>::type result;
+    for (int laneIdx = 0; laneIdx < width; ++laneIdx)
+        setLane(result, laneIdx, fn(getLane(arg, laneIdx), getLane(args, laneIdx)...));
+
+    return result;
+}
+
 } // namespace DenseAd
 
 // a kind of traits class for the automatic differentiation case. (The toolbox for the
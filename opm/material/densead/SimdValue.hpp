@@ -0,0 +1,376 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief A value type which packs the values of several independent
+ *        evaluation points, e.g. cells, into a single object.
+ *
+ * Using SimdValue as the value type of the dense-AD Evaluation class, i.e.,
+ * Evaluation<SimdValue<double, 4>, numVars>, computes the values and
+ * derivatives of four cells with each arithmetic operation. All operations
+ * act on each lane separately and are written as loops with a fixed trip
+ * count over aligned storage, which the compiler maps to vector
+ * instructions.
+ *
+ * Ordering comparisons are deliberately not provided because they do not
+ * have a meaningful result for several lanes at once. Code which branches
+ * on values thus does not compile for packed values. Such code can be
+ * applied lane by lane using applyLaneWise() from Math.hpp, or it can be
+ * rewritten in terms of the lane-wise masks and select().
+ */
+#ifndef OPM_DENSEAD_SIMD_VALUE_HPP
+#define OPM_DENSEAD_SIMD_VALUE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace Opm {
+namespace DenseAd {
+
+//! A mask which stores the result of a lane-wise comparison.
+template <int width>
+using SimdMask = std::array<bool, static_cast<std::size_t>(width)>;
+
+template <class ScalarT, int widthV>
+class alignas(sizeof(ScalarT)*widthV) SimdValue
+{
+    static_assert(std::is_floating_point<ScalarT>::value,
+                  "SimdValue expects floating point scalars");
+    static_assert(widthV > 0 && (widthV & (widthV - 1)) == 0,
+                  "The width of a SimdValue must be a power of two");
+
+public:
+    typedef ScalarT Scalar;
+
+    //! the number of lanes
+    static constexpr int width = widthV;
+
+    //! default constructor, all lanes are zero
+    SimdValue() = default;
+
+    //! broadcast a scalar to all lanes
+    SimdValue(Scalar value)
+    { data_.fill(value); }
+
+    //! create an object from the values of the individual lanes
+    explicit SimdValue(const std::array<Scalar, width>& values)
+        : data_(values)
+    {}
+
+    Scalar& operator[](int laneIdx)
+    { return data_[laneIdx]; }
+
+    const Scalar& operator[](int laneIdx) const
+    { return data_[laneIdx]; }
+
+    //! apply a function of one scalar to each lane
+    template <class Fn>
+    SimdValue transform(Fn fn) const
+    {
+        SimdValue result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = fn(data_[i]);
+        return result;
+    }
+
+    //! apply a function of two scalars to each pair of lanes
+    template <class Fn>
+    static SimdValue transform(const SimdValue& a, const SimdValue& b, Fn fn)
+    {
+        SimdValue result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = fn(a.data_[i], b.data_[i]);
+        return result;
+    }
+
+    SimdValue& operator+=(const SimdValue& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] += other.data_[i];
+        return *this;
+    }
+
+    SimdValue& operator-=(const SimdValue& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] -= other.data_[i];
+        return *this;
+    }
+
+    SimdValue& operator*=(const SimdValue& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] *= other.data_[i];
+        return *this;
+    }
+
+    SimdValue& operator/=(const SimdValue& other)
+    {
+        for (int i = 0; i < width; ++i)
+            data_[i] /= other.data_[i];
+        return *this;
+    }
+
+    SimdValue operator-() const
+    {
+        SimdValue result;
+        for (int i = 0; i < width; ++i)
+            result.data_[i] = -data_[i];
+        return result;
+    }
+
+    friend SimdValue operator+(const SimdValue& a, const SimdValue& b)
+    {
+        SimdValue result(a);
+        return result += b;
+    }
+
+    friend SimdValue operator-(const SimdValue& a, const SimdValue& b)
+    {
+        SimdValue result(a);
+        return result -= b;
+    }
+
+    friend SimdValue operator*(const SimdValue& a, const SimdValue& b)
+    {
+        SimdValue result(a);
+        return result *= b;
+    }
+
+    friend SimdValue operator/(const SimdValue& a, const SimdValue& b)
+    {
+        SimdValue result(a);
+        return result /= b;
+    }
+
+    //! true iff all lanes are equal
+    friend bool operator==(const SimdValue& a, const SimdValue& b)
+    {
+        bool result = true;
+        for (int i = 0; i < width; ++i)
+            result = result && a.data_[i] == b.data_[i];
+        return result;
+    }
+
+    friend bool operator!=(const SimdValue& a, const SimdValue& b)
+    { return !(a == b); }
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(data_);
+    }
+
+private:
+    std::array<Scalar, width> data_{};
+};
+
+// lane-wise comparisons
+template <class Scalar, int width>
+SimdMask<width> laneLess(const SimdValue<Scalar, width>& a, const SimdValue<Scalar, width>& b)
+{
+    SimdMask<width> result;
+    for (int i = 0; i < width; ++i)
+        result[i] = a[i] < b[i];
+    return result;
+}
+
+template <class Scalar, int width>
+SimdMask<width> laneGreater(const SimdValue<Scalar, width>& a, const SimdValue<Scalar, width>& b)
+{ return laneLess(b, a); }
+
+template <class Scalar, int width>
+SimdMask<width> laneEqual(const SimdValue<Scalar, width>& a, const SimdValue<Scalar, width>& b)
+{
+    SimdMask<width> result;
+    for (int i = 0; i < width; ++i)
+        result[i] = a[i] == b[i];
+    return result;
+}
+
+//! take the lanes of a where the mask is set and the ones of b elsewhere
+template <class Scalar, int width>
+SimdValue<Scalar, width> select(const SimdMask<width>& mask,
+                                const SimdValue<Scalar, width>& a,
+                                const SimdValue<Scalar, width>& b)
+{
+    SimdValue<Scalar, width> result;
+    for (int i = 0; i < width; ++i)
+        result[i] = mask[i] ? a[i] : b[i];
+    return result;
+}
+
+} // namespace DenseAd
+
+/*!
+ * \brief The math toolbox for packed values.
+ *
+ * All functions act lane-wise. Since the value objects do not carry any
+ * derivatives, the toolbox mirrors the one for plain floating point values.
+ * Note that scalarValue() returns the packed value because there is no
+ * single primitive value which represents all lanes.
+ */
+template <class ScalarT, int width>
+struct MathToolbox<DenseAd::SimdValue<ScalarT, width>>
+{
+public:
+    typedef ScalarT Scalar;
+    typedef DenseAd::SimdValue<ScalarT, width> ValueType;
+    typedef MathToolbox<ValueType> InnerToolbox;
+
+    static ValueType value(const ValueType& value)
+    { return value; }
+
+    static ValueType scalarValue(const ValueType& value)
+    { return value; }
+
+    static ValueType createBlank(const ValueType& /*value*/)
+    { return ValueType(); }
+
+    static ValueType createConstant(const ValueType& value)
+    { return value; }
+
+    static ValueType createConstant(unsigned numDerivatives, const ValueType& value)
+    {
+        if (numDerivatives != 0)
+            throw std::logic_error("Packed values cannot represent any derivatives");
+        return value;
+    }
+
+    static ValueType createConstant(const ValueType& /*x*/, const ValueType& value)
+    { return value; }
+
+    static ValueType createVariable(const ValueType& /*value*/, unsigned /*varIdx*/)
+    { throw std::logic_error("Packed values cannot represent variables"); }
+
+    static ValueType createVariable(const ValueType& /*x*/, const ValueType& /*value*/, unsigned /*varIdx*/)
+    { throw std::logic_error("Packed values cannot represent variables"); }
+
+    template <class LhsEval>
+    static LhsEval decay(const ValueType& value)
+    {
+        static_assert(std::is_same<LhsEval, ValueType>::value,
+                      "Packed values can only decay to themselves");
+
+        return value;
+    }
+
+    //! Returns true if all lanes are identical up to a specified tolerance
+    static bool isSame(const ValueType& a, const ValueType& b, Scalar tolerance)
+    {
+        bool result = true;
+        for (int i = 0; i < width; ++i)
+            result = result && MathToolbox<Scalar>::isSame(a[i], b[i], tolerance);
+        return result;
+    }
+
+    ////////////
+    // arithmetic functions
+    ////////////
+
+    static ValueType max(const ValueType& arg1, const ValueType& arg2)
+    { return ValueType::transform(arg1, arg2, [](Scalar a, Scalar b) { return std::max(a, b); }); }
+
+    static ValueType min(const ValueType& arg1, const ValueType& arg2)
+    { return ValueType::transform(arg1, arg2, [](Scalar a, Scalar b) { return std::min(a, b); }); }
+
+    static ValueType abs(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::abs(a); }); }
+
+    static ValueType tan(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::tan(a); }); }
+
+    static ValueType atan(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::atan(a); }); }
+
+    static ValueType atan2(const ValueType& arg1, const ValueType& arg2)
+    { return ValueType::transform(arg1, arg2, [](Scalar a, Scalar b) { return std::atan2(a, b); }); }
+
+    static ValueType sin(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::sin(a); }); }
+
+    static ValueType asin(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::asin(a); }); }
+
+    static ValueType sinh(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::sinh(a); }); }
+
+    static ValueType asinh(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::asinh(a); }); }
+
+    static ValueType cos(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::cos(a); }); }
+
+    static ValueType acos(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::acos(a); }); }
+
+    static ValueType cosh(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::cosh(a); }); }
+
+    static ValueType acosh(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::acosh(a); }); }
+
+    static ValueType sqrt(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::sqrt(a); }); }
+
+    static ValueType exp(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::exp(a); }); }
+
+    static ValueType log10(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::log10(a); }); }
+
+    static ValueType log(const ValueType& arg)
+    { return arg.transform([](Scalar a) { return std::log(a); }); }
+
+    static ValueType pow(const ValueType& base, const ValueType& exp)
+    { return ValueType::transform(base, exp, [](Scalar a, Scalar b) { return std::pow(a, b); }); }
+
+    //! Return true iff all lanes are finite values
+    static bool isfinite(const ValueType& arg)
+    {
+        bool result = true;
+        for (int i = 0; i < width; ++i)
+            result = result && std::isfinite(arg[i]);
+        return result;
+    }
+
+    //! Return true iff any lane is a NaN value
+    static bool isnan(const ValueType& arg)
+    {
+        bool result = false;
+        for (int i = 0; i < width; ++i)
+            result = result || std::isnan(arg[i]);
+        return result;
+    }
+};
+
+} // namespace Opm
+
+#endif
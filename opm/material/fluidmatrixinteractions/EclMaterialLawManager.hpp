@@ -41,6 +41,7 @@
 #include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
 #include <opm/material/fluidmatrixinteractions/DirectionalMaterialLawParams.hpp>
 
+#include <array>
 #include <cassert>
 #include <memory>
 #include <tuple>
@@ -125,12 +126,80 @@ private:
     using GasOilScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
     using OilWaterScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
     using GasWaterScalingPointsVector = std::vector<std::shared_ptr<EclEpsScalingPoints<Scalar>>>;
-    using OilWaterScalingInfoVector = std::vector<EclEpsScalingPointsInfo<Scalar>>;
     using GasOilParamVector = std::vector<std::shared_ptr<GasOilTwoPhaseHystParams>>;
     using OilWaterParamVector = std::vector<std::shared_ptr<OilWaterTwoPhaseHystParams>>;
     using GasWaterParamVector = std::vector<std::shared_ptr<GasWaterTwoPhaseHystParams>>;
     using MaterialLawParamsVector = std::vector<std::shared_ptr<MaterialLawParams>>;
 
+    // Array of parameter objects which the material law parameters refer
+    // to through non-owning pointers.  It offers no way to grow or shrink,
+    // the elements only move when the whole array is replaced by
+    // allocate(), which happens while initParamsForElements() rebuilds all
+    // parameters referring to it.
+    template <class Params>
+    class ParamStorage {
+    public:
+        void allocate(std::size_t size)
+        {
+            data_ = size > 0 ? std::make_unique<Params[]>(size) : nullptr;
+            size_ = size;
+        }
+
+        std::size_t size() const { return size_; }
+        bool empty() const { return size_ == 0; }
+
+        Params& operator[](std::size_t idx)
+        {
+            assert(idx < size_);
+            return data_[idx];
+        }
+
+    private:
+        std::unique_ptr<Params[]> data_;
+        std::size_t size_ = 0;
+    };
+
+    // Scaled end points of all cells, stored as one array per end point
+    // rather than one EclEpsScalingPointsInfo object per cell.
+    class ScaledEpsInfoArrays {
+    public:
+        using Info = EclEpsScalingPointsInfo<Scalar>;
+
+        void resize(std::size_t size)
+        {
+            for (auto& values : values_) {
+                values.resize(size);
+            }
+        }
+
+        Info get(std::size_t idx) const
+        {
+            Info info;
+            for (std::size_t i = 0; i < fields_.size(); ++i) {
+                info.*fields_[i] = values_[i][idx];
+            }
+            return info;
+        }
+
+        void set(std::size_t idx, const Info& info)
+        {
+            for (std::size_t i = 0; i < fields_.size(); ++i) {
+                values_[i][idx] = info.*fields_[i];
+            }
+        }
+
+    private:
+        static constexpr std::array<Scalar Info::*, 20> fields_ {
+            &Info::Swl, &Info::Sgl, &Info::Swcr, &Info::Sgcr, &Info::Sowcr,
+            &Info::Sogcr, &Info::Swu, &Info::Sgu, &Info::maxPcow, &Info::maxPcgo,
+            &Info::pcowLeverettFactor, &Info::pcgoLeverettFactor, &Info::Krwr,
+            &Info::Krgr, &Info::Krorw, &Info::Krorg, &Info::maxKrw, &Info::maxKrow,
+            &Info::maxKrog, &Info::maxKrg,
+        };
+
+        std::array<std::vector<Scalar>, fields_.size()> values_;
+    };
+
     // helper classes
 
     // This class' implementation is defined in "EclMaterialLawManagerInitParams.cpp"
@@ -149,9 +218,11 @@ private:
             std::vector<std::vector<MaterialLawParams>*>& mlpArray);
         void initMaterialLawParamVectors_();
         void initOilWaterScaledEpsInfo_();
+        void initParamStorage_(std::size_t numArrays);
         void initSatnumRegionArray_();
         void initThreePhaseParams_(
             HystParams &hystParams,
+            std::size_t paramIdx,
             MaterialLawParams& materialParams,
             unsigned satRegionIdx,
             unsigned elemIdx);
@@ -165,7 +236,7 @@ private:
         // This class' implementation is defined in "EclMaterialLawManagerHystParams.cpp"
         class HystParams {
         public:
-            HystParams(EclMaterialLawManager<TraitsT>::InitParams& init_params);
+            HystParams(EclMaterialLawManager<TraitsT>::InitParams& init_params, std::size_t paramIdx);
             void finalize();
             std::shared_ptr<GasOilTwoPhaseHystParams> getGasOilParams();
             std::shared_ptr<OilWaterTwoPhaseHystParams> getOilWaterParams();
@@ -191,9 +262,9 @@ private:
             EclMaterialLawManager<TraitsT>::InitParams& init_params_;
             EclMaterialLawManager<TraitsT>& parent_;
             const EclipseState& eclState_;
-            std::shared_ptr<GasOilTwoPhaseHystParams> gasOilParams_;
-            std::shared_ptr<OilWaterTwoPhaseHystParams> oilWaterParams_;
-            std::shared_ptr<GasWaterTwoPhaseHystParams> gasWaterParams_;
+            GasOilTwoPhaseHystParams* gasOilParams_;
+            OilWaterTwoPhaseHystParams* oilWaterParams_;
+            GasWaterTwoPhaseHystParams* gasWaterParams_;
         };
 
         // This class' implementation is defined in "EclMaterialLawManagerReadEffectiveParams.cpp"
@@ -235,7 +306,6 @@ private:
 
         std::unique_ptr<EclEpsGridProperties> epsImbGridProperties_; //imbibition
         std::unique_ptr<EclEpsGridProperties> epsGridProperties_;    // drainage
-
     };  // end of "class InitParams"
 
 public:
@@ -297,6 +367,42 @@ public:
         return const_cast<MaterialLawParams&>(materialLawParamsFunc_(elemIdx, facedir));
     }
 
+    /*!
+     * \brief Capillary pressures of several elements in one call.
+     *
+     * saturations holds numPhases saturations for each entry of elements,
+     * values is resized to hold numPhases capillary pressures for each entry.
+     */
+    template <class Evaluation>
+    void capillaryPressures(const std::vector<unsigned>& elements,
+                            const std::vector<Evaluation>& saturations,
+                            std::vector<Evaluation>& values) const
+    {
+        assert(saturations.size() == elements.size() * numPhases);
+        values.resize(saturations.size());
+        MaterialLaw::capillaryPressures(values.data(), saturations.data(), elements.size(),
+                                        [this, &elements](std::size_t i) -> const MaterialLawParams&
+                                        { return materialLawParams_[elements[i]]; });
+    }
+
+    /*!
+     * \brief Relative permeabilities of several elements in one call.
+     *
+     * saturations holds numPhases saturations for each entry of elements,
+     * values is resized to hold numPhases relative permeabilities for each entry.
+     */
+    template <class Evaluation>
+    void relativePermeabilities(const std::vector<unsigned>& elements,
+                                const std::vector<Evaluation>& saturations,
+                                std::vector<Evaluation>& values) const
+    {
+        assert(saturations.size() == elements.size() * numPhases);
+        values.resize(saturations.size());
+        MaterialLaw::relativePermeabilities(values.data(), saturations.data(), elements.size(),
+                                            [this, &elements](std::size_t i) -> const MaterialLawParams&
+                                            { return materialLawParams_[elements[i]]; });
+    }
+
     /*!
      * \brief Returns a material parameter object for a given element and saturation region.
      *
@@ -364,8 +470,8 @@ public:
 
     EclEpsScalingPoints<Scalar>& oilWaterScaledEpsPointsDrainage(unsigned elemIdx);
 
-    const EclEpsScalingPointsInfo<Scalar>& oilWaterScaledEpsInfoDrainage(size_t elemIdx) const
-    { return oilWaterScaledEpsInfoDrainage_[elemIdx]; }
+    EclEpsScalingPointsInfo<Scalar> oilWaterScaledEpsInfoDrainage(size_t elemIdx) const
+    { return oilWaterScaledEpsInfoDrainage_.get(elemIdx); }
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
@@ -395,7 +501,7 @@ private:
 
     std::shared_ptr<EclEpsConfig> oilWaterEclEpsConfig_;
     std::vector<EclEpsScalingPointsInfo<Scalar>> unscaledEpsInfo_;
-    OilWaterScalingInfoVector oilWaterScaledEpsInfoDrainage_;
+    ScaledEpsInfoArrays oilWaterScaledEpsInfoDrainage_;
 
     std::shared_ptr<EclEpsConfig> gasWaterEclEpsConfig_;
 
@@ -414,6 +520,22 @@ private:
     std::vector<MaterialLawParams> materialLawParams_;
     DirectionalMaterialLawParamsPtr dirMaterialLawParams_;
 
+    // Parameters of all cells which materialLawParams_ and the X, Y and Z
+    // directional parameters refer to. Entry i * numElems + elemIdx belongs
+    // to materialLawParams_ (i = 0) or the directional parameters
+    // (i = 1, 2, 3). Only the array of the selected three-phase approach is
+    // allocated. The two-phase parameters hold the scaled end points and
+    // the hysteresis state; a phase pair which is not simulated has a
+    // single shared entry. The unscaled curves and the effective laws are
+    // shared per saturation region.
+    ParamStorage<typename MaterialLawParams::Stone1Params> stone1ParamStorage_;
+    ParamStorage<typename MaterialLawParams::Stone2Params> stone2ParamStorage_;
+    ParamStorage<typename MaterialLawParams::DefaultParams> defaultParamStorage_;
+    ParamStorage<typename MaterialLawParams::TwoPhaseParams> twoPhaseParamStorage_;
+    ParamStorage<GasOilTwoPhaseHystParams> gasOilParamStorage_;
+    ParamStorage<OilWaterTwoPhaseHystParams> oilWaterParamStorage_;
+    ParamStorage<GasWaterTwoPhaseHystParams> gasWaterParamStorage_;
+
     std::vector<int> satnumRegionArray_;
     std::vector<int> krnumXArray_;
     std::vector<int> krnumYArray_;
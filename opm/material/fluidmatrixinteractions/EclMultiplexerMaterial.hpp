@@ -36,7 +36,9 @@
 #include <opm/common/TimingMacros.hpp>
 
 #include <algorithm>
+#include <cstddef>
 #include <stdexcept>
+#include <string>
 
 namespace Opm {
 
@@ -601,6 +603,125 @@ public:
         }
         return false;
     }
+
+    /*!
+     * \brief The capillary pressures of a batch of cells.
+     *
+     * The saturations of cell i are saturations[i*numPhases + phaseIdx], its
+     * parameters are params(i) and its capillary pressures are written to
+     * values[i*numPhases + phaseIdx]. The approach is selected once for each
+     * run of consecutive cells which use the same approach, not once per cell.
+     */
+    template <class Evaluation, class ParamsAccess>
+    static void capillaryPressures(Evaluation* values,
+                                   const Evaluation* saturations,
+                                   std::size_t numCells,
+                                   const ParamsAccess& params)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        applyBatch_(numCells, params,
+                    [values, saturations](auto material, const auto& realParams, std::size_t cellIdx)
+                    {
+                        using Material = typename decltype(material)::type;
+                        Evaluation* cellValues = values + cellIdx*numPhases;
+                        Material::capillaryPressures(cellValues, realParams,
+                                                     BatchFluidState_<Evaluation>{saturations + cellIdx*numPhases});
+                    },
+                    [values](std::size_t cellIdx) { values[cellIdx*numPhases] = 0.0; });
+    }
+
+    /*!
+     * \brief The relative permeabilities of a batch of cells.
+     *
+     * Same layout of the arguments as the batched capillaryPressures().
+     */
+    template <class Evaluation, class ParamsAccess>
+    static void relativePermeabilities(Evaluation* values,
+                                       const Evaluation* saturations,
+                                       std::size_t numCells,
+                                       const ParamsAccess& params)
+    {
+        OPM_TIMEFUNCTION_LOCAL();
+        applyBatch_(numCells, params,
+                    [values, saturations](auto material, const auto& realParams, std::size_t cellIdx)
+                    {
+                        using Material = typename decltype(material)::type;
+                        Evaluation* cellValues = values + cellIdx*numPhases;
+                        Material::relativePermeabilities(cellValues, realParams,
+                                                         BatchFluidState_<Evaluation>{saturations + cellIdx*numPhases});
+                    },
+                    [values](std::size_t cellIdx) { values[cellIdx*numPhases] = 1.0; });
+    }
+
+private:
+    template <class MaterialT>
+    struct MaterialTag_
+    { using type = MaterialT; };
+
+    // The saturations of one cell of a batch, the only part of the fluid
+    // state used by the material laws.
+    template <class Evaluation>
+    struct BatchFluidState_
+    {
+        using Scalar = Evaluation;
+
+        const Evaluation& saturation(unsigned phaseIdx) const
+        { return saturations[phaseIdx]; }
+
+        const Evaluation* saturations;
+    };
+
+    template <class ParamsAccess, class Op, class OnePhaseOp>
+    static void applyBatch_(std::size_t numCells,
+                            const ParamsAccess& params,
+                            const Op& op,
+                            const OnePhaseOp& onePhaseOp)
+    {
+        std::size_t begin = 0;
+        while (begin < numCells) {
+            const auto approach = params(begin).approach();
+            std::size_t end = begin + 1;
+            while (end < numCells && params(end).approach() == approach)
+                ++end;
+
+            switch (approach) {
+            case EclMultiplexerApproach::Stone1:
+                for (std::size_t cellIdx = begin; cellIdx < end; ++cellIdx)
+                    op(MaterialTag_<Stone1Material>{},
+                       params(cellIdx).template getRealParams<EclMultiplexerApproach::Stone1>(), cellIdx);
+                break;
+
+            case EclMultiplexerApproach::Stone2:
+                for (std::size_t cellIdx = begin; cellIdx < end; ++cellIdx)
+                    op(MaterialTag_<Stone2Material>{},
+                       params(cellIdx).template getRealParams<EclMultiplexerApproach::Stone2>(), cellIdx);
+                break;
+
+            case EclMultiplexerApproach::Default:
+                for (std::size_t cellIdx = begin; cellIdx < end; ++cellIdx)
+                    op(MaterialTag_<DefaultMaterial>{},
+                       params(cellIdx).template getRealParams<EclMultiplexerApproach::Default>(), cellIdx);
+                break;
+
+            case EclMultiplexerApproach::TwoPhase:
+                for (std::size_t cellIdx = begin; cellIdx < end; ++cellIdx)
+                    op(MaterialTag_<TwoPhaseMaterial>{},
+                       params(cellIdx).template getRealParams<EclMultiplexerApproach::TwoPhase>(), cellIdx);
+                break;
+
+            case EclMultiplexerApproach::OnePhase:
+                for (std::size_t cellIdx = begin; cellIdx < end; ++cellIdx)
+                    onePhaseOp(cellIdx);
+                break;
+
+            default:
+                throw std::logic_error("Not implemented: batched evaluation for unknown EclMultiplexerApproach (="
+                                       + std::to_string(static_cast<int>(approach)) + ")");
+            }
+
+            begin = end;
+        }
+    }
 };
 
 } // namespace Opm
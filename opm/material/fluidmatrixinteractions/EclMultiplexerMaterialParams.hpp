@@ -66,71 +66,92 @@ class EclMultiplexerMaterialParams : public Traits, public EnsureFinalized
     using DefaultMaterial = EclDefaultMaterial<Traits, GasOilMaterialLawT, OilWaterMaterialLawT>;
     using TwoPhaseMaterial = EclTwoPhaseMaterial<Traits, GasOilMaterialLawT, OilWaterMaterialLawT, GasWaterMaterialLawT>;
 
+public:
     using Stone1Params = typename Stone1Material::Params;
     using Stone2Params = typename Stone2Material::Params;
     using DefaultParams = typename DefaultMaterial::Params;
     using TwoPhaseParams = typename TwoPhaseMaterial::Params;
 
-    template <class ParamT>
-    struct Deleter
-    {
-        inline void operator () ( void* ptr )
-        {
-            delete static_cast< ParamT* > (ptr);
-        }
-    };
-
-    using ParamPointerType = std::shared_ptr<void>;
-
-public:
     using EnsureFinalized :: finalize;
 
     /*!
      * \brief The multiplexer constructor.
      */
-    EclMultiplexerMaterialParams() : realParams_()
+    EclMultiplexerMaterialParams()
     {
     }
 
     EclMultiplexerMaterialParams(const EclMultiplexerMaterialParams& other)
-        : realParams_()
     {
         setApproach( other.approach() );
     }
 
     EclMultiplexerMaterialParams& operator= ( const EclMultiplexerMaterialParams& other )
     {
-        realParams_.reset();
+        realParams_ = nullptr;
+        ownedParams_.reset();
         setApproach( other.approach() );
         return *this;
     }
 
+    /*!
+     * \brief Select the approach and allocate a parameter object for it.
+     */
     void setApproach(EclMultiplexerApproach newApproach)
     {
-        assert(realParams_ == 0);
+        assert(realParams_ == nullptr);
         approach_ = newApproach;
 
         switch (approach()) {
         case EclMultiplexerApproach::Stone1:
-            realParams_ = ParamPointerType(new Stone1Params, Deleter< Stone1Params > () );
+            ownedParams_ = std::make_shared<Stone1Params>();
             break;
 
         case EclMultiplexerApproach::Stone2:
-            realParams_ = ParamPointerType(new Stone2Params, Deleter< Stone2Params > () );
+            ownedParams_ = std::make_shared<Stone2Params>();
             break;
 
         case EclMultiplexerApproach::Default:
-            realParams_ = ParamPointerType(new DefaultParams, Deleter< DefaultParams > () );
+            ownedParams_ = std::make_shared<DefaultParams>();
             break;
 
         case EclMultiplexerApproach::TwoPhase:
-            realParams_ = ParamPointerType(new TwoPhaseParams, Deleter< TwoPhaseParams > () );
+            ownedParams_ = std::make_shared<TwoPhaseParams>();
             break;
 
         case EclMultiplexerApproach::OnePhase:
             // Do nothing, no parameters.
             break;
         }
+
+        realParams_ = ownedParams_.get();
+    }
+
+    /*!
+     * \brief Select the approach and use a parameter object owned by the
+     *        caller.
+     *
+     * This avoids one allocation per object when the parameters of many
+     * cells are kept in a single array. The caller must keep the parameter
+     * object alive and in place for as long as it is used through this
+     * object; copies of this object allocate their own parameters.
+     */
+    template <class ParamT>
+    void setApproach(EclMultiplexerApproach newApproach, ParamT& realParams)
+    {
+        static_assert(std::is_same_v<ParamT, Stone1Params> ||
+                      std::is_same_v<ParamT, Stone2Params> ||
+                      std::is_same_v<ParamT, DefaultParams> ||
+                      std::is_same_v<ParamT, TwoPhaseParams>,
+                      "Not a parameter object of a multiplexed material law");
+        assert(realParams_ == nullptr);
+        assert((std::is_same_v<ParamT, Stone1Params> && newApproach == EclMultiplexerApproach::Stone1) ||
+               (std::is_same_v<ParamT, Stone2Params> && newApproach == EclMultiplexerApproach::Stone2) ||
+               (std::is_same_v<ParamT, DefaultParams> && newApproach == EclMultiplexerApproach::Default) ||
+               (std::is_same_v<ParamT, TwoPhaseParams> && newApproach == EclMultiplexerApproach::TwoPhase));
+
+        approach_ = newApproach;
+        realParams_ = &realParams;
     }
 
     EclMultiplexerApproach approach() const
@@ -234,17 +255,20 @@ private:
     template <class ParamT>
     ParamT& castTo()
     {
-        return *(static_cast<ParamT *> (realParams_.operator->()));
+        return *(static_cast<ParamT *> (realParams_));
     }
 
     template <class ParamT>
     const ParamT& castTo() const
     {
-        return *(static_cast<const ParamT *> (realParams_.operator->()));
+        return *(static_cast<const ParamT *> (realParams_));
     }
 
     EclMultiplexerApproach approach_;
-    ParamPointerType realParams_;
+    // The parameters of the selected approach, either owned by this
+    // object (ownedParams_) or by the caller of setApproach().
+    void* realParams_ = nullptr;
+    std::shared_ptr<void> ownedParams_;
 };
 } // namespace Opm
 
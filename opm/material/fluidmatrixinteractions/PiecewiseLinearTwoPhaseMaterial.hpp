@@ -326,14 +326,13 @@ private:
         else if (x <= xValues.front())
             return 0;
 
-        // bisection
-        size_t lowIdx = 0, highIdx = n;
-        while (lowIdx + 1 < highIdx) {
-            size_t curIdx = (lowIdx + highIdx)/2;
-            if (xValues[curIdx] < x)
-                lowIdx = curIdx;
-            else
-                highIdx = curIdx;
+        // bisection without data dependent branches, the compiler emits a
+        // conditional move instead of a hard to predict jump.
+        size_t lowIdx = 0, len = n;
+        while (len > 1) {
+            const size_t half = len/2;
+            lowIdx = (xValues[lowIdx + half] < x) ? lowIdx + half : lowIdx;
+            len -= half;
         }
 
         return lowIdx;
@@ -349,14 +348,13 @@ private:
         else if (xValues.front() <= x)
             return 0;
 
-        // bisection
-        size_t lowIdx = 0, highIdx = n;
-        while (lowIdx + 1 < highIdx) {
-            size_t curIdx = (lowIdx + highIdx)/2;
-            if (xValues[curIdx] >= x)
-                lowIdx = curIdx;
-            else
-                highIdx = curIdx;
+        // bisection without data dependent branches, the compiler emits a
+        // conditional move instead of a hard to predict jump.
+        size_t lowIdx = 0, len = n;
+        while (len > 1) {
+            const size_t half = len/2;
+            lowIdx = (xValues[lowIdx + half] >= x) ? lowIdx + half : lowIdx;
+            len -= half;
         }
 
         return lowIdx;
@@ -0,0 +1,80 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::BlackOilFluidSystemNonStatic
+ */
+#ifndef OPM_BLACK_OIL_FLUID_SYSTEM_NONSTATIC_HPP
+#define OPM_BLACK_OIL_FLUID_SYSTEM_NONSTATIC_HPP
+
+#include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+
+#define FLUIDSYSTEM_CLASSNAME BlackOilFluidSystemNonStatic
+#define STATIC_OR_NOTHING
+#define CONST_OR_NOTHING const
+#define FLUIDSYSTEM_IS_STATIC 0
+#include <opm/material/fluidsystems/BlackOilFluidSystem_macrotemplate.hpp>
+#undef FLUIDSYSTEM_CLASSNAME
+#undef STATIC_OR_NOTHING
+#undef CONST_OR_NOTHING
+#undef FLUIDSYSTEM_IS_STATIC
+
+namespace Opm {
+
+template <class Scalar, class IndexTraits, class GasPvtT, class OilPvtT, class WaterPvtT>
+BlackOilFluidSystemNonStatic<Scalar, IndexTraits, GasPvtT, OilPvtT, WaterPvtT>
+BlackOilFluidSystem<Scalar, IndexTraits, GasPvtT, OilPvtT, WaterPvtT>::getNonStaticInstance()
+{
+    NonStaticType result;
+
+    result.surfacePressure = surfacePressure;
+    result.surfaceTemperature = surfaceTemperature;
+    result.numActivePhases_ = numActivePhases_;
+    result.phaseIsActive_ = phaseIsActive_;
+    result.reservoirTemperature_ = reservoirTemperature_;
+
+    result.gasPvt_ = gasPvt_;
+    result.oilPvt_ = oilPvt_;
+    result.waterPvt_ = waterPvt_;
+
+    result.enableDissolvedGas_ = enableDissolvedGas_;
+    result.enableDissolvedGasInWater_ = enableDissolvedGasInWater_;
+    result.enableVaporizedOil_ = enableVaporizedOil_;
+    result.enableVaporizedWater_ = enableVaporizedWater_;
+    result.enableDiffusion_ = enableDiffusion_;
+
+    result.referenceDensity_ = referenceDensity_;
+    result.molarMass_ = molarMass_;
+    result.diffusionCoefficients_ = diffusionCoefficients_;
+
+    result.activeToCanonicalPhaseIdx_ = activeToCanonicalPhaseIdx_;
+    result.canonicalToActivePhaseIdx_ = canonicalToActivePhaseIdx_;
+
+    result.isInitialized_ = isInitialized_;
+
+    return result;
+}
+
+} // namespace Opm
+
+#endif
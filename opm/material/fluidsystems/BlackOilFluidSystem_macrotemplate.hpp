@@ -0,0 +1,1492 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Definition of the black-oil fluid system classes.
+ *
+ * This file is included by BlackOilFluidSystem.hpp and BlackOilFluidSystemNonStatic.hpp
+ * and must not be included directly. The including file defines the macros
+ *
+ * - FLUIDSYSTEM_CLASSNAME: the name of the class to define,
+ * - STATIC_OR_NOTHING: 'static' for the static fluid system, empty otherwise,
+ * - CONST_OR_NOTHING: empty for the static fluid system, 'const' otherwise,
+ * - FLUIDSYSTEM_IS_STATIC: 1 for the static fluid system, 0 otherwise.
+ *
+ * There is deliberately no include guard.
+ */
+
+namespace Opm {
+
+/*!
+ * \brief A fluid system which uses the black-oil model assumptions to calculate
+ *        termodynamically meaningful quantities.
+ *
+ * By default, the PVT relations of each phase are provided by a multiplexer which
+ * selects the concrete approach at runtime. If the approach is known at compile time,
+ * the concrete PVT classes can be used instead, which allows the compiler to inline
+ * the table lookups. initFromState() then requires the deck to select the same
+ * approaches.
+ *
+ * The class is generated twice from this file: BlackOilFluidSystem keeps its state in
+ * static members and is used through its static methods, while
+ * BlackOilFluidSystemNonStatic keeps the same state in regular members, so that
+ * independent fluid systems can be used at the same time, e.g., on different threads.
+ * Copies of a BlackOilFluidSystemNonStatic object share the PVT objects. The fluid
+ * states used with BlackOilFluidSystemNonStatic must store the temperature and the
+ * dissolution factors, because the fallbacks for other fluid states call the fluid
+ * system statically.
+ *
+ * \tparam Scalar The type used for scalar floating point values
+ * \tparam GasPvtT The class which provides the PVT relations of the gas phase
+ * \tparam OilPvtT The class which provides the PVT relations of the oil phase
+ * \tparam WaterPvtT The class which provides the PVT relations of the water phase
+ */
+template <class Scalar,
+          class IndexTraits = BlackOilDefaultIndexTraits,
+          class GasPvtT = GasPvtMultiplexer<Scalar>,
+          class OilPvtT = OilPvtMultiplexer<Scalar>,
+          class WaterPvtT = WaterPvtMultiplexer<Scalar>>
+class FLUIDSYSTEM_CLASSNAME
+    : public BaseFluidSystem<Scalar, FLUIDSYSTEM_CLASSNAME<Scalar, IndexTraits, GasPvtT, OilPvtT, WaterPvtT> >
+{
+    using ThisType = FLUIDSYSTEM_CLASSNAME;
+
+public:
+    using GasPvt = GasPvtT;
+    using OilPvt = OilPvtT;
+    using WaterPvt = WaterPvtT;
+
+#if FLUIDSYSTEM_IS_STATIC
+    using NonStaticType = BlackOilFluidSystemNonStatic<Scalar, IndexTraits, GasPvtT, OilPvtT, WaterPvtT>;
+
+    /*!
+     * \brief Returns a fluid system object with a copy of the current state.
+     *
+     * The PVT objects are shared with the static fluid system. This method is
+     * defined in BlackOilFluidSystemNonStatic.hpp.
+     */
+    static NonStaticType getNonStaticInstance();
+#else
+    FLUIDSYSTEM_CLASSNAME()
+        : surfacePressure(0.0)
+        , surfaceTemperature(0.0)
+        , numActivePhases_(0)
+        , phaseIsActive_{}
+        , reservoirTemperature_(0.0)
+        , enableDissolvedGas_(false)
+        , enableDissolvedGasInWater_(false)
+        , enableVaporizedOil_(false)
+        , enableVaporizedWater_(false)
+        , enableDiffusion_(false)
+        , activeToCanonicalPhaseIdx_{}
+        , canonicalToActivePhaseIdx_{}
+        , isInitialized_(false)
+    {}
+#endif
+
+    //! \copydoc BaseFluidSystem::ParameterCache
+    template <class EvaluationT>
+    struct ParameterCache : public NullParameterCache<EvaluationT>
+    {
+        using Evaluation = EvaluationT;
+
+    public:
+        ParameterCache(Scalar maxOilSat = 1.0, unsigned regionIdx=0)
+        {
+            maxOilSat_ = maxOilSat;
+            regionIdx_ = regionIdx;
+        }
+
+        /*!
+         * \brief Copy the data which is not dependent on the type of the Scalars from
+         *        another parameter cache.
+         *
+         * For the black-oil parameter cache this means that the region index must be
+         * copied.
+         */
+        template <class OtherCache>
+        void assignPersistentData(const OtherCache& other)
+        {
+            regionIdx_ = other.regionIndex();
+            maxOilSat_ = other.maxOilSat();
+        }
+
+        /*!
+         * \brief Return the index of the region which should be used to determine the
+         *        thermodynamic properties
+         *
+         * This is only required because "oil" and "gas" are pseudo-components, i.e. for
+         * more comprehensive equations of state there would only be one "region".
+         */
+        unsigned regionIndex() const
+        { return regionIdx_; }
+
+        /*!
+         * \brief Set the index of the region which should be used to determine the
+         *        thermodynamic properties
+         *
+         * This is only required because "oil" and "gas" are pseudo-components, i.e. for
+         * more comprehensive equations of state there would only be one "region".
+         */
+        void setRegionIndex(unsigned val)
+        { regionIdx_ = val; }
+
+        const Evaluation& maxOilSat() const
+        { return maxOilSat_; }
+
+        void setMaxOilSat(const Evaluation& val)
+        { maxOilSat_ = val; }
+
+    private:
+        Evaluation maxOilSat_;
+        unsigned regionIdx_;
+    };
+
+    /****************************************
+     * Initialization
+     ****************************************/
+#if HAVE_ECL_INPUT
+    /*!
+     * \brief Initialize the fluid system using an ECL deck object
+     */
+    STATIC_OR_NOTHING void initFromState(const EclipseState& eclState, const Schedule& schedule);
+#endif // HAVE_ECL_INPUT
+
+    /*!
+     * \brief Begin the initialization of the black oil fluid system.
+     *
+     * After calling this method the reference densities, all dissolution and formation
+     * volume factors, the oil bubble pressure, all viscosities and the water
+     * compressibility must be set. Before the fluid system can be used, initEnd() must
+     * be called to finalize the initialization.
+     */
+    STATIC_OR_NOTHING void initBegin(std::size_t numPvtRegions);
+
+    /*!
+     * \brief Specify whether the fluid system should consider that the gas component can
+     *        dissolve in the oil phase
+     *
+     * By default, dissolved gas is considered.
+     */
+    STATIC_OR_NOTHING void setEnableDissolvedGas(bool yesno)
+    { enableDissolvedGas_ = yesno; }
+
+    /*!
+     * \brief Specify whether the fluid system should consider that the oil component can
+     *        dissolve in the gas phase
+     *
+     * By default, vaporized oil is not considered.
+     */
+    STATIC_OR_NOTHING void setEnableVaporizedOil(bool yesno)
+    { enableVaporizedOil_ = yesno; }
+
+     /*!
+     * \brief Specify whether the fluid system should consider that the water component can
+     *        dissolve in the gas phase
+     *
+     * By default, vaporized water is not considered.
+     */
+    STATIC_OR_NOTHING void setEnableVaporizedWater(bool yesno)
+    { enableVaporizedWater_ = yesno; }
+
+     /*!
+     * \brief Specify whether the fluid system should consider that the gas component can
+     *        dissolve in the water phase
+     *
+     * By default, dissovled gas in water is not considered.
+     */
+    STATIC_OR_NOTHING void setEnableDissolvedGasInWater(bool yesno)
+    { enableDissolvedGasInWater_ = yesno; }
+    /*!
+     * \brief Specify whether the fluid system should consider diffusion
+     *
+     * By default, diffusion is not considered.
+     */
+    STATIC_OR_NOTHING void setEnableDiffusion(bool yesno)
+    { enableDiffusion_ = yesno; }
+
+
+    /*!
+     * \brief Set the pressure-volume-saturation (PVT) relations for the gas phase.
+     */
+    STATIC_OR_NOTHING void setGasPvt(std::shared_ptr<GasPvt> pvtObj)
+    { gasPvt_ = pvtObj; }
+
+    /*!
+     * \brief Set the pressure-volume-saturation (PVT) relations for the oil phase.
+     */
+    STATIC_OR_NOTHING void setOilPvt(std::shared_ptr<OilPvt> pvtObj)
+    { oilPvt_ = pvtObj; }
+
+    /*!
+     * \brief Set the pressure-volume-saturation (PVT) relations for the water phase.
+     */
+    STATIC_OR_NOTHING void setWaterPvt(std::shared_ptr<WaterPvt> pvtObj)
+    { waterPvt_ = pvtObj; }
+
+    STATIC_OR_NOTHING void setVapPars(const Scalar par1, const Scalar par2)
+    {
+        if (gasPvt_) {
+            gasPvt_->setVapPars(par1, par2);
+        }
+        if (oilPvt_) {
+            oilPvt_->setVapPars(par1, par2);
+        }
+        if (waterPvt_) {
+            waterPvt_->setVapPars(par1, par2);
+        }
+    }
+
+    /*!
+     * \brief Initialize the values of the reference densities
+     *
+     * \param rhoOil The reference density of (gas saturated) oil phase.
+     * \param rhoWater The reference density of the water phase.
+     * \param rhoGas The reference density of the gas phase.
+     */
+    STATIC_OR_NOTHING void setReferenceDensities(Scalar rhoOil,
+                                      Scalar rhoWater,
+                                      Scalar rhoGas,
+                                      unsigned regionIdx);
+
+    /*!
+     * \brief Finish initializing the black oil fluid system.
+     */
+    STATIC_OR_NOTHING void initEnd();
+
+    STATIC_OR_NOTHING bool isInitialized() CONST_OR_NOTHING
+    { return isInitialized_; }
+
+    /****************************************
+     * Generic phase properties
+     ****************************************/
+
+    //! \copydoc BaseFluidSystem::numPhases
+    static constexpr unsigned numPhases = 3;
+
+    //! Index of the water phase
+    static constexpr unsigned waterPhaseIdx = IndexTraits::waterPhaseIdx;
+    //! Index of the oil phase
+    static constexpr unsigned oilPhaseIdx = IndexTraits::oilPhaseIdx;
+    //! Index of the gas phase
+    static constexpr unsigned gasPhaseIdx = IndexTraits::gasPhaseIdx;
+
+    //! The pressure at the surface
+    STATIC_OR_NOTHING Scalar surfacePressure;
+
+    //! The temperature at the surface
+    STATIC_OR_NOTHING Scalar surfaceTemperature;
+
+    //! \copydoc BaseFluidSystem::phaseName
+    STATIC_OR_NOTHING const char* phaseName(unsigned phaseIdx) CONST_OR_NOTHING;
+
+    //! \copydoc BaseFluidSystem::isLiquid
+    STATIC_OR_NOTHING bool isLiquid(unsigned phaseIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx < numPhases);
+        return phaseIdx != gasPhaseIdx;
+    }
+
+    /****************************************
+     * Generic component related properties
+     ****************************************/
+
+    //! \copydoc BaseFluidSystem::numComponents
+    static constexpr unsigned numComponents = 3;
+
+    //! Index of the oil component
+    static constexpr unsigned oilCompIdx = IndexTraits::oilCompIdx;
+    //! Index of the water component
+    static constexpr unsigned waterCompIdx = IndexTraits::waterCompIdx;
+    //! Index of the gas component
+    static constexpr unsigned gasCompIdx = IndexTraits::gasCompIdx;
+
+protected:
+    STATIC_OR_NOTHING unsigned char numActivePhases_;
+    STATIC_OR_NOTHING std::array<bool,numPhases> phaseIsActive_;
+
+public:
+    //! \brief Returns the number of active fluid phases (i.e., usually three)
+    STATIC_OR_NOTHING unsigned numActivePhases() CONST_OR_NOTHING
+    { return numActivePhases_; }
+
+    //! \brief Returns whether a fluid phase is active
+    STATIC_OR_NOTHING unsigned phaseIsActive(unsigned phaseIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx < numPhases);
+        return phaseIsActive_[phaseIdx];
+    }
+
+    //! \brief returns the index of "primary" component of a phase (solvent)
+    STATIC_OR_NOTHING unsigned solventComponentIndex(unsigned phaseIdx) CONST_OR_NOTHING;
+
+    //! \brief returns the index of "secondary" component of a phase (solute)
+    STATIC_OR_NOTHING unsigned soluteComponentIndex(unsigned phaseIdx) CONST_OR_NOTHING;
+
+    //! \copydoc BaseFluidSystem::componentName
+    STATIC_OR_NOTHING const char* componentName(unsigned compIdx) CONST_OR_NOTHING;
+
+    //! \copydoc BaseFluidSystem::molarMass
+    STATIC_OR_NOTHING Scalar molarMass(unsigned compIdx, unsigned regionIdx = 0) CONST_OR_NOTHING
+    { return molarMass_[regionIdx][compIdx]; }
+
+    //! \copydoc BaseFluidSystem::isIdealMixture
+    STATIC_OR_NOTHING bool isIdealMixture(unsigned /*phaseIdx*/) CONST_OR_NOTHING
+    {
+        // fugacity coefficients are only pressure dependent -> we
+        // have an ideal mixture
+        return true;
+    }
+
+    //! \copydoc BaseFluidSystem::isCompressible
+    STATIC_OR_NOTHING bool isCompressible(unsigned /*phaseIdx*/) CONST_OR_NOTHING
+    { return true; /* all phases are compressible */ }
+
+    //! \copydoc BaseFluidSystem::isIdealGas
+    STATIC_OR_NOTHING bool isIdealGas(unsigned /*phaseIdx*/) CONST_OR_NOTHING
+    { return false; }
+
+
+    /****************************************
+     * Black-oil specific properties
+     ****************************************/
+    /*!
+     * \brief Returns the number of PVT regions which are considered.
+     *
+     * By default, this is 1.
+     */
+    STATIC_OR_NOTHING std::size_t numRegions() CONST_OR_NOTHING
+    { return molarMass_.size(); }
+
+    /*!
+     * \brief Returns whether the fluid system should consider that the gas component can
+     *        dissolve in the oil phase
+     *
+     * By default, dissolved gas is considered.
+     */
+    STATIC_OR_NOTHING bool enableDissolvedGas() CONST_OR_NOTHING
+    { return enableDissolvedGas_; }
+
+
+    /*!
+     * \brief Returns whether the fluid system should consider that the gas component can
+     *        dissolve in the water phase
+     *
+     * By default, dissolved gas is considered.
+     */
+    STATIC_OR_NOTHING bool enableDissolvedGasInWater() CONST_OR_NOTHING
+    { return enableDissolvedGasInWater_; }
+
+    /*!
+     * \brief Returns whether the fluid system should consider that the oil component can
+     *        dissolve in the gas phase
+     *
+     * By default, vaporized oil is not considered.
+     */
+    STATIC_OR_NOTHING bool enableVaporizedOil() CONST_OR_NOTHING
+    { return enableVaporizedOil_; }
+
+    /*!
+     * \brief Returns whether the fluid system should consider that the water component can
+     *        dissolve in the gas phase
+     *
+     * By default, vaporized water is not considered.
+     */
+    STATIC_OR_NOTHING bool enableVaporizedWater() CONST_OR_NOTHING
+    { return enableVaporizedWater_; }
+
+    /*!
+     * \brief Returns whether the fluid system should consider diffusion
+     *
+     * By default, diffusion is not considered.
+     */
+    STATIC_OR_NOTHING bool enableDiffusion() CONST_OR_NOTHING
+    { return enableDiffusion_; }
+
+    /*!
+     * \brief Returns the density of a fluid phase at surface pressure [kg/m^3]
+     *
+     * \copydoc Doxygen::phaseIdxParam
+     */
+    STATIC_OR_NOTHING Scalar referenceDensity(unsigned phaseIdx, unsigned regionIdx) CONST_OR_NOTHING
+    { return referenceDensity_[regionIdx][phaseIdx]; }
+
+    /****************************************
+     * thermodynamic quantities (generic version)
+     ****************************************/
+    //! \copydoc BaseFluidSystem::density
+    template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
+    STATIC_OR_NOTHING LhsEval density(const FluidState& fluidState,
+                           const ParameterCache<ParamCacheEval>& paramCache,
+                           unsigned phaseIdx) CONST_OR_NOTHING
+    { return density<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+
+    //! \copydoc BaseFluidSystem::fugacityCoefficient
+    template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
+    STATIC_OR_NOTHING LhsEval fugacityCoefficient(const FluidState& fluidState,
+                                       const ParameterCache<ParamCacheEval>& paramCache,
+                                       unsigned phaseIdx,
+                                       unsigned compIdx) CONST_OR_NOTHING
+    {
+        return fugacityCoefficient<FluidState, LhsEval>(fluidState,
+                                                        phaseIdx,
+                                                        compIdx,
+                                                        paramCache.regionIndex());
+    }
+
+    //! \copydoc BaseFluidSystem::viscosity
+    template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
+    STATIC_OR_NOTHING LhsEval viscosity(const FluidState& fluidState,
+                             const ParameterCache<ParamCacheEval>& paramCache,
+                             unsigned phaseIdx) CONST_OR_NOTHING
+    { return viscosity<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+
+    //! \copydoc BaseFluidSystem::enthalpy
+    template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
+    STATIC_OR_NOTHING LhsEval enthalpy(const FluidState& fluidState,
+                            const ParameterCache<ParamCacheEval>& paramCache,
+                            unsigned phaseIdx) CONST_OR_NOTHING
+    { return enthalpy<FluidState, LhsEval>(fluidState, phaseIdx, paramCache.regionIndex()); }
+
+    /****************************************
+     * thermodynamic quantities (black-oil specific version: Note that the PVT region
+     * index is explicitly passed instead of a parameter cache object)
+     ****************************************/
+    //! \copydoc BaseFluidSystem::density
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval density(const FluidState& fluidState,
+                           unsigned phaseIdx,
+                           unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const LhsEval& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+        const LhsEval& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: {
+            if (enableDissolvedGas()) {
+                // miscible oil
+                const LhsEval& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+
+                return
+                    bo*referenceDensity(oilPhaseIdx, regionIdx)
+                    + Rs*bo*referenceDensity(gasPhaseIdx, regionIdx);
+            }
+
+            // immiscible oil
+            const LhsEval Rs(0.0);
+            const auto& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+
+            return referenceDensity(phaseIdx, regionIdx)*bo;
+        }
+
+        case gasPhaseIdx: {
+             if (enableVaporizedOil() && enableVaporizedWater()) {
+                // gas containing vaporized oil and vaporized water
+                const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx)
+                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
+            }
+            if (enableVaporizedOil()) {
+                // miscible gas
+                const LhsEval Rvw(0.0);
+                const LhsEval& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx);
+            }
+            if (enableVaporizedWater()) {
+                // gas containing vaporized water
+                const LhsEval Rv(0.0);
+                const LhsEval& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
+            }
+
+            // immiscible gas
+            const LhsEval Rv(0.0);
+            const LhsEval Rvw(0.0);
+            const auto& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+            return bg*referenceDensity(phaseIdx, regionIdx);
+        }
+
+        case waterPhaseIdx:
+            if (enableDissolvedGasInWater()) {
+                 // gas miscible in water
+                const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
+                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                return
+                    bw*referenceDensity(waterPhaseIdx, regionIdx)
+                    + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
+            }
+            const LhsEval Rsw(0.0);
+            return
+                referenceDensity(waterPhaseIdx, regionIdx)
+                * waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+        }
+
+        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+    }
+
+    /*!
+     * \brief Compute the density of a saturated fluid phase.
+     *
+     * This means the density of the given fluid phase if the dissolved component (gas
+     * for the oil phase and oil for the gas phase) is at the thermodynamically possible
+     * maximum. For the water phase, there's no difference to the density() method
+     * for the standard blackoil model. If enableDissolvedGasInWater is enabled
+     * the water density takes into account the amount of dissolved gas
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturatedDensity(const FluidState& fluidState,
+                                    unsigned phaseIdx,
+                                    unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = fluidState.pressure(phaseIdx);
+        const auto& T = fluidState.temperature(phaseIdx);
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: {
+            if (enableDissolvedGas()) {
+                // miscible oil
+                const LhsEval& Rs = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, oilPhaseIdx, regionIdx);
+                const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+
+                return
+                    bo*referenceDensity(oilPhaseIdx, regionIdx)
+                    + Rs*bo*referenceDensity(gasPhaseIdx, regionIdx);
+            }
+
+            // immiscible oil
+            const LhsEval Rs(0.0);
+            const LhsEval& bo = oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+            return referenceDensity(phaseIdx, regionIdx)*bo;
+        }
+
+        case gasPhaseIdx: {
+            if (enableVaporizedOil() && enableVaporizedWater()) {
+                // gas containing vaporized oil and vaporized water
+                const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
+                const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx) 
+                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx) ;
+            }
+
+            if (enableVaporizedOil()) {
+                // miscible gas
+                const LhsEval Rvw(0.0);
+                const LhsEval& Rv = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rv*bg*referenceDensity(oilPhaseIdx, regionIdx);
+            }
+
+            if (enableVaporizedWater()) {
+                // gas containing vaporized water
+                const LhsEval Rv(0.0);
+                const LhsEval& Rvw = saturatedVaporizationFactor<FluidState, LhsEval>(fluidState, gasPhaseIdx, regionIdx);
+                const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+                return
+                    bg*referenceDensity(gasPhaseIdx, regionIdx)
+                    + Rvw*bg*referenceDensity(waterPhaseIdx, regionIdx);
+            }
+
+            // immiscible gas
+            const LhsEval Rv(0.0);
+            const LhsEval Rvw(0.0);
+            const LhsEval& bg = gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+
+            return referenceDensity(phaseIdx, regionIdx)*bg;
+
+        }
+
+        case waterPhaseIdx:
+        {
+            if (enableDissolvedGasInWater()) {
+                 // miscible in water
+                const auto& saltConcentration = decay<LhsEval>(fluidState.saltConcentration());
+                const LhsEval& Rsw = saturatedDissolutionFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
+                const LhsEval& bw = waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                return
+                    bw*referenceDensity(waterPhaseIdx, regionIdx)
+                    + Rsw*bw*referenceDensity(gasPhaseIdx, regionIdx);
+            }
+            return
+                referenceDensity(waterPhaseIdx, regionIdx)
+                *inverseFormationVolumeFactor<FluidState, LhsEval>(fluidState, waterPhaseIdx, regionIdx);
+        }
+        }
+
+        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+    }
+
+    /*!
+     * \brief Returns the formation volume factor \f$B_\alpha\f$ of an "undersaturated"
+     *        fluid phase
+     *
+     * For the oil (gas) phase, "undersaturated" means that the concentration of the gas
+     * (oil) component is not assumed to be at the thermodynamically possible maximum at
+     * the given temperature and pressure.
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval inverseFormationVolumeFactor(const FluidState& fluidState,
+                                                unsigned phaseIdx,
+                                                unsigned regionIdx) CONST_OR_NOTHING
+    {
+        OPM_TIMEBLOCK_LOCAL(inverseFormationVolumeFactor);
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: {
+            if (enableDissolvedGas()) {
+                const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(gasPhaseIdx) > 0.0
+                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                } else {
+                    return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+                }
+            }
+
+            const LhsEval Rs(0.0);
+            return oilPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rs);
+        }
+        case gasPhaseIdx: {
+            if (enableVaporizedOil() && enableVaporizedWater()) {
+                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                 if (fluidState.saturation(waterPhaseIdx) > 0.0
+                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
+                    && fluidState.saturation(oilPhaseIdx) > 0.0
+                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                 { 
+                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                 } else {
+                     return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                 }
+            }
+
+            if (enableVaporizedOil()) {
+                const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(oilPhaseIdx) > 0.0
+                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                } else {
+                    const LhsEval Rvw(0.0);
+                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                }
+            }
+
+            if (enableVaporizedWater()) { 
+                const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(waterPhaseIdx) > 0.0
+                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+                } else {
+                    const LhsEval Rv(0.0);
+                    return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+                }
+            }
+            
+            const LhsEval Rv(0.0);
+            const LhsEval Rvw(0.0);
+            return gasPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rv, Rvw);
+        }
+        case waterPhaseIdx:
+        {
+            const auto& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+            if (enableDissolvedGasInWater()) {
+                const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(gasPhaseIdx) > 0.0
+                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
+                {
+                    return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
+                } else {
+                    return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+                }
+            }
+            const LhsEval Rsw(0.0);
+            return waterPvt_->inverseFormationVolumeFactor(regionIdx, T, p, Rsw, saltConcentration);
+        }
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the formation volume factor \f$B_\alpha\f$ of a "saturated" fluid
+     *        phase
+     *
+     * For the oil phase, this means that it is gas saturated, the gas phase is oil
+     * saturated and for the water phase, there is no difference to formationVolumeFactor()
+     * for the standard blackoil model. If enableDissolvedGasInWater is enabled
+     * the water density takes into account the amount of dissolved gas
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturatedInverseFormationVolumeFactor(const FluidState& fluidState,
+                                                         unsigned phaseIdx,
+                                                         unsigned regionIdx) CONST_OR_NOTHING
+    {
+        OPM_TIMEBLOCK_LOCAL(saturatedInverseFormationVolumeFactor);
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+        const auto& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return oilPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+        case gasPhaseIdx: return gasPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p);
+        case waterPhaseIdx: return waterPvt_->saturatedInverseFormationVolumeFactor(regionIdx, T, p, saltConcentration);
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    //! \copydoc BaseFluidSystem::fugacityCoefficient
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval fugacityCoefficient(const FluidState& fluidState,
+                                       unsigned phaseIdx,
+                                       unsigned compIdx,
+                                       unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(compIdx <= numComponents);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        // for the fugacity coefficient of the oil component in the oil phase, we use
+        // some pseudo-realistic value for the vapor pressure to ease physical
+        // interpretation of the results
+        const LhsEval phi_oO = 20e3/p;
+
+        // for the gas component in the gas phase, assume it to be an ideal gas
+        constexpr const Scalar phi_gG = 1.0;
+
+        // for the fugacity coefficient of the water component in the water phase, we use
+        // the same approach as for the oil component in the oil phase
+        const LhsEval phi_wW = 30e3/p;
+
+        switch (phaseIdx) {
+        case gasPhaseIdx: // fugacity coefficients for all components in the gas phase
+            switch (compIdx) {
+            case gasCompIdx:
+                return phi_gG;
+
+            // for the oil component, we calculate the Rv value for saturated gas and Rs
+            // for saturated oil, and compute the fugacity coefficients at the
+            // equilibrium. for this, we assume that in equilibrium the fugacities of the
+            // oil component is the same in both phases.
+            case oilCompIdx: {
+                if (!enableVaporizedOil())
+                    // if there's no vaporized oil, the gas phase is assumed to be
+                    // immiscible with the oil component
+                    return phi_gG*1e6;
+
+                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+                const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
+                const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
+
+                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+                const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
+                const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
+                const auto& x_oOSat = 1.0 - x_oGSat;
+
+                const auto& p_o = decay<LhsEval>(fluidState.pressure(oilPhaseIdx));
+                const auto& p_g = decay<LhsEval>(fluidState.pressure(gasPhaseIdx));
+
+                return phi_oO*p_o*x_oOSat / (p_g*x_gOSat);
+            }
+
+            case waterCompIdx:
+                // the water component is assumed to be never miscible with the gas phase
+                return phi_gG*1e6;
+
+            default:
+                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
+            }
+
+        case oilPhaseIdx: // fugacity coefficients for all components in the oil phase
+            switch (compIdx) {
+            case oilCompIdx:
+                return phi_oO;
+
+            // for the oil and water components, we proceed analogous to the gas and
+            // water components in the gas phase
+            case gasCompIdx: {
+                if (!enableDissolvedGas())
+                    // if there's no dissolved gas, the oil phase is assumed to be
+                    // immiscible with the gas component
+                    return phi_oO*1e6;
+
+                const auto& R_vSat = gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+                const auto& X_gOSat = convertRvToXgO(R_vSat, regionIdx);
+                const auto& x_gOSat = convertXgOToxgO(X_gOSat, regionIdx);
+                const auto& x_gGSat = 1.0 - x_gOSat;
+
+                const auto& R_sSat = oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+                const auto& X_oGSat = convertRsToXoG(R_sSat, regionIdx);
+                const auto& x_oGSat = convertXoGToxoG(X_oGSat, regionIdx);
+
+                const auto& p_o = decay<LhsEval>(fluidState.pressure(oilPhaseIdx));
+                const auto& p_g = decay<LhsEval>(fluidState.pressure(gasPhaseIdx));
+
+                return phi_gG*p_g*x_gGSat / (p_o*x_oGSat);
+            }
+
+            case waterCompIdx:
+                return phi_oO*1e6;
+
+            default:
+                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
+            }
+
+        case waterPhaseIdx: // fugacity coefficients for all components in the water phase
+            // the water phase fugacity coefficients are pretty simple: because the water
+            // phase is assumed to consist entirely from the water component, we just
+            // need to make sure that the fugacity coefficients for the other components
+            // are a few orders of magnitude larger than the one of the water
+            // component. (i.e., the affinity of the gas and oil components to the water
+            // phase is lower by a few orders of magnitude)
+            switch (compIdx) {
+            case waterCompIdx: return phi_wW;
+            case oilCompIdx: return 1.1e6*phi_wW;
+            case gasCompIdx: return 1e6*phi_wW;
+            default:
+                throw std::logic_error("Invalid component index "+std::to_string(compIdx));
+            }
+
+        default:
+            throw std::logic_error("Invalid phase index "+std::to_string(phaseIdx));
+        }
+
+        throw std::logic_error("Unhandled phase or component index");
+    }
+
+    //! \copydoc BaseFluidSystem::viscosity
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval viscosity(const FluidState& fluidState,
+                             unsigned phaseIdx,
+                             unsigned regionIdx) CONST_OR_NOTHING
+    {
+        OPM_TIMEBLOCK_LOCAL(viscosity);
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const LhsEval& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const LhsEval& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: {
+            if (enableDissolvedGas()) {
+                const auto& Rs = BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(gasPhaseIdx) > 0.0
+                    && Rs >= (1.0 - 1e-10)*oilPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return oilPvt_->saturatedViscosity(regionIdx, T, p);
+                } else {
+                    return oilPvt_->viscosity(regionIdx, T, p, Rs);
+                }
+            }
+
+            const LhsEval Rs(0.0);
+            return oilPvt_->viscosity(regionIdx, T, p, Rs);
+        }
+
+        case gasPhaseIdx: {
+             if (enableVaporizedOil() && enableVaporizedWater()) {
+                 const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                 const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                 if (fluidState.saturation(waterPhaseIdx) > 0.0
+                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p))
+                    && fluidState.saturation(oilPhaseIdx) > 0.0
+                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                 { 
+                     return gasPvt_->saturatedViscosity(regionIdx, T, p);
+                 } else {
+                     return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                 }
+            }
+            if (enableVaporizedOil()) {
+                const auto& Rv = BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(oilPhaseIdx) > 0.0
+                    && Rv >= (1.0 - 1e-10)*gasPvt_->saturatedOilVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return gasPvt_->saturatedViscosity(regionIdx, T, p);
+                } else {
+                    const LhsEval Rvw(0.0);
+                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                }
+            }
+            if (enableVaporizedWater()) {
+                const auto& Rvw = BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(waterPhaseIdx) > 0.0
+                    && Rvw >= (1.0 - 1e-10)*gasPvt_->saturatedWaterVaporizationFactor(regionIdx, scalarValue(T), scalarValue(p)))
+                {
+                    return gasPvt_->saturatedViscosity(regionIdx, T, p); 
+                } else {
+                    const LhsEval Rv(0.0);
+                    return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+                }
+            }
+
+            const LhsEval Rv(0.0);
+            const LhsEval Rvw(0.0);
+            return gasPvt_->viscosity(regionIdx, T, p, Rv, Rvw);
+        }
+
+        case waterPhaseIdx:
+        {
+            const LhsEval& saltConcentration = BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+            if (enableDissolvedGasInWater()) {
+                const auto& Rsw = BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx);
+                if (fluidState.saturation(gasPhaseIdx) > 0.0
+                    && Rsw >= (1.0 - 1e-10)*waterPvt_->saturatedGasDissolutionFactor(regionIdx, scalarValue(T), scalarValue(p), scalarValue(saltConcentration)))
+                {
+                    return waterPvt_->saturatedViscosity(regionIdx, T, p, saltConcentration);
+                } else {
+                    return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
+                }
+            }
+            const LhsEval Rsw(0.0);
+            return waterPvt_->viscosity(regionIdx, T, p, Rsw, saltConcentration);
+        }
+        }
+
+        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+    }
+
+    //! \copydoc BaseFluidSystem::enthalpy
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval enthalpy(const FluidState& fluidState,
+                            unsigned phaseIdx,
+                            unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx:
+            return
+                oilPvt_->internalEnergy(regionIdx, T, p, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
+                + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
+
+        case gasPhaseIdx:
+            return
+                 gasPvt_->internalEnergy(regionIdx, T, p,
+                 BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
+                  BlackOil::template getRvw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
+                  + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
+
+        case waterPhaseIdx:
+            return
+                waterPvt_->internalEnergy(regionIdx, T, p,
+                                          BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
+                                          BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx))
+                + p/density<FluidState, LhsEval>(fluidState, phaseIdx, regionIdx);
+
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+
+        throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+    }
+
+    /*!
+     * \brief Returns the water vaporization factor \f$R_\alpha\f$ of saturated phase
+     *
+     * For the gas phase, this means the R_vw factor, for the water and oil phase,
+     * it is always 0.
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturatedVaporizationFactor(const FluidState& fluidState,
+                                              unsigned phaseIdx,
+                                              unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+        const auto& saltConcentration = decay<LhsEval>(fluidState.saltConcentration());
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return 0.0;
+        case gasPhaseIdx: return gasPvt_->saturatedWaterVaporizationFactor(regionIdx, T, p, saltConcentration);
+        case waterPhaseIdx: return 0.0;
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the dissolution factor \f$R_\alpha\f$ of a saturated fluid phase
+     *
+     * For the oil (gas) phase, this means the R_s and R_v factors, for the water phase,
+     * it is always 0.
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturatedDissolutionFactor(const FluidState& fluidState,
+                                              unsigned phaseIdx,
+                                              unsigned regionIdx,
+                                              const LhsEval& maxOilSaturation) CONST_OR_NOTHING
+    {
+        OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+        const auto& So = decay<LhsEval>(fluidState.saturation(oilPhaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p, So, maxOilSaturation);
+        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p, So, maxOilSaturation);
+        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
+        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the dissolution factor \f$R_\alpha\f$ of a saturated fluid phase
+     *
+     * For the oil (gas) phase, this means the R_s and R_v factors, for the water phase,
+     * it is always 0. The difference of this method compared to the previous one is that
+     * this method does not prevent dissolving a given component if the corresponding
+     * phase's saturation is small-
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturatedDissolutionFactor(const FluidState& fluidState,
+                                              unsigned phaseIdx,
+                                              unsigned regionIdx) CONST_OR_NOTHING
+    {
+        OPM_TIMEBLOCK_LOCAL(saturatedDissolutionFactor);
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return oilPvt_->saturatedGasDissolutionFactor(regionIdx, T, p);
+        case gasPhaseIdx: return gasPvt_->saturatedOilVaporizationFactor(regionIdx, T, p);
+        case waterPhaseIdx: return waterPvt_->saturatedGasDissolutionFactor(regionIdx, T, p,
+        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    /*!
+     * \brief Returns the bubble point pressure $P_b$ using the current Rs
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval bubblePointPressure(const FluidState& fluidState,
+                                       unsigned regionIdx) CONST_OR_NOTHING
+    {
+        return saturationPressure(fluidState, oilPhaseIdx, regionIdx);
+    }
+
+
+    /*!
+     * \brief Returns the dew point pressure $P_d$ using the current Rv
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval dewPointPressure(const FluidState& fluidState,
+                                       unsigned regionIdx) CONST_OR_NOTHING
+    {
+        return saturationPressure(fluidState, gasPhaseIdx, regionIdx);
+    }
+
+    /*!
+     * \brief Returns the saturation pressure of a given phase [Pa] depending on its
+     *        composition.
+     *
+     * In the black-oil model, the saturation pressure it the pressure at which the fluid
+     * phase is in equilibrium with the gas phase, i.e., it is the inverse of the
+     * "dissolution factor". Note that a-priori this quantity is undefined for the water
+     * phase (because water is assumed to be immiscible with everything else). This method
+     * here just returns 0, though.
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar>
+    STATIC_OR_NOTHING LhsEval saturationPressure(const FluidState& fluidState,
+                                      unsigned phaseIdx,
+                                      unsigned regionIdx) CONST_OR_NOTHING
+    {
+        assert(phaseIdx <= numPhases);
+        assert(regionIdx <= numRegions());
+
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return oilPvt_->saturationPressure(regionIdx, T, BlackOil::template getRs_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        case gasPhaseIdx: return gasPvt_->saturationPressure(regionIdx, T, BlackOil::template getRv_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        case waterPhaseIdx: return waterPvt_->saturationPressure(regionIdx, T,
+        BlackOil::template getRsw_<ThisType, FluidState, LhsEval>(fluidState, regionIdx),
+        BlackOil::template getSaltConcentration_<ThisType, FluidState, LhsEval>(fluidState, regionIdx));
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+    /****************************************
+     * Auxiliary and convenience methods for the black-oil model
+     ****************************************/
+    /*!
+     * \brief Convert the mass fraction of the gas component in the oil phase to the
+     *        corresponding gas dissolution factor.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXoGToRs(const LhsEval& XoG, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        return XoG/(1.0 - XoG)*(rho_oRef/rho_gRef);
+    }
+
+    /*!
+     * \brief Convert the mass fraction of the gas component in the water phase to the
+     *        corresponding gas dissolution factor.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXwGToRsw(const LhsEval& XwG, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        return XwG/(1.0 - XwG)*(rho_wRef/rho_gRef);
+    }
+
+    /*!
+     * \brief Convert the mass fraction of the oil component in the gas phase to the
+     *        corresponding oil vaporization factor.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXgOToRv(const LhsEval& XgO, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        return XgO/(1.0 - XgO)*(rho_gRef/rho_oRef);
+    }
+
+    /*!
+     * \brief Convert the mass fraction of the water component in the gas phase to the
+     *        corresponding water vaporization factor.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXgWToRvw(const LhsEval& XgW, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        return XgW/(1.0 - XgW)*(rho_gRef/rho_wRef);
+    }
+
+
+    /*!
+     * \brief Convert a gas dissolution factor to the the corresponding mass fraction
+     *        of the gas component in the oil phase.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertRsToXoG(const LhsEval& Rs, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        const LhsEval& rho_oG = Rs*rho_gRef;
+        return rho_oG/(rho_oRef + rho_oG);
+    }
+
+    /*!
+     * \brief Convert a gas dissolution factor to the the corresponding mass fraction
+     *        of the gas component in the water phase.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertRswToXwG(const LhsEval& Rsw, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        const LhsEval& rho_wG = Rsw*rho_gRef;
+        return rho_wG/(rho_wRef + rho_wG);
+    }
+
+    /*!
+     * \brief Convert an oil vaporization factor to the corresponding mass fraction
+     *        of the oil component in the gas phase.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertRvToXgO(const LhsEval& Rv, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_oRef = referenceDensity_[regionIdx][oilPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        const LhsEval& rho_gO = Rv*rho_oRef;
+        return rho_gO/(rho_gRef + rho_gO);
+    }
+
+    /*!
+     * \brief Convert an water vaporization factor to the corresponding mass fraction
+     *        of the water component in the gas phase.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertRvwToXgW(const LhsEval& Rvw, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar rho_wRef = referenceDensity_[regionIdx][waterPhaseIdx];
+        Scalar rho_gRef = referenceDensity_[regionIdx][gasPhaseIdx];
+
+        const LhsEval& rho_gW = Rvw*rho_wRef;
+        return rho_gW/(rho_gRef + rho_gW);
+    }
+
+    /*!
+     * \brief Convert a water mass fraction in the gas phase the corresponding mole fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXgWToxgW(const LhsEval& XgW, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MW = molarMass_[regionIdx][waterCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return XgW*MG / (MW*(1 - XgW) + XgW*MG);
+    }
+
+    /*!
+     * \brief Convert a gas mass fraction in the water phase the corresponding mole fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXwGToxwG(const LhsEval& XwG, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MW = molarMass_[regionIdx][waterCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return XwG*MW / (MG*(1 - XwG) + XwG*MW);
+    }
+
+    /*!
+     * \brief Convert a gas mass fraction in the oil phase the corresponding mole fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXoGToxoG(const LhsEval& XoG, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MO = molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return XoG*MO / (MG*(1 - XoG) + XoG*MO);
+    }
+
+    /*!
+     * \brief Convert a gas mole fraction in the oil phase the corresponding mass fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertxoGToXoG(const LhsEval& xoG, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MO = molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return xoG*MG / (xoG*(MG - MO) + MO);
+    }
+
+    /*!
+     * \brief Convert a oil mass fraction in the gas phase the corresponding mole fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertXgOToxgO(const LhsEval& XgO, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MO = molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return XgO*MG / (MO*(1 - XgO) + XgO*MG);
+    }
+
+    /*!
+     * \brief Convert a oil mole fraction in the gas phase the corresponding mass fraction.
+     */
+    template <class LhsEval>
+    STATIC_OR_NOTHING LhsEval convertxgOToXgO(const LhsEval& xgO, unsigned regionIdx) CONST_OR_NOTHING
+    {
+        Scalar MO = molarMass_[regionIdx][oilCompIdx];
+        Scalar MG = molarMass_[regionIdx][gasCompIdx];
+
+        return xgO*MO / (xgO*(MO - MG) + MG);
+    }
+
+    /*!
+     * \brief Return a reference to the low-level object which calculates the gas phase
+     *        quantities.
+     *
+     * \note It is not recommended to use this method directly, but the black-oil
+     *       specific methods of the fluid systems from above should be used instead.
+     */
+    STATIC_OR_NOTHING const GasPvt& gasPvt() CONST_OR_NOTHING
+    { return *gasPvt_; }
+
+    /*!
+     * \brief Return a reference to the low-level object which calculates the oil phase
+     *        quantities.
+     *
+     * \note It is not recommended to use this method directly, but the black-oil
+     *       specific methods of the fluid systems from above should be used instead.
+     */
+    STATIC_OR_NOTHING const OilPvt& oilPvt() CONST_OR_NOTHING
+    { return *oilPvt_; }
+
+    /*!
+     * \brief Return a reference to the low-level object which calculates the water phase
+     *        quantities.
+     *
+     * \note It is not recommended to use this method directly, but the black-oil
+     *       specific methods of the fluid systems from above should be used instead.
+     */
+    STATIC_OR_NOTHING const WaterPvt& waterPvt() CONST_OR_NOTHING
+    { return *waterPvt_; }
+
+    /*!
+     * \brief Set the temperature of the reservoir.
+     *
+     * This method is black-oil specific and only makes sense for isothermal simulations.
+     */
+    STATIC_OR_NOTHING Scalar reservoirTemperature(unsigned = 0) CONST_OR_NOTHING
+    { return reservoirTemperature_; }
+
+    /*!
+     * \brief Return the temperature of the reservoir.
+     *
+     * This method is black-oil specific and only makes sense for isothermal simulations.
+     */
+    STATIC_OR_NOTHING void setReservoirTemperature(Scalar value)
+    { reservoirTemperature_ = value; }
+
+    STATIC_OR_NOTHING short activeToCanonicalPhaseIdx(unsigned activePhaseIdx) CONST_OR_NOTHING;
+
+    STATIC_OR_NOTHING short canonicalToActivePhaseIdx(unsigned phaseIdx) CONST_OR_NOTHING;
+
+    //! \copydoc BaseFluidSystem::diffusionCoefficient
+    STATIC_OR_NOTHING Scalar diffusionCoefficient(unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0) CONST_OR_NOTHING
+    { return diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx]; }
+
+    //! \copydoc BaseFluidSystem::setDiffusionCoefficient
+    STATIC_OR_NOTHING void setDiffusionCoefficient(Scalar coefficient, unsigned compIdx, unsigned phaseIdx, unsigned regionIdx = 0)
+    { diffusionCoefficients_[regionIdx][numPhases*compIdx + phaseIdx] = coefficient ; }
+
+    /*!
+     * \copydoc BaseFluidSystem::diffusionCoefficient
+     */
+    template <class FluidState, class LhsEval = typename FluidState::Scalar, class ParamCacheEval = LhsEval>
+    STATIC_OR_NOTHING LhsEval diffusionCoefficient(const FluidState& fluidState,
+                                        const ParameterCache<ParamCacheEval>& paramCache,
+                                        unsigned phaseIdx,
+                                        unsigned compIdx) CONST_OR_NOTHING
+    {
+        // diffusion is disabled by the user
+        if(!enableDiffusion())
+            return 0.0;
+
+        // diffusion coefficients are set, and we use them
+        if(!diffusionCoefficients_.empty()) {
+            return diffusionCoefficient(compIdx, phaseIdx, paramCache.regionIndex());
+        }
+
+        const auto& p = decay<LhsEval>(fluidState.pressure(phaseIdx));
+        const auto& T = decay<LhsEval>(fluidState.temperature(phaseIdx));
+
+        switch (phaseIdx) {
+        case oilPhaseIdx: return oilPvt().diffusionCoefficient(T, p, compIdx);
+        case gasPhaseIdx: return gasPvt().diffusionCoefficient(T, p, compIdx);
+        case waterPhaseIdx: return waterPvt().diffusionCoefficient(T, p, compIdx);
+        default: throw std::logic_error("Unhandled phase index "+std::to_string(phaseIdx));
+        }
+    }
+
+private:
+#if !FLUIDSYSTEM_IS_STATIC
+    friend class BlackOilFluidSystem<Scalar, IndexTraits, GasPvtT, OilPvtT, WaterPvtT>;
+#endif
+
+    STATIC_OR_NOTHING void resizeArrays_(std::size_t numRegions);
+
+#if HAVE_ECL_INPUT
+    STATIC_OR_NOTHING void checkPvtApproach_(const EclipseState& eclState) CONST_OR_NOTHING;
+#endif
+
+    STATIC_OR_NOTHING Scalar reservoirTemperature_;
+
+    STATIC_OR_NOTHING std::shared_ptr<GasPvt> gasPvt_;
+    STATIC_OR_NOTHING std::shared_ptr<OilPvt> oilPvt_;
+    STATIC_OR_NOTHING std::shared_ptr<WaterPvt> waterPvt_;
+
+    STATIC_OR_NOTHING bool enableDissolvedGas_;
+    STATIC_OR_NOTHING bool enableDissolvedGasInWater_;
+    STATIC_OR_NOTHING bool enableVaporizedOil_;
+    STATIC_OR_NOTHING bool enableVaporizedWater_;
+    STATIC_OR_NOTHING bool enableDiffusion_;
+
+    // HACK for GCC 4.4: the array size has to be specified using the literal value '3'
+    // here, because GCC 4.4 seems to be unable to determine the number of phases from
+    // the BlackOil fluid system in the attribute declaration below...
+    STATIC_OR_NOTHING std::vector<std::array<Scalar, /*numPhases=*/3> > referenceDensity_;
+    STATIC_OR_NOTHING std::vector<std::array<Scalar, /*numComponents=*/3> > molarMass_;
+    STATIC_OR_NOTHING std::vector<std::array<Scalar, /*numComponents=*/3 * /*numPhases=*/3> > diffusionCoefficients_;
+
+    STATIC_OR_NOTHING std::array<short, numPhases> activeToCanonicalPhaseIdx_;
+    STATIC_OR_NOTHING std::array<short, numPhases> canonicalToActivePhaseIdx_;
+
+    STATIC_OR_NOTHING bool isInitialized_;
+};
+
+} // namespace Opm
@@ -35,7 +35,9 @@ copyright holders.
 #include <opm/material/components/H2.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/Valgrind.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/SolubilityTable.hpp>
 
+#include <string>
 #include <vector>
 
 namespace Opm {
@@ -132,6 +134,42 @@ public:
     void setEnableSaltConcentration(bool yesno)
     { enableSaltConcentration_ = yesno; }
 
+    /*!
+    * \brief Pre-tabulate the H2 solubility of all PVT regions.
+    *
+    * Within the range of the tables, the gas dissolution factor is
+    * interpolated instead of being computed from the Li et al. model. The
+    * tables depend on the salinities and on whether the salt concentration
+    * is enabled, so this must be called after all other parameters are set.
+    *
+    * Returns the size and the measured accuracy of each table.
+    */
+    std::vector<typename SolubilityTable<Scalar>::Report>
+    tabulateSolubility(const SolubilityTableParameters<Scalar>& params = {})
+    {
+        std::vector<typename SolubilityTable<Scalar>::Report> reports;
+        rsTables_.assign(numRegions(), SolubilityTable<Scalar>{});
+        for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+            const Scalar minSalinity = enableSaltConcentration_ ? Scalar{0} : salinity_[regionIdx];
+            const Scalar maxSalinity = enableSaltConcentration_ ? params.maxSalinity : salinity_[regionIdx];
+            const auto rs = [this, regionIdx](Scalar T, Scalar p, Scalar salinity)
+            { return rsSatModel_(regionIdx, T, p, salinity); };
+
+            reports.push_back(rsTables_[regionIdx].build(params, minSalinity, maxSalinity, rs));
+            const auto& report = reports.back();
+            OpmLog::info("Tabulated the H2 solubility of PVT region " + std::to_string(regionIdx + 1)
+                         + " on " + std::to_string(report.numTemperatures)
+                         + "x" + std::to_string(report.numPressures)
+                         + "x" + std::to_string(report.numSalinities)
+                         + " points. The table is used in "
+                         + std::to_string(100*report.acceptedFraction)
+                         + "% of the range with a maximum relative interpolation error of "
+                         + std::to_string(report.maxRelativeError));
+        }
+
+        return reports;
+    }
+
     /*!
     * \brief Return the number of PVT regions which are considered by this PVT-object.
     */
@@ -395,6 +433,7 @@ private:
     std::vector<Scalar> salinity_;
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
+    std::vector<SolubilityTable<Scalar>> rsTables_;
 
     /*!
     * \brief Calculate density of aqueous solution (H2O-NaCl/brine and H2).
@@ -577,6 +616,18 @@ private:
         if (!enableDissolution_)
             return 0.0;
 
+        if (!rsTables_.empty() && rsTables_[regionIdx].applies(temperature, pressure, salinity))
+            return rsTables_[regionIdx].eval(temperature, pressure, salinity);
+
+        return rsSatModel_(regionIdx, temperature, pressure, salinity);
+    }
+
+    template <class LhsEval>
+    LhsEval rsSatModel_(unsigned regionIdx,
+                        const LhsEval& temperature,
+                        const LhsEval& pressure,
+                        const LhsEval& salinity) const
+    {
         // calulate the equilibrium composition for the given temperature and pressure
         LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure, salinity, extrapolate);
         
@@ -27,8 +27,11 @@
 #ifndef OPM_DEAD_OIL_PVT_HPP
 #define OPM_DEAD_OIL_PVT_HPP
 
+#include <opm/material/common/PackedTabulatedFunctions.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -124,6 +127,28 @@ public:
                          const Evaluation& /*Rs*/) const
     { return saturatedViscosity(regionIdx, temperature, pressure); }
 
+    /*!
+     * \brief Returns the dynamic viscosities [Pa s] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i] and at the pressure pressure[i], the
+     * values of Rs are ignored. The tables of all regions are packed into a single
+     * buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void viscosities(const unsigned* regionIdx,
+                     const Evaluation* pressure,
+                     const Evaluation* /*Rs*/,
+                     Evaluation* values,
+                     std::size_t numCells) const
+    {
+        for (std::size_t i = 0; i < numCells; ++i) {
+            const Evaluation& invBo = packedInverseOilB_.eval(regionIdx[i], pressure[i]);
+            const Evaluation& invMuoBo = packedInverseOilBMu_.eval(regionIdx[i], pressure[i]);
+
+            values[i] = invBo/invMuoBo;
+        }
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of gas saturated oil given a pressure.
      */
@@ -148,6 +173,21 @@ public:
                                             const Evaluation& /*Rs*/) const
     { return inverseOilB_[regionIdx].eval(pressure, /*extrapolate=*/true); }
 
+    /*!
+     * \brief Returns the inverse formation volume factors [-] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i] and at the pressure pressure[i], the
+     * values of Rs are ignored. The tables of all regions are packed into a single
+     * buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactors(const unsigned* regionIdx,
+                                       const Evaluation* pressure,
+                                       const Evaluation* /*Rs*/,
+                                       Evaluation* values,
+                                       std::size_t numCells) const
+    { packedInverseOilB_.eval(regionIdx, pressure, values, numCells); }
+
     /*!
      * \brief Returns the formation volume factor [-] of saturated oil.
      *
@@ -228,6 +268,10 @@ private:
     std::vector<TabulatedOneDFunction> inverseOilB_;
     std::vector<TabulatedOneDFunction> oilMu_;
     std::vector<TabulatedOneDFunction> inverseOilBMu_;
+
+    // copies of inverseOilB_ and inverseOilBMu_ for the batched evaluation
+    PackedTabulated1DFunctions<Scalar> packedInverseOilB_;
+    PackedTabulated1DFunctions<Scalar> packedInverseOilBMu_;
 };
 
 } // namespace Opm
@@ -29,8 +29,10 @@
 
 #include <opm/material/Constants.hpp>
 
+#include <opm/material/common/PackedTabulatedFunctions.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
 #include <vector>
 
 namespace Opm {
@@ -138,6 +140,28 @@ public:
                          const Evaluation& /*Rvw*/) const
     { return saturatedViscosity(regionIdx, temperature, pressure); }
 
+    /*!
+     * \brief Returns the dynamic viscosities [Pa s] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i] and at the pressure pressure[i], the
+     * values of Rv are ignored. The tables of all regions are packed into a single
+     * buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void viscosities(const unsigned* regionIdx,
+                     const Evaluation* pressure,
+                     const Evaluation* /*Rv*/,
+                     Evaluation* values,
+                     std::size_t numCells) const
+    {
+        for (std::size_t i = 0; i < numCells; ++i) {
+            const Evaluation& invBg = packedInverseGasB_.eval(regionIdx[i], pressure[i]);
+            const Evaluation& invMugBg = packedInverseGasBMu_.eval(regionIdx[i], pressure[i]);
+
+            values[i] = invBg/invMugBg;
+        }
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of oil saturated gas at given pressure.
      */
@@ -163,6 +187,21 @@ public:
                                             const Evaluation& /*Rvw*/) const
     { return saturatedInverseFormationVolumeFactor(regionIdx, temperature, pressure); }
 
+    /*!
+     * \brief Returns the inverse formation volume factors [-] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i] and at the pressure pressure[i], the
+     * values of Rv are ignored. The tables of all regions are packed into a single
+     * buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactors(const unsigned* regionIdx,
+                                       const Evaluation* pressure,
+                                       const Evaluation* /*Rv*/,
+                                       Evaluation* values,
+                                       std::size_t numCells) const
+    { packedInverseGasB_.eval(regionIdx, pressure, values, numCells); }
+
     /*!
      * \brief Returns the formation volume factor [-] of oil saturated gas at given pressure.
      */
@@ -249,6 +288,10 @@ private:
     std::vector<TabulatedOneDFunction> inverseGasB_;
     std::vector<TabulatedOneDFunction> gasMu_;
     std::vector<TabulatedOneDFunction> inverseGasBMu_;
+
+    // copies of inverseGasB_ and inverseGasBMu_ for the batched evaluation
+    PackedTabulated1DFunctions<Scalar> packedInverseGasB_;
+    PackedTabulated1DFunctions<Scalar> packedInverseGasBMu_;
 };
 
 } // namespace Opm
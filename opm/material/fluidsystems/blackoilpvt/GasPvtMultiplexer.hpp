@@ -35,6 +35,8 @@
 #include "Co2GasPvt.hpp"
 #include "H2GasPvt.hpp"
 
+#include <type_traits>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -167,6 +169,14 @@ public:
      * This method assumes that the deck features valid DENSITY and PVDG keywords.
      */
     void initFromState(const EclipseState& eclState, const Schedule& schedule);
+
+    /*!
+     * \brief Returns the approach which initFromState() selects for an ECL state.
+     *
+     * GasPvtApproach::NoGas is returned if the gas phase is inactive or if the deck does
+     * not specify a supported gas PVT model.
+     */
+    static GasPvtApproach chooseApproach(const EclipseState& eclState);
 #endif // HAVE_ECL_INPUT
 
     void setApproach(GasPvtApproach gasPvtAppr)
@@ -348,6 +358,32 @@ public:
     GasPvtApproach gasPvtApproach() const
     { return gasPvtApproach_; }
 
+    /*!
+     * \brief Returns the approach which is implemented by a given PVT class.
+     *
+     * GasPvtApproach::NoGas is returned for classes which are not handled by the multiplexer.
+     */
+    template <class PvtImpl>
+    static constexpr GasPvtApproach approachOf()
+    {
+        if constexpr (std::is_same_v<PvtImpl, DryGasPvt<Scalar>>)
+            return GasPvtApproach::DryGas;
+        else if constexpr (std::is_same_v<PvtImpl, DryHumidGasPvt<Scalar>>)
+            return GasPvtApproach::DryHumidGas;
+        else if constexpr (std::is_same_v<PvtImpl, WetHumidGasPvt<Scalar>>)
+            return GasPvtApproach::WetHumidGas;
+        else if constexpr (std::is_same_v<PvtImpl, WetGasPvt<Scalar>>)
+            return GasPvtApproach::WetGas;
+        else if constexpr (std::is_same_v<PvtImpl, GasPvtThermal<Scalar>>)
+            return GasPvtApproach::ThermalGas;
+        else if constexpr (std::is_same_v<PvtImpl, Co2GasPvt<Scalar>>)
+            return GasPvtApproach::Co2Gas;
+        else if constexpr (std::is_same_v<PvtImpl, H2GasPvt<Scalar>>)
+            return GasPvtApproach::H2Gas;
+        else
+            return GasPvtApproach::NoGas;
+    }
+
     // get the parameter object for the dry gas case
     template <GasPvtApproach approachV>
     typename std::enable_if<approachV == GasPvtApproach::DryGas, DryGasPvt<Scalar> >::type& getRealPvt()
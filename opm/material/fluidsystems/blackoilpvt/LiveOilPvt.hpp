@@ -31,9 +31,12 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/PackedTabulatedFunctions.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -177,6 +180,29 @@ public:
         return invBo/invMuoBo;
     }
 
+    /*!
+     * \brief Returns the dynamic viscosities [Pa s] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i], at the pressure pressure[i] and with
+     * the gas dissolution factor Rs[i]. The tables of all regions are packed into a
+     * single buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void viscosities(const unsigned* regionIdx,
+                     const Evaluation* pressure,
+                     const Evaluation* Rs,
+                     Evaluation* values,
+                     std::size_t numCells) const
+    {
+        for (std::size_t i = 0; i < numCells; ++i) {
+            // ATTENTION: Rs is the first axis!
+            const Evaluation& invBo = packedInverseOilBTable_.eval(regionIdx[i], Rs[i], pressure[i]);
+            const Evaluation& invMuoBo = packedInverseOilBMuTable_.eval(regionIdx[i], Rs[i], pressure[i]);
+
+            values[i] = invBo/invMuoBo;
+        }
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of the fluid phase given a set of parameters.
      */
@@ -205,6 +231,24 @@ public:
         return inverseOilBTable_[regionIdx].eval(Rs, pressure, /*extrapolate=*/true);
     }
 
+    /*!
+     * \brief Returns the inverse formation volume factors [-] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i], at the pressure pressure[i] and with
+     * the gas dissolution factor Rs[i]. The tables of all regions are packed into a
+     * single buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactors(const unsigned* regionIdx,
+                                       const Evaluation* pressure,
+                                       const Evaluation* Rs,
+                                       Evaluation* values,
+                                       std::size_t numCells) const
+    {
+        // ATTENTION: Rs is represented by the _first_ axis!
+        packedInverseOilBTable_.eval(regionIdx, Rs, pressure, values, numCells);
+    }
+
     /*!
      * \brief Returns the formation volume factor [-] of the fluid phase.
      */
@@ -369,6 +413,11 @@ private:
     std::vector<TabulatedOneDFunction> saturatedGasDissolutionFactorTable_;
     std::vector<TabulatedOneDFunction> saturationPressure_;
 
+    // copies of inverseOilBTable_ and inverseOilBMuTable_ for the batched
+    // evaluation
+    PackedUniformXTabulated2DFunctions<Scalar> packedInverseOilBTable_;
+    PackedUniformXTabulated2DFunctions<Scalar> packedInverseOilBMuTable_;
+
     Scalar vapPar2_ = 0.0;
 };
 
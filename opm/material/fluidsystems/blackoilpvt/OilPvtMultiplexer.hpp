@@ -34,6 +34,8 @@
 #include "BrineCo2Pvt.hpp"
 #include "BrineH2Pvt.hpp"
 
+#include <type_traits>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -158,6 +160,14 @@ public:
      * This method assumes that the deck features valid DENSITY and PVTO/PVDO/PVCDO keywords.
      */
     void initFromState(const EclipseState& eclState, const Schedule& schedule);
+
+    /*!
+     * \brief Returns the approach which initFromState() selects for an ECL state.
+     *
+     * OilPvtApproach::NoOil is returned if the oil phase is inactive or if the deck does
+     * not specify a supported oil PVT model.
+     */
+    static OilPvtApproach chooseApproach(const EclipseState& eclState);
 #endif // HAVE_ECL_INPUT
 
 
@@ -315,6 +325,30 @@ public:
     OilPvtApproach approach() const
     { return approach_; }
 
+    /*!
+     * \brief Returns the approach which is implemented by a given PVT class.
+     *
+     * OilPvtApproach::NoOil is returned for classes which are not handled by the multiplexer.
+     */
+    template <class PvtImpl>
+    static constexpr OilPvtApproach approachOf()
+    {
+        if constexpr (std::is_same_v<PvtImpl, LiveOilPvt<Scalar>>)
+            return OilPvtApproach::LiveOil;
+        else if constexpr (std::is_same_v<PvtImpl, DeadOilPvt<Scalar>>)
+            return OilPvtApproach::DeadOil;
+        else if constexpr (std::is_same_v<PvtImpl, ConstantCompressibilityOilPvt<Scalar>>)
+            return OilPvtApproach::ConstantCompressibilityOil;
+        else if constexpr (std::is_same_v<PvtImpl, OilPvtThermal<Scalar>>)
+            return OilPvtApproach::ThermalOil;
+        else if constexpr (std::is_same_v<PvtImpl, BrineCo2Pvt<Scalar>>)
+            return OilPvtApproach::BrineCo2;
+        else if constexpr (std::is_same_v<PvtImpl, BrineH2Pvt<Scalar>>)
+            return OilPvtApproach::BrineH2;
+        else
+            return OilPvtApproach::NoOil;
+    }
+
     // get the concrete parameter object for the oil phase
     template <OilPvtApproach approachV>
     typename std::enable_if<approachV == OilPvtApproach::LiveOil, LiveOilPvt<Scalar> >::type& getRealPvt()
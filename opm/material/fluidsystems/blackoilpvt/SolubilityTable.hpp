@@ -0,0 +1,304 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::SolubilityTable
+ */
+#ifndef OPM_SOLUBILITY_TABLE_HPP
+#define OPM_SOLUBILITY_TABLE_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+namespace Opm {
+
+/*!
+ * \brief Parameters of the pre-tabulated gas dissolution factor of the
+ *        brine PVT classes for CO2 and H2 storage.
+ *
+ * The table covers the given temperature and pressure range. If the salt
+ * concentration is taken from the fluid state, the salinity (mass fraction)
+ * axis ranges from zero to maxSalinity.
+ *
+ * The interpolation error is measured at the centre of each cell of the
+ * table, and a cell is accepted if the error is below
+ * max(tolerance*|Rs|, absoluteTolerance). The number of sampling points per
+ * axis starts at initialSamples (initialSalinitySamples) and is doubled until
+ * all cells are accepted or until the next refinement would exceed
+ * maxSamples (maxSalinitySamples).
+ */
+template <class Scalar>
+struct SolubilityTableParameters
+{
+    Scalar minTemperature = 273.15 + 10.0;
+    Scalar maxTemperature = 273.15 + 200.0;
+    Scalar minPressure = 1e5;
+    Scalar maxPressure = 6e7;
+    Scalar maxSalinity = 0.25;
+    Scalar tolerance = 1e-3;
+    Scalar absoluteTolerance = 1e-6;
+    unsigned initialSamples = 17;
+    unsigned maxSamples = 257;
+    unsigned initialSalinitySamples = 5;
+    unsigned maxSalinitySamples = 33;
+};
+
+/*!
+ * \brief A gas dissolution factor which is tabulated in temperature,
+ *        pressure and salinity and evaluated by linear interpolation.
+ *
+ * The table replaces the evaluation of the solubility model within its
+ * range, except for the cells which did not meet the error bound at the
+ * finest resolution, e.g. where the model is not smooth because the
+ * dissolved mole fraction gets clamped. For states outside of the range or
+ * in such a cell, applies() returns false and the caller is expected to use
+ * the model instead.
+ */
+template <class Scalar>
+class SolubilityTable
+{
+public:
+    using Parameters = SolubilityTableParameters<Scalar>;
+
+    //! The measured accuracy of a table.
+    struct Report
+    {
+        unsigned numTemperatures = 0;
+        unsigned numPressures = 0;
+        unsigned numSalinities = 0;
+
+        //! The fraction of the cells which meet the error bound.
+        Scalar acceptedFraction = 0.0;
+
+        //! The largest error at the centres of the accepted cells, relative
+        //! to max(|Rs|, absoluteTolerance/tolerance).
+        Scalar maxRelativeError = 0.0;
+    };
+
+    /*!
+     * \brief Sample a function rs(T, p, salinity) on a uniform grid.
+     *
+     * If minSalinity equals maxSalinity, only this salinity is tabulated.
+     */
+    template <class RsFunction>
+    Report build(const Parameters& params,
+                 Scalar minSalinity,
+                 Scalar maxSalinity,
+                 const RsFunction& rs)
+    {
+        if (!(params.minTemperature < params.maxTemperature) ||
+            !(params.minPressure < params.maxPressure) ||
+            maxSalinity < minSalinity ||
+            !(params.tolerance > 0.0) ||
+            params.initialSamples < 2 ||
+            params.initialSalinitySamples < 2)
+        {
+            throw std::invalid_argument("Invalid range or resolution for the "
+                                        "tabulated gas dissolution factor");
+        }
+
+        const bool fixedSalinity = minSalinity == maxSalinity;
+        unsigned n = params.initialSamples;
+        unsigned nS = fixedSalinity ? 1 : params.initialSalinitySamples;
+        while (true) {
+            sample_(params, minSalinity, maxSalinity, nS, n, rs);
+            const Report report = check_(params, rs);
+            if (report.acceptedFraction == 1.0)
+                return report;
+
+            const bool refine = 2*n - 1 <= params.maxSamples;
+            const bool refineSalinity = !fixedSalinity && 2*nS - 1 <= params.maxSalinitySamples;
+            if (!refine && !refineSalinity)
+                return report;
+
+            n = refine ? 2*n - 1 : n;
+            nS = refineSalinity ? 2*nS - 1 : nS;
+        }
+    }
+
+    bool empty() const
+    { return slices_.empty(); }
+
+    /*!
+     * \brief Returns true if the table can be used for a state.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature,
+                 const Evaluation& pressure,
+                 const Evaluation& salinity) const
+    {
+        if (slices_.empty())
+            return false;
+
+        const Scalar T = scalarValue(temperature);
+        const Scalar p = scalarValue(pressure);
+        const Scalar S = scalarValue(salinity);
+        if (slices_.size() == 1) {
+            if (S != minSalinity_)
+                return false;
+        }
+        else if (!(minSalinity_ <= S && S <= maxSalinity_))
+            return false;
+
+        const auto& front = slices_.front();
+        if (!front.applies(T, p))
+            return false;
+
+        return accepted_[cellIndex_(segmentIndex_(front.xToI(T), front.numX()),
+                                    segmentIndex_(front.yToJ(p), front.numY()),
+                                    salinitySegment_(S))];
+    }
+
+    /*!
+     * \brief Evaluate the table for a state for which applies() is true.
+     */
+    template <class Evaluation>
+    Evaluation eval(const Evaluation& temperature,
+                    const Evaluation& pressure,
+                    const Evaluation& salinity) const
+    {
+        if (slices_.size() == 1)
+            return slices_.front().eval(temperature, pressure, /*extrapolate=*/false);
+
+        const unsigned k = salinitySegment_(scalarValue(salinity));
+        const Evaluation beta = salinityToK_(salinity) - k;
+
+        const Evaluation& rs0 = slices_[k].eval(temperature, pressure, /*extrapolate=*/false);
+        const Evaluation& rs1 = slices_[k + 1].eval(temperature, pressure, /*extrapolate=*/false);
+        return rs0*(1.0 - beta) + rs1*beta;
+    }
+
+private:
+    template <class RsFunction>
+    void sample_(const Parameters& params,
+                 Scalar minSalinity,
+                 Scalar maxSalinity,
+                 unsigned numSalinities,
+                 unsigned n,
+                 const RsFunction& rs)
+    {
+        minSalinity_ = minSalinity;
+        maxSalinity_ = maxSalinity;
+        slices_.assign(numSalinities,
+                       UniformTabulated2DFunction<Scalar>(params.minTemperature, params.maxTemperature, n,
+                                                          params.minPressure, params.maxPressure, n));
+
+        for (unsigned k = 0; k < numSalinities; ++k) {
+            auto& slice = slices_[k];
+            const Scalar S = salinityAt_(k);
+            for (unsigned i = 0; i < n; ++i)
+                for (unsigned j = 0; j < n; ++j)
+                    slice.setSamplePoint(i, j, rs(slice.iToX(i), slice.jToY(j), S));
+        }
+    }
+
+    // compare the table against the function at the centres of all cells
+    template <class RsFunction>
+    Report check_(const Parameters& params, const RsFunction& rs)
+    {
+        const auto& front = slices_.front();
+        const unsigned n = front.numX();
+        const unsigned m = front.numY();
+        const unsigned numSalinityCells = std::max<unsigned>(slices_.size() - 1, 1);
+        const Scalar dT = (front.xMax() - front.xMin())/(n - 1);
+        const Scalar dp = (front.yMax() - front.yMin())/(m - 1);
+        const Scalar rsFloor = params.absoluteTolerance/params.tolerance;
+
+        Report report;
+        report.numTemperatures = n;
+        report.numPressures = m;
+        report.numSalinities = slices_.size();
+
+        accepted_.assign((n - 1)*(m - 1)*numSalinityCells, false);
+        std::size_t numAccepted = 0;
+        for (unsigned k = 0; k < numSalinityCells; ++k) {
+            const Scalar S = slices_.size() == 1
+                ? minSalinity_
+                : (salinityAt_(k) + salinityAt_(k + 1))/2;
+            for (unsigned i = 0; i + 1 < n; ++i) {
+                for (unsigned j = 0; j + 1 < m; ++j) {
+                    const Scalar T = front.iToX(i) + dT/2;
+                    const Scalar p = front.jToY(j) + dp/2;
+                    const Scalar exact = rs(T, p, S);
+                    const Scalar error = std::abs(eval(T, p, S) - exact)/std::max(std::abs(exact), rsFloor);
+
+                    // this is false for non-finite values
+                    if (error <= params.tolerance) {
+                        accepted_[cellIndex_(i, j, k)] = true;
+                        report.maxRelativeError = std::max(report.maxRelativeError, error);
+                        ++numAccepted;
+                    }
+                }
+            }
+        }
+
+        report.acceptedFraction = static_cast<Scalar>(numAccepted)/accepted_.size();
+        return report;
+    }
+
+    template <class Evaluation>
+    static unsigned segmentIndex_(const Evaluation& alpha, unsigned numSamples)
+    {
+        return static_cast<unsigned>(std::clamp(static_cast<int>(scalarValue(alpha)),
+                                                0, static_cast<int>(numSamples) - 2));
+    }
+
+    template <class Evaluation>
+    Evaluation salinityToK_(const Evaluation& salinity) const
+    { return (salinity - minSalinity_)/(maxSalinity_ - minSalinity_)*(slices_.size() - 1); }
+
+    unsigned salinitySegment_(Scalar salinity) const
+    {
+        if (slices_.size() == 1)
+            return 0;
+        return segmentIndex_(salinityToK_(salinity), slices_.size());
+    }
+
+    std::size_t cellIndex_(unsigned i, unsigned j, unsigned k) const
+    {
+        const auto& front = slices_.front();
+        return (static_cast<std::size_t>(k)*(front.numX() - 1) + i)*(front.numY() - 1) + j;
+    }
+
+    Scalar salinityAt_(unsigned k) const
+    {
+        if (slices_.size() == 1)
+            return minSalinity_;
+        return minSalinity_ + k*(maxSalinity_ - minSalinity_)/(slices_.size() - 1);
+    }
+
+    Scalar minSalinity_ = 0.0;
+    Scalar maxSalinity_ = 0.0;
+    std::vector<UniformTabulated2DFunction<Scalar>> slices_;
+    std::vector<bool> accepted_;
+};
+
+} // namespace Opm
+
+#endif
@@ -33,6 +33,8 @@
 #include "BrineCo2Pvt.hpp"
 #include "BrineH2Pvt.hpp"
 
+#include <type_traits>
+
 #define OPM_WATER_PVT_MULTIPLEXER_CALL(codeToCall)                      \
     switch (approach_) {                                                \
     case WaterPvtApproach::ConstantCompressibilityWater: {           \
@@ -139,6 +141,14 @@ public:
      * This method assumes that the deck features valid DENSITY and PVDG keywords.
      */
     void initFromState(const EclipseState& eclState, const Schedule& schedule);
+
+    /*!
+     * \brief Returns the approach which initFromState() selects for an ECL state.
+     *
+     * WaterPvtApproach::NoWater is returned if the water phase is inactive or if the deck does
+     * not specify a supported water PVT model.
+     */
+    static WaterPvtApproach chooseApproach(const EclipseState& eclState);
 #endif // HAVE_ECL_INPUT
 
     void initEnd()
@@ -304,6 +314,28 @@ public:
     WaterPvtApproach approach() const
     { return approach_; }
 
+    /*!
+     * \brief Returns the approach which is implemented by a given PVT class.
+     *
+     * WaterPvtApproach::NoWater is returned for classes which are not handled by the multiplexer.
+     */
+    template <class PvtImpl>
+    static constexpr WaterPvtApproach approachOf()
+    {
+        if constexpr (std::is_same_v<PvtImpl, ConstantCompressibilityWaterPvt<Scalar>>)
+            return WaterPvtApproach::ConstantCompressibilityWater;
+        else if constexpr (std::is_same_v<PvtImpl, ConstantCompressibilityBrinePvt<Scalar>>)
+            return WaterPvtApproach::ConstantCompressibilityBrine;
+        else if constexpr (std::is_same_v<PvtImpl, WaterPvtThermal<Scalar, enableBrine>>)
+            return WaterPvtApproach::ThermalWater;
+        else if constexpr (std::is_same_v<PvtImpl, BrineCo2Pvt<Scalar>>)
+            return WaterPvtApproach::BrineCo2;
+        else if constexpr (std::is_same_v<PvtImpl, BrineH2Pvt<Scalar>>)
+            return WaterPvtApproach::BrineH2;
+        else
+            return WaterPvtApproach::NoWater;
+    }
+
     // get the concrete parameter object for the water phase
     template <WaterPvtApproach approachV>
     typename std::enable_if<approachV == WaterPvtApproach::ConstantCompressibilityWater, ConstantCompressibilityWaterPvt<Scalar> >::type& getRealPvt()
@@ -31,9 +31,12 @@
 #include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/PackedTabulatedFunctions.hpp>
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/Tabulated1DFunction.hpp>
 
+#include <cstddef>
+
 namespace Opm {
 
 #if HAVE_ECL_INPUT
@@ -180,6 +183,28 @@ public:
         return invBg/invMugBg;
     }
 
+    /*!
+     * \brief Returns the dynamic viscosities [Pa s] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i], at the pressure pressure[i] and with
+     * the oil vaporization factor Rv[i]. The tables of all regions are packed into a
+     * single buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void viscosities(const unsigned* regionIdx,
+                     const Evaluation* pressure,
+                     const Evaluation* Rv,
+                     Evaluation* values,
+                     std::size_t numCells) const
+    {
+        for (std::size_t i = 0; i < numCells; ++i) {
+            const Evaluation& invBg = packedInverseGasB_.eval(regionIdx[i], pressure[i], Rv[i]);
+            const Evaluation& invMugBg = packedInverseGasBMu_.eval(regionIdx[i], pressure[i], Rv[i]);
+
+            values[i] = invBg/invMugBg;
+        }
+    }
+
     /*!
      * \brief Returns the dynamic viscosity [Pa s] of oil saturated gas at a given pressure.
      */
@@ -205,6 +230,21 @@ public:
                                             const Evaluation& /*Rvw*/) const
     { return inverseGasB_[regionIdx].eval(pressure, Rv, /*extrapolate=*/true); }
 
+    /*!
+     * \brief Returns the inverse formation volume factors [-] of a batch of cells.
+     *
+     * Cell i is in PVT region regionIdx[i], at the pressure pressure[i] and with
+     * the oil vaporization factor Rv[i]. The tables of all regions are packed into a
+     * single buffer by initEnd(), which must have been called before.
+     */
+    template <class Evaluation>
+    void inverseFormationVolumeFactors(const unsigned* regionIdx,
+                                       const Evaluation* pressure,
+                                       const Evaluation* Rv,
+                                       Evaluation* values,
+                                       std::size_t numCells) const
+    { packedInverseGasB_.eval(regionIdx, pressure, Rv, values, numCells); }
+
     /*!
      * \brief Returns the formation volume factor [-] of oil saturated gas at a given pressure.
      */
@@ -395,6 +435,10 @@ private:
     std::vector<TabulatedOneDFunction> saturatedOilVaporizationFactorTable_;
     std::vector<TabulatedOneDFunction> saturationPressure_;
 
+    // copies of inverseGasB_ and inverseGasBMu_ for the batched evaluation
+    PackedUniformXTabulated2DFunctions<Scalar> packedInverseGasB_;
+    PackedUniformXTabulated2DFunctions<Scalar> packedInverseGasBMu_;
+
     Scalar vapPar1_ = 0.0;
 };
 
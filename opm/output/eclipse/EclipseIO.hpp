@@ -22,6 +22,7 @@
 #ifndef OPM_ECLIPSE_WRITER_HPP
 #define OPM_ECLIPSE_WRITER_HPP
 
+#include <cstddef>
 #include <map>
 #include <memory>
 #include <string>
@@ -64,7 +65,8 @@ public:
                const Schedule& schedule,
                const SummaryConfig& summary_config,
                const std::string& basename = "",
-               const bool writeEsmry = false
+               const bool writeEsmry = false,
+               const bool writeCsmry = false
              );
 
 
@@ -190,6 +192,55 @@ public:
                         RestartValue value,
                         const bool write_double = false);
 
+    /*!
+     * \brief Perform file output on a background thread.
+     *
+     * Once enabled, writeInitial() and writeTimeStep() only take copies of
+     * their arguments and return, while a dedicated thread writes the
+     * INIT, EGRID, summary, restart and RFT files in order of submission.
+     * The reports requested by RPTSCHED are still generated on the calling
+     * thread.
+     *
+     * The output thread works on a copy of the Schedule, taken by the
+     * first output call after enabling.  The copy is shared by all
+     * following output steps until scheduleChanged() is called, so a
+     * Schedule updated e.g. by ACTIONX must be announced through that
+     * function before the next output call.  The EclipseState is used by
+     * reference and must not change until flushOutput() has returned.
+     *
+     * Messages logged while writing the files are passed to OpmLog on the
+     * calling thread by the next call to writeTimeStep() or flushOutput().
+     *
+     * At most maxPendingSteps calls may be waiting for the output thread.
+     * Further calls block until the output of the oldest pending call has
+     * started, which bounds the memory used for the copies.
+     *
+     * An exception thrown during background output is rethrown from the
+     * next call to writeTimeStep() or flushOutput(), and any output still
+     * pending at that time is discarded.
+     */
+    void enableAsyncOutput(std::size_t maxPendingSteps = 1);
+
+    /*!
+     * \brief Wait until all pending output has been written.
+     *
+     * Does nothing unless enableAsyncOutput() has been called.  Must be
+     * called before reading the output files or inspecting the summary()
+     * object in another way than through this class.
+     */
+    void flushOutput();
+
+    /*!
+     * \brief Announce that the Schedule has been changed, e.g. by
+     *        Schedule::applyAction().
+     *
+     * The next output call takes a new copy of the Schedule for the
+     * output thread.  Output steps queued earlier keep using the Schedule
+     * as it was when they were queued.  Does nothing unless
+     * enableAsyncOutput() has been called.
+     */
+    void scheduleChanged();
+
 
     /*
       Will load solution data and wellstate from the restart
@@ -64,7 +64,8 @@ public:
             const EclipseGrid&   grid,
             const Schedule&      sched,
             const std::string&   basename = "",
-            const bool           writeEsmry = false);
+            const bool           writeEsmry = false,
+            const bool           writeCsmry = false);
 
     ~Summary();
 
@@ -86,6 +87,16 @@ public:
 
     void write(const bool is_final_summary = false) const;
 
+    /// Set the smallest number of evaluators which are worth a thread of
+    /// their own in eval().  Defaults to 512.  Lowering it lets small
+    /// cases, e.g. in tests, exercise the concurrent evaluation.
+    void setMinEvaluatorsPerRange(const std::size_t count);
+
+    /// Number of ranges the concurrently evaluated vectors were split into
+    /// by the last call to eval().  One if they were evaluated on the
+    /// calling thread only.
+    std::size_t numEvaluationRanges() const;
+
 private:
     class SummaryImplementation;
     std::unique_ptr<SummaryImplementation> pImpl_;
@@ -21,6 +21,7 @@
 #include <opm/common/OpmLog/Logger.hpp>
 #include <opm/common/OpmLog/StreamLog.hpp>
 #include <iostream>
+#include <utility>
 #include <errno.h>  // For errno
 #include <stdio.h>  // For fileno() and stdout
 
@@ -38,6 +39,13 @@
 #include <unistd.h> // For isatty()
 #endif
 
+namespace {
+
+    // Target of the innermost OpmLog::DeferMessages on this thread, if any.
+    thread_local std::vector<Opm::OpmLog::DeferredMessage>* deferredMessages = nullptr;
+
+}
+
 namespace Opm {
 
     bool OpmLog::stdoutIsTerminal()
@@ -63,17 +71,34 @@ namespace Opm {
 
 
     void OpmLog::addMessage(int64_t messageFlag , const std::string& message) {
-        if (m_logger)
-            m_logger->addMessage( messageFlag , message );
+        addTaggedMessage( messageFlag, "", message );
     }
 
 
     void OpmLog::addTaggedMessage(int64_t messageFlag, const std::string& tag, const std::string& message) {
-        if (m_logger)
+        if (deferredMessages != nullptr)
+            deferredMessages->push_back( DeferredMessage{ messageFlag, tag, message } );
+        else if (m_logger)
             m_logger->addTaggedMessage( messageFlag, tag, message );
     }
 
 
+    OpmLog::DeferMessages::DeferMessages(std::vector<DeferredMessage>& messages)
+        : previous_( std::exchange(deferredMessages, &messages) )
+    {}
+
+
+    OpmLog::DeferMessages::~DeferMessages() {
+        deferredMessages = this->previous_;
+    }
+
+
+    void OpmLog::addDeferredMessages(const std::vector<DeferredMessage>& messages) {
+        for (const auto& message : messages)
+            addTaggedMessage( message.flag, message.tag, message.text );
+    }
+
+
     void OpmLog::info(const std::string& message)
     {
         addMessage(Log::MessageType::Info, message);
@@ -17,31 +17,220 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <regex>
-
 #include <opm/common/utility/shmatch.hpp>
 
+#include <algorithm>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace {
 
-bool Opm::shmatch(const std::string& pattern, const std::string& symbol) {
-    // Shell patterns should implicitly be interpreted as anchored at beginning
-    // and end.
-    std::string re_pattern = "^" + pattern + "$";
+    // Number of compiled patterns kept per thread by shmatch().
+    constexpr std::size_t pattern_cache_size = 32;
 
+    const Opm::ShellPattern& cached_pattern(const std::string& pattern)
     {
-        // Shell wildcard '*' should be regular expression arbitrary character '.'
-        // repeated arbitrary number of times '*'
-        std::regex re("\\*");
-        re_pattern = std::regex_replace(re_pattern, re, ".*");
+        thread_local std::list<Opm::ShellPattern> cache;
+
+        auto iter = std::find_if(cache.begin(), cache.end(),
+                                 [&pattern](const Opm::ShellPattern& compiled)
+                                 { return compiled.pattern() == pattern; });
+
+        if (iter != cache.end()) {
+            cache.splice(cache.begin(), cache, iter);
+            return cache.front();
+        }
+
+        if (cache.size() == pattern_cache_size)
+            cache.pop_back();
+
+        cache.emplace_front(pattern);
+        return cache.front();
     }
 
+    // Parse the set starting at pattern[pos], just after the '['.  Returns
+    // the position after the closing ']', or npos if there is no closing
+    // ']' in which case the '[' is an ordinary character.
+    std::size_t parse_set(const std::string& pattern, std::size_t pos, std::bitset<256>& set)
     {
-        // Shell wildcard '?' should be regular expression one arbitrary character
-        // '.'
-        std::regex re("\\?");
-        re_pattern = std::regex_replace(re_pattern, re, ".");
+        auto negate = false;
+        if ((pos < pattern.size()) && ((pattern[pos] == '!') || (pattern[pos] == '^'))) {
+            negate = true;
+            ++pos;
+        }
+
+        const auto first = pos;
+        while (pos < pattern.size()) {
+            const auto c = static_cast<unsigned char>(pattern[pos]);
+            if ((c == ']') && (pos > first)) {
+                if (negate)
+                    set.flip();
+
+                return pos + 1;
+            }
+
+            if ((pos + 2 < pattern.size()) && (pattern[pos + 1] == '-') && (pattern[pos + 2] != ']')) {
+                const auto last = static_cast<unsigned char>(pattern[pos + 2]);
+                for (unsigned int r = c; r <= last; ++r)
+                    set.set(r);
+
+                pos += 3;
+            }
+            else {
+                set.set(c);
+                ++pos;
+            }
+        }
+
+        return std::string::npos;
     }
 
-    std::regex regexp(re_pattern);
-    return std::regex_search(symbol, regexp);
+} // Anonymous namespace
+
+namespace Opm {
+
+ShellPattern::ShellPattern(const std::string& pattern)
+    : m_pattern(pattern)
+{
+    auto has_wildcard = false;
+    auto trailing_star = false;
+
+    std::size_t pos = 0;
+    while (pos < pattern.size()) {
+        const auto c = pattern[pos];
+        trailing_star = false;
+
+        if (c == '*') {
+            // Consecutive '*' are equivalent to one.
+            if (this->m_tokens.empty() || (this->m_tokens.back().kind != Kind::AnySequence))
+                this->m_tokens.push_back({ Kind::AnySequence, '\0', 0 });
+
+            has_wildcard = true;
+            trailing_star = true;
+            ++pos;
+        }
+        else if (c == '?') {
+            this->m_tokens.push_back({ Kind::AnyChar, '\0', 0 });
+            has_wildcard = true;
+            ++pos;
+        }
+        else if (c == '[') {
+            std::bitset<256> set;
+            const auto end = parse_set(pattern, pos + 1, set);
+            if (end == std::string::npos) {
+                this->m_tokens.push_back({ Kind::Char, c, 0 });
+                ++pos;
+            }
+            else {
+                this->m_tokens.push_back({ Kind::CharSet, '\0', this->m_sets.size() });
+                this->m_sets.push_back(set);
+                has_wildcard = true;
+                pos = end;
+            }
+        }
+        else if ((c == '\\') && (pos + 1 < pattern.size())) {
+            this->m_tokens.push_back({ Kind::Char, pattern[pos + 1], 0 });
+            pos += 2;
+        }
+        else {
+            this->m_tokens.push_back({ Kind::Char, c, 0 });
+            ++pos;
+        }
+    }
+
+    const auto literal_prefix = std::all_of(this->m_tokens.begin(),
+                                            this->m_tokens.end() - (trailing_star ? 1 : 0),
+                                            [](const Token& token) { return token.kind == Kind::Char; });
+
+    if (literal_prefix && (!has_wildcard || trailing_star)) {
+        this->m_literal = !has_wildcard;
+        this->m_prefix = trailing_star;
+
+        for (const auto& token : this->m_tokens) {
+            if (token.kind == Kind::Char)
+                this->m_text.push_back(token.ch);
+        }
+    }
 }
 
+bool ShellPattern::match_token(const Token& token, const char c) const
+{
+    switch (token.kind) {
+    case Kind::Char:
+        return token.ch == c;
+
+    case Kind::AnyChar:
+        return true;
+
+    case Kind::CharSet:
+        return this->m_sets[token.set].test(static_cast<unsigned char>(c));
+
+    case Kind::AnySequence:
+        break;
+    }
+
+    return false;
+}
+
+bool ShellPattern::match(const std::string& symbol) const
+{
+    if (this->m_literal)
+        return symbol == this->m_text;
+
+    if (this->m_prefix)
+        return symbol.compare(0, this->m_text.size(), this->m_text) == 0;
+
+    // All tokens except '*' consume exactly one character, so it is
+    // sufficient to backtrack to the most recent '*'.
+    const auto num_tokens = this->m_tokens.size();
+    std::size_t t = 0;
+    std::size_t s = 0;
+    auto star_token = num_tokens;
+    std::size_t star_symbol = 0;
+
+    while (s < symbol.size()) {
+        if ((t < num_tokens) && (this->m_tokens[t].kind == Kind::AnySequence)) {
+            star_token = t++;
+            star_symbol = s;
+        }
+        else if ((t < num_tokens) && this->match_token(this->m_tokens[t], symbol[s])) {
+            ++t;
+            ++s;
+        }
+        else if (star_token < num_tokens) {
+            t = star_token + 1;
+            s = ++star_symbol;
+        }
+        else
+            return false;
+    }
+
+    while ((t < num_tokens) && (this->m_tokens[t].kind == Kind::AnySequence))
+        ++t;
+
+    return t == num_tokens;
+}
+
+std::vector<std::size_t> ShellPattern::match(const std::vector<std::string>& names) const
+{
+    std::vector<std::size_t> indices;
+    for (std::size_t i = 0; i < names.size(); ++i) {
+        if (this->match(names[i]))
+            indices.push_back(i);
+    }
+
+    return indices;
+}
+
+bool shmatch(const std::string& pattern, const std::string& symbol)
+{
+    return cached_pattern(pattern).match(symbol);
+}
+
+std::vector<std::size_t> shmatch(const std::string& pattern, const std::vector<std::string>& names)
+{
+    return ShellPattern(pattern).match(names);
+}
+
+}
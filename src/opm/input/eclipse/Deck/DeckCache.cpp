@@ -0,0 +1,389 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Deck/DeckCache.hpp>
+
+#include "project-version.h"
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+#include <opm/common/utility/Fnv1aHash.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Deck/DeckKeyword.hpp>
+#include <opm/input/eclipse/Deck/DeckTree.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <set>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr std::string_view cache_magic = "OPMDECKCACHE";
+
+// Layout of the cache file. Must be incremented whenever the file layout
+// or the serialization of any of the deck objects changes, since builds
+// with the same PROJECT_VERSION, e.g. all debug builds, would otherwise
+// read each other's incompatible cache files.
+constexpr std::uint32_t cache_version = 3;
+
+// Algorithm of all hashes stored in the cache file: 1 = 64 bit FNV-1a.
+constexpr std::uint32_t hash_algorithm = 1;
+
+const Opm::Serialization::MemPacker mem_packer{};
+
+/*
+  Serializer writing and reading length prefixed blocks. Every keyword is
+  serialized as a separate block, since the buffer position used by the
+  Serializer is limited to INT_MAX.
+*/
+class BlockSerializer : public Opm::Serializer<Opm::Serialization::MemPacker> {
+public:
+    BlockSerializer()
+        : Opm::Serializer<Opm::Serialization::MemPacker>(mem_packer)
+    {}
+
+    template <class T>
+    void write(std::ostream& os, const T& data)
+    {
+        this->m_op = Operation::PACKSIZE;
+        this->m_packSize = 0;
+        (*this)(data);
+
+        if (this->m_packSize > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+            throw std::length_error("Object too large for the deck cache");
+
+        this->m_position = 0;
+        this->m_buffer.resize(this->m_packSize);
+        this->m_op = Operation::PACK;
+        (*this)(data);
+
+        const std::uint64_t size = this->m_buffer.size();
+        os.write(reinterpret_cast<const char*>(&size), sizeof size);
+        os.write(this->m_buffer.data(), size);
+    }
+
+    template <class T>
+    bool read(std::istream& is, T& data)
+    {
+        std::uint64_t size = 0;
+        is.read(reinterpret_cast<char*>(&size), sizeof size);
+        if (!is || (size > static_cast<std::uint64_t>(std::numeric_limits<int>::max())))
+            return false;
+
+        this->m_buffer.resize(size);
+        is.read(this->m_buffer.data(), size);
+        if (!is)
+            return false;
+
+        this->unpack(data);
+        return this->position() == static_cast<std::size_t>(size);
+    }
+};
+
+struct FileStamp {
+    std::string path;
+    std::uintmax_t size = 0;
+    std::uint64_t hash = 0;
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(path);
+        serializer(size);
+        serializer(hash);
+    }
+};
+
+// The file is hashed in chunks, so large include files, e.g. of ZCORN
+// data, are never held in memory as a whole.
+std::uint64_t content_hash(const fs::path& fname)
+{
+    std::ifstream is(fname, std::ios::binary);
+    if (!is)
+        throw std::runtime_error("Could not open " + fname.string() + " for reading");
+
+    Opm::Fnv1aHash hasher;
+    std::vector<char> chunk(std::size_t{1} << 16);
+    while (is) {
+        is.read(chunk.data(), chunk.size());
+        hasher.update(chunk.data(), static_cast<std::size_t>(is.gcount()));
+    }
+
+    if (!is.eof())
+        throw std::runtime_error("Failed reading " + fname.string());
+
+    return hasher.value();
+}
+
+FileStamp make_stamp(const std::string& fname)
+{
+    return { fname, fs::file_size(fname), content_hash(fname) };
+}
+
+bool valid_stamp(const FileStamp& stamp)
+{
+    std::error_code ec;
+    const auto size = fs::file_size(stamp.path, ec);
+    if (ec || (size != stamp.size))
+        return false;
+
+    return content_hash(stamp.path) == stamp.hash;
+}
+
+std::uint64_t context_hash(const Opm::ParseContext& parseContext)
+{
+    std::string settings;
+    for (const auto& [key, action] : parseContext)
+        settings += fmt::format("{}={};", key, static_cast<int>(action));
+
+    for (const auto& keyword : parseContext.ignoredKeywords())
+        settings += fmt::format("!{};", keyword);
+
+    return Opm::Fnv1aHash::hash(settings);
+}
+
+/*
+  Everything besides the input files which determines the parsed deck:
+  the cache file format, the library version, the keyword definitions of
+  the Parser and the ParseContext settings. A cache file is only used if
+  all of these match.
+*/
+struct CacheKey {
+    std::uint32_t format = 0;
+    std::string version;
+    std::uint64_t parser_hash = 0;
+    std::uint64_t context_hash = 0;
+
+    CacheKey() = default;
+
+    CacheKey(const Opm::Parser& parser, const Opm::ParseContext& parseContext)
+        : format(cache_version)
+        , version(PROJECT_VERSION)
+        , parser_hash(parser.keywordHash())
+        , context_hash(::context_hash(parseContext))
+    {}
+
+    bool operator==(const CacheKey& other) const
+    {
+        return (this->format == other.format)
+            && (this->version == other.version)
+            && (this->parser_hash == other.parser_hash)
+            && (this->context_hash == other.context_hash);
+    }
+
+    template<class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(format);
+        serializer(version);
+        serializer(parser_hash);
+        serializer(context_hash);
+    }
+};
+
+/*
+  The input files of a deck are the data file and all INCLUDE files, as
+  recorded in the DeckTree, and the files referenced by keyword locations
+  which additionally covers files loaded with IMPORT.
+*/
+std::vector<FileStamp> input_stamps(const Opm::Deck& deck)
+{
+    std::set<std::string> files;
+    for (const auto& fname : deck.tree().files())
+        files.insert(fname);
+
+    for (const auto& keyword : deck) {
+        const auto& fname = keyword.location().filename;
+        std::error_code ec;
+        if (fs::is_regular_file(fname, ec))
+            files.insert(fs::canonical(fname).string());
+    }
+
+    std::vector<FileStamp> stamps;
+    for (const auto& fname : files)
+        stamps.push_back(make_stamp(fname));
+
+    return stamps;
+}
+
+}
+
+namespace Opm {
+
+DeckCache::DeckCache(const fs::path& directory_arg)
+    : directory(directory_arg)
+{}
+
+fs::path DeckCache::cacheFile(const std::string& dataFile) const
+{
+    const auto data_file = fs::canonical(dataFile);
+    const auto key = Fnv1aHash::hash(data_file.string());
+
+    return this->directory / fmt::format("{}-{:016x}.DECKCACHE", data_file.stem().string(), key);
+}
+
+std::optional<Deck> DeckCache::load(const Parser& parser,
+                                    const std::string& dataFile,
+                                    const ParseContext& parseContext) const
+{
+    const auto cache_file = this->cacheFile(dataFile);
+    std::ifstream is(cache_file, std::ios::binary);
+    if (!is)
+        return std::nullopt;
+
+    try {
+        std::string magic(cache_magic.size(), ' ');
+        std::uint32_t version = 0;
+        std::uint32_t algorithm = 0;
+        is.read(magic.data(), magic.size());
+        is.read(reinterpret_cast<char*>(&version), sizeof version);
+        is.read(reinterpret_cast<char*>(&algorithm), sizeof algorithm);
+        if (!is || (magic != cache_magic) || (version != cache_version) || (algorithm != hash_algorithm))
+            return std::nullopt;
+
+        BlockSerializer serializer;
+
+        CacheKey key;
+        std::vector<FileStamp> stamps;
+        if (!serializer.read(is, key) || !serializer.read(is, stamps))
+            return std::nullopt;
+
+        if (!(key == CacheKey(parser, parseContext)))
+            return std::nullopt;
+
+        for (const auto& stamp : stamps) {
+            if (!valid_stamp(stamp))
+                return std::nullopt;
+        }
+
+        std::string data_file;
+        UnitSystem default_units;
+        UnitSystem active_units;
+        DeckTree file_tree;
+        std::size_t num_keywords = 0;
+        if (!serializer.read(is, data_file) ||
+            !serializer.read(is, default_units) ||
+            !serializer.read(is, active_units) ||
+            !serializer.read(is, file_tree) ||
+            !serializer.read(is, num_keywords))
+            return std::nullopt;
+
+        Deck deck;
+        deck.setDataFile(data_file);
+        deck.tree() = file_tree;
+        deck.getDefaultUnitSystem() = default_units;
+        if (active_units.getType() != default_units.getType())
+            deck.selectActiveUnitSystem(active_units.getType());
+        deck.getActiveUnitSystem() = active_units;
+
+        for (std::size_t index = 0; index < num_keywords; ++index) {
+            DeckKeyword keyword;
+            if (!serializer.read(is, keyword))
+                return std::nullopt;
+
+            deck.addKeyword(std::move(keyword));
+        }
+
+        OpmLog::info(fmt::format("Loaded deck {} from cache file {}", dataFile, cache_file.string()));
+        return deck;
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(fmt::format("Ignoring invalid deck cache file {}: {}", cache_file.string(), e.what()));
+        return std::nullopt;
+    }
+}
+
+bool DeckCache::store(const Parser& parser,
+                      const Deck& deck,
+                      const ParseContext& parseContext) const
+{
+    fs::path tmp_file;
+    try {
+        const auto cache_file = this->cacheFile(deck.getDataFile());
+        tmp_file = cache_file;
+        tmp_file += ".tmp";
+
+        fs::create_directories(this->directory);
+        {
+            std::ofstream os(tmp_file, std::ios::binary);
+            if (!os)
+                throw std::runtime_error("Could not open " + tmp_file.string() + " for writing");
+
+            os.write(cache_magic.data(), cache_magic.size());
+            os.write(reinterpret_cast<const char*>(&cache_version), sizeof cache_version);
+            os.write(reinterpret_cast<const char*>(&hash_algorithm), sizeof hash_algorithm);
+
+            BlockSerializer serializer;
+            serializer.write(os, CacheKey(parser, parseContext));
+            serializer.write(os, input_stamps(deck));
+
+            serializer.write(os, deck.getDataFile());
+            serializer.write(os, deck.getDefaultUnitSystem());
+            serializer.write(os, deck.getActiveUnitSystem());
+            serializer.write(os, deck.tree());
+            serializer.write(os, deck.size());
+            for (const auto& keyword : deck)
+                serializer.write(os, keyword);
+
+            if (!os)
+                throw std::runtime_error("Failed writing " + tmp_file.string());
+        }
+
+        // Readers never see a partially written cache file.
+        fs::rename(tmp_file, cache_file);
+        return true;
+    }
+    catch (const std::exception& e) {
+        std::error_code ec;
+        if (!tmp_file.empty())
+            fs::remove(tmp_file, ec);
+        OpmLog::warning(fmt::format("Could not cache deck {}: {}", deck.getDataFile(), e.what()));
+        return false;
+    }
+}
+
+Deck DeckCache::parseFile(const Parser& parser,
+                          const std::string& dataFile,
+                          const ParseContext& parseContext,
+                          ErrorGuard& errors) const
+{
+    auto cached = this->load(parser, dataFile, parseContext);
+    if (cached.has_value())
+        return std::move(cached.value());
+
+    auto deck = parser.parseFile(dataFile, parseContext, errors);
+    this->store(parser, deck, parseContext);
+    return deck;
+}
+
+}
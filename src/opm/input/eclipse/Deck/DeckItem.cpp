@@ -526,6 +526,18 @@ void DeckItem::reserve_additionalRawString(std::size_t n)
     this->rsval.reserve(rsval.size() + n);
 }
 
+void DeckItem::reserve_additional(std::size_t n)
+{
+    if (this->type == get_type<int>())
+        this->ival.reserve(this->ival.size() + n);
+    else if (this->type == get_type<double>())
+        this->dval.reserve(this->dval.size() + n);
+    else
+        throw std::invalid_argument("DeckItem::reserve_additional: Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
+
+    this->value_status.reserve(this->value_status.size() + n);
+}
+
 /*
  * Explicit template instantiations. These must be manually maintained and
  * updated with changes in DeckItem so that code is emitted.
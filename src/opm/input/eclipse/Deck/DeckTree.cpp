@@ -18,6 +18,7 @@
 
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 
+#include <algorithm>
 #include <filesystem>
 
 namespace fs = std::filesystem;
@@ -98,4 +99,13 @@ bool DeckTree::has_include(const std::string& fname) const {
     return !node.include_files.empty();
 }
 
+std::vector<std::string> DeckTree::files() const {
+    std::vector<std::string> file_list;
+    for (const auto& [fname, _] : this->nodes)
+        file_list.push_back(fname);
+
+    std::sort(file_list.begin(), file_list.end());
+    return file_list;
+}
+
 }
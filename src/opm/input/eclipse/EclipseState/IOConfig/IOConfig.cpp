@@ -101,6 +101,8 @@ namespace Opm {
         result.m_nosim = true;
         result.m_base_name = "test3";
         result.ecl_compatible_rst = false;
+        result.compressed_output = true;
+        result.restart_index = true;
 
         return result;
     }
@@ -179,6 +181,26 @@ namespace Opm {
     }
 
 
+    bool IOConfig::getCompressedOutput() const {
+        return this->compressed_output;
+    }
+
+
+    void IOConfig::setCompressedOutput(bool compressed) {
+        this->compressed_output = compressed;
+    }
+
+
+    bool IOConfig::getRestartIndex() const {
+        return this->restart_index;
+    }
+
+
+    void IOConfig::setRestartIndex(bool index) {
+        this->restart_index = index;
+    }
+
+
     void IOConfig::overrideNOSIM(bool nosim) {
         m_nosim = nosim;
     }
@@ -298,7 +320,9 @@ namespace Opm {
                this->getOutputDir() == data.getOutputDir() &&
                this->initOnly() == data.initOnly() &&
                this->getBaseName() == data.getBaseName() &&
-               this->getEclCompatibleRST() == data.getEclCompatibleRST();
+               this->getEclCompatibleRST() == data.getEclCompatibleRST() &&
+               this->getCompressedOutput() == data.getCompressedOutput() &&
+               this->getRestartIndex() == data.getRestartIndex();
     }
 
 
@@ -1890,8 +1890,9 @@ const SummaryConfigNode& SummaryConfig::operator[](std::size_t index) const {
 
 
 bool SummaryConfig::match(const std::string& keywordPattern) const {
+    const ShellPattern matcher(keywordPattern);
     for (const auto& keyword : this->short_keywords) {
-        if (shmatch(keywordPattern, keyword))
+        if (matcher.match(keyword))
             return true;
     }
     return false;
@@ -1901,11 +1902,12 @@ SummaryConfig::keyword_list
 SummaryConfig::keywords(const std::string& keywordPattern) const
 {
     auto kw_list = keyword_list{};
+    const ShellPattern matcher(keywordPattern);
 
     std::copy_if(this->m_keywords.begin(), this->m_keywords.end(),
                  std::back_inserter(kw_list),
-                 [&keywordPattern](const auto& kw)
-                 { return shmatch(keywordPattern, kw.keyword()); });
+                 [&matcher](const auto& kw)
+                 { return matcher.match(kw.keyword()); });
 
     return kw_list;
 }
@@ -21,9 +21,11 @@
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
+#include <opm/common/utility/Fnv1aHash.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
@@ -47,6 +49,9 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+#include <opm/input/eclipse/Utility/Typetools.hpp>
+
 #include <opm/json/JsonObject.hpp>
 
 #include <opm/common/utility/String.hpp>
@@ -60,7 +65,9 @@
 #include <algorithm>
 #include <cctype>
 #include <cstdio>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <optional>
@@ -73,6 +80,15 @@
 
 #include <fmt/format.h>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace {
     /// \brief Whether a keyword is a global keyword.
     ///
@@ -284,13 +300,35 @@ inline bool getline( std::string_view& input, std::string_view& line ) {
     auto end = std::find( input.begin(), input.end(), '\n' );
 
     line = std::string_view( input.begin(), end - input.begin() );
-    input = std::string_view( end + 1, input.end() - (end + 1));
-    return true;
 
-    /* we know that we always append a newline onto the input string, so we can
-     * safely assume that end+1 will either be end-of-input (i.e. empty range)
-     * or the start of the next line
+    /* A newline is always appended to strings read into memory, but memory
+     * mapped input files need not end with a newline.
      */
+    if( end == input.end() )
+        input = std::string_view( end, 0 );
+    else
+        input = std::string_view( end + 1, input.end() - (end + 1));
+
+    return true;
+}
+
+/*
+ * Clean a single line of memory mapped input. Comments are overwritten with
+ * blanks in place, so that a record buffer spanning several lines of the
+ * mapped file never contains comment text. The returned view is trimmed for
+ * leading and trailing whitespace, as are the lines produced by clean().
+ */
+inline std::string_view clean_line( std::string_view line ) {
+    const auto content = strip_comments( line );
+    if( content.size() < line.size() ) {
+        /* the mapping is private and writable; only the pages containing
+         * comments will be copied by the kernel.
+         */
+        auto* comment = const_cast< char* >( line.data() ) + content.size();
+        std::fill( comment, comment + (line.size() - content.size()), ' ' );
+    }
+
+    return trim( content );
 }
 
 /*
@@ -424,23 +462,84 @@ inline bool isTerminatedRecordString(const std::string_view& line) {
 
 }
 
+/*
+ * Private, writable memory mapping of an input file. Pages are only copied
+ * when written to, i.e. when comments are blanked out by str::clean_line().
+ */
+class MappedFile {
+    public:
+        explicit MappedFile( const std::filesystem::path& p );
+        ~MappedFile();
+
+        MappedFile( const MappedFile& ) = delete;
+        MappedFile& operator=( const MappedFile& ) = delete;
+
+        bool is_open() const { return this->fd >= 0; }
+        std::string_view view() const { return { this->data, this->size }; }
+
+    private:
+        int fd = -1;
+        char* data = nullptr;
+        std::size_t size = 0;
+};
+
+MappedFile::MappedFile( const std::filesystem::path& p ) :
+    fd( ::open( p.c_str(), O_RDONLY ) )
+{
+    if( this->fd < 0 )
+        return;
+
+    struct stat st;
+    if( ::fstat( this->fd, &st ) != 0 )
+        throw std::runtime_error( "Error when reading input file '" + p.string() + "'" );
+
+    this->size = st.st_size;
+    if( this->size == 0 )
+        return;
+
+    auto* addr = ::mmap( nullptr, this->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, this->fd, 0 );
+    if( addr == MAP_FAILED )
+        throw std::runtime_error( "Error when memory mapping input file '" + p.string() + "'" );
+
+    ::madvise( addr, this->size, MADV_SEQUENTIAL );
+    this->data = static_cast< char* >( addr );
+}
+
+MappedFile::~MappedFile() {
+    if( this->data )
+        ::munmap( this->data, this->size );
+
+    if( this->fd >= 0 )
+        ::close( this->fd );
+}
+
+
 struct file {
-    file( std::filesystem::path p, const std::string& in ) :
-        input( in ), path( p )
+    file( std::filesystem::path p, std::string_view in, bool mapped = false ) :
+        input( in ), path( p ), lazy_clean( mapped )
     {}
 
     std::string_view input;
     size_t lineNR = 0;
     std::filesystem::path path;
+
+    /* Memory mapped files are cleaned line by line in getline(); since the
+     * returned lines are trimmed we need to remember where the most recent
+     * line started to support ungetline().
+     */
+    bool lazy_clean = false;
+    const char* line_begin = nullptr;
 };
 
 
 class InputStack : public std::stack< file, std::vector< file > > {
     public:
         void push( std::string&& input, std::filesystem::path p = "<memory string>" );
+        void push( std::unique_ptr< MappedFile > input, std::filesystem::path p );
 
     private:
         std::list< std::string > string_storage;
+        std::list< std::unique_ptr< MappedFile > > mapped_storage;
         using base = std::stack< file, std::vector< file > >;
 };
 
@@ -449,6 +548,11 @@ void InputStack::push( std::string&& input, std::filesystem::path p ) {
     this->emplace( p, this->string_storage.back() );
 }
 
+void InputStack::push( std::unique_ptr< MappedFile > input, std::filesystem::path p ) {
+    this->mapped_storage.push_back( std::move( input ) );
+    this->emplace( p, this->mapped_storage.back()->view(), true );
+}
+
 class ParserState {
     public:
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
@@ -457,10 +561,12 @@ class ParserState {
 
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
                      const ParseContext&, ErrorGuard&,
-                     std::filesystem::path, const std::set<Opm::Ecl::SectionType>& ignore = {});
+                     std::filesystem::path, const std::set<Opm::Ecl::SectionType>& ignore = {},
+                     bool memory_mapped = false);
 
         void loadString( const std::string& );
         void loadFile( const std::filesystem::path& );
+        bool mapFile( const std::filesystem::path& );
         void openRootFile( const std::filesystem::path& );
 
         void handleRandomText(const std::string_view& ) const;
@@ -480,6 +586,7 @@ class ParserState {
 
     private:
         const std::vector<std::pair<std::string, std::string>> code_keywords;
+        bool memory_mapped_input = false;
         InputStack input_stack;
 
         std::set<Opm::Ecl::SectionType> ignore_sections;
@@ -495,6 +602,7 @@ class ParserState {
         const ParseContext& parseContext;
         ErrorGuard& errors;
         bool unknown_keyword = false;
+        bool parallel_data_keywords = false;
 };
 
 const std::filesystem::path& ParserState::current_path() const {
@@ -516,9 +624,14 @@ bool ParserState::done() const {
 
 std::string_view ParserState::getline() {
     std::string_view ln;
+    auto& top = this->input_stack.top();
+
+    top.line_begin = top.input.data();
+    str::getline( top.input, ln );
+    top.lineNR++;
 
-    str::getline( this->input_stack.top().input, ln );
-    this->input_stack.top().lineNR++;
+    if (top.lazy_clean)
+        return str::clean_line( ln );
 
     return ln;
 }
@@ -526,12 +639,26 @@ std::string_view ParserState::getline() {
 
 
 void ParserState::ungetline(const std::string_view& line) {
-    auto& file_view = this->input_stack.top().input;
+    auto& top = this->input_stack.top();
+    auto& file_view = top.input;
+
+    if (top.lazy_clean) {
+        if ((top.line_begin == nullptr) ||
+            (line.data() < top.line_begin) ||
+            (line.data() + line.size() > file_view.data()))
+            throw std::invalid_argument("line view does not immediately proceed file_view");
+
+        file_view = std::string_view(top.line_begin, file_view.data() + file_view.size() - top.line_begin);
+        top.line_begin = nullptr;
+        top.lineNR--;
+        return;
+    }
+
     if (line.end() + 1 != file_view.begin())
         throw std::invalid_argument("line view does not immediately proceed file_view");
 
     file_view = std::string_view(line.begin(), file_view.end() - line.begin());
-    this->input_stack.top().lineNR--;
+    top.lineNR--;
 }
 
 
@@ -556,8 +683,10 @@ ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>
                           const ParseContext& context,
                           ErrorGuard& errors_arg,
                           std::filesystem::path p,
-                          const std::set<Opm::Ecl::SectionType>& ignore ) :
+                          const std::set<Opm::Ecl::SectionType>& ignore,
+                          bool memory_mapped ) :
     code_keywords(code_keywords_arg),
+    memory_mapped_input(memory_mapped),
     ignore_sections(ignore),
     rootPath( std::filesystem::canonical( p ).parent_path() ),
     python( std::make_unique<Python>() ),
@@ -570,28 +699,35 @@ ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>
 bool ParserState::check_section_keywords() {
 
     std::string_view root_file_str = this->input_stack.top().input;
+    std::string_view line;
 
     int n = 0;
-    auto p0 = root_file_str.find_first_not_of(" \t\n");
-
-    while (p0 != std::string::npos){
-
-        auto p1 = root_file_str.find_first_of(" \t\n", p0 + 1);
-
-        if (root_file_str.substr(p0, p1-p0) == "GRID")
-            n++;
-        else if (root_file_str.substr(p0, p1-p0) == "PROPS")
-            n++;
-        else if (root_file_str.substr(p0, p1-p0) == "REGIONS")
-            n++;
-        else if (root_file_str.substr(p0, p1-p0) == "SOLUTION")
-            n++;
-        else if (root_file_str.substr(p0, p1-p0) == "SUMMARY")
-            n++;
-        else if (root_file_str.substr(p0, p1-p0) == "SCHEDULE")
-            n++;
 
-        p0 = root_file_str.find_first_not_of(" \t\n", p1);
+    // Memory mapped input is not cleaned up front, so strip comments line
+    // by line before looking for the section keywords.
+    while (str::getline(root_file_str, line)) {
+        line = str::trim(str::strip_comments(line));
+
+        auto p0 = line.find_first_not_of(" \t");
+        while (p0 != std::string::npos){
+
+            auto p1 = line.find_first_of(" \t", p0 + 1);
+
+            if (line.substr(p0, p1-p0) == "GRID")
+                n++;
+            else if (line.substr(p0, p1-p0) == "PROPS")
+                n++;
+            else if (line.substr(p0, p1-p0) == "REGIONS")
+                n++;
+            else if (line.substr(p0, p1-p0) == "SOLUTION")
+                n++;
+            else if (line.substr(p0, p1-p0) == "SUMMARY")
+                n++;
+            else if (line.substr(p0, p1-p0) == "SCHEDULE")
+                n++;
+
+            p0 = line.find_first_not_of(" \t", p1);
+        }
     }
 
     if (n < 6)
@@ -604,8 +740,39 @@ void ParserState::loadString(const std::string& input) {
     this->input_stack.push( str::clean( this->code_keywords, input + "\n" ) );
 }
 
+/*
+ * Memory map the input file. Returns false if the file should instead be
+ * read into memory and cleaned up front; that is the case for empty files
+ * and files containing code keywords, whose code sections must be kept
+ * verbatim.
+ */
+bool ParserState::mapFile(const std::filesystem::path& inputFile) {
+    auto mapped = std::make_unique<MappedFile>( inputFile );
+
+    if( !mapped->is_open() ) {
+        std::string msg = "Could not read from file: " + inputFile.string();
+        parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
+        return true;
+    }
+
+    const auto input = mapped->view();
+    if( input.empty() )
+        return false;
+
+    for (const auto& code_pair : this->code_keywords) {
+        if (input.find(code_pair.first) != std::string_view::npos)
+            return false;
+    }
+
+    this->input_stack.push( std::move( mapped ), inputFile );
+    return true;
+}
+
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
 
+    if( this->memory_mapped_input && this->mapFile( inputFile ) )
+        return;
+
     const auto closer = []( std::FILE* f ) { std::fclose( f ); };
     std::unique_ptr< std::FILE, decltype( closer ) > ufp(
             std::fopen( inputFile.c_str(), "rb" ),
@@ -1088,8 +1255,145 @@ std::string_view advance_parser_state( ParserState& parserState, const std::stri
     return line;
 }
 
+/*
+ * Runs of consecutive data keywords, i.e. keywords like PORO, PERMX, SATNUM
+ * and ZCORN with a single item holding all the data, are converted from raw
+ * tokens to DeckKeyword instances in parallel and added to the deck in input
+ * order. Creating the raw keywords remains sequential, because the size of
+ * many keywords depends on keywords already in the deck.
+ */
+class DataKeywordBatch {
+public:
+    explicit DataKeywordBatch(std::size_t max_size_arg)
+        : max_size(max_size_arg)
+    {}
+
+    bool enabled() const { return this->max_size > 1; }
+    std::size_t size() const { return this->pending.size(); }
+
+    void add(std::unique_ptr<RawKeyword> rawKeyword,
+             const ParserKeyword& parserKeyword,
+             ParserState& parserState);
+
+    void flush(ParserState& parserState);
+
+private:
+    struct Entry {
+        std::unique_ptr<RawKeyword> rawKeyword;
+        const ParserKeyword* parserKeyword;
+        const UnitSystem* active_unitsystem;
+        const UnitSystem* default_unitsystem;
+    };
+
+    std::size_t max_size;
+    std::vector<Entry> pending;
+};
+
+void DataKeywordBatch::add(std::unique_ptr<RawKeyword> rawKeyword,
+                           const ParserKeyword& parserKeyword,
+                           ParserState& parserState)
+{
+    auto& active_unitsystem = parserState.deck.getActiveUnitSystem();
+    auto& default_unitsystem = parserState.deck.getDefaultUnitSystem();
+
+    // Perform the dimension lookups ParserItem::scan() will do on the
+    // deck's own unit systems here, so that new dimensions are registered
+    // and usage is accounted for on this thread only. The conversion
+    // itself operates on private copies of the unit systems.
+    std::size_t record_nr = 0;
+    for (auto it = rawKeyword->begin(); it != rawKeyword->end(); ++it, ++record_nr) {
+        for (const auto& parserItem : parserKeyword.getRecord(record_nr)) {
+            if ((parserItem.dataType() != type_tag::fdouble) &&
+                (parserItem.dataType() != type_tag::uda))
+                continue;
+
+            for (const auto& dim_string : parserItem.dimensions()) {
+                active_unitsystem.getNewDimension(dim_string);
+                default_unitsystem.getNewDimension(dim_string);
+            }
+        }
+    }
+
+    this->pending.push_back({ std::move(rawKeyword), &parserKeyword,
+                              &active_unitsystem, &default_unitsystem });
+
+    if (this->pending.size() >= this->max_size)
+        this->flush(parserState);
+}
+
+void DataKeywordBatch::flush(ParserState& parserState)
+{
+    if (this->pending.empty())
+        return;
+
+    // The only error a data record can raise through the ParseContext is
+    // PARSE_EXTRA_DATA, which the single data item makes impossible. All
+    // other errors are exceptions and are rethrown below in input order.
+    auto parseContext = parserState.parseContext;
+    parseContext.update(InputErrorAction::IGNORE);
+
+    const auto num_keywords = static_cast<int>(this->pending.size());
+    std::vector<std::optional<DeckKeyword>> keywords(num_keywords);
+    std::vector<std::exception_ptr> failures(num_keywords);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int index = 0; index < num_keywords; ++index) {
+        auto& entry = this->pending[index];
+        try {
+            ErrorGuard errors;
+            auto active_unitsystem = *entry.active_unitsystem;
+            auto default_unitsystem = *entry.default_unitsystem;
+
+            keywords[index].emplace(entry.parserKeyword->parse(parseContext,
+                                                               errors,
+                                                               *entry.rawKeyword,
+                                                               active_unitsystem,
+                                                               default_unitsystem));
+            errors.clear();
+        } catch (...) {
+            failures[index] = std::current_exception();
+        }
+    }
+
+    auto pending_keywords = std::move(this->pending);
+    this->pending.clear();
+
+    for (int index = 0; index < num_keywords; ++index) {
+        if (failures[index]) {
+            try {
+                std::rethrow_exception(failures[index]);
+            } catch (const OpmInputError& opm_error) {
+                throw;
+            } catch (const std::exception& e) {
+                const OpmInputError opm_error { e, pending_keywords[index].rawKeyword->location() } ;
+
+                OpmLog::error(opm_error.what());
+
+                std::throw_with_nested(opm_error);
+            }
+        }
+
+        parserState.deck.addKeyword(std::move(*keywords[index]));
+    }
+}
+
+std::size_t dataKeywordBatchSize(const ParserState& parserState)
+{
+    if (! parserState.parallel_data_keywords)
+        return 1;
+
+#ifdef _OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
 bool parseState( ParserState& parserState, const Parser& parser ) {
     std::string filename = parserState.current_path().string();
+    DataKeywordBatch dataKeywords( dataKeywordBatchSize(parserState) );
 
     auto ignore = parserState.get_ignore();
 
@@ -1127,11 +1431,15 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         if ((ignore_summary) && (keyw=="SUMMARY"))
             keyw = advance_parser_state( parserState, "SCHEDULE" );
 
-        if ((ignore_schedule) && (keyw=="SCHEDULE"))
+        if ((ignore_schedule) && (keyw=="SCHEDULE")) {
+            dataKeywords.flush( parserState );
             return true;
+        }
 
-        if (rawKeyword->getKeywordName() == Opm::RawConsts::end)
+        if (rawKeyword->getKeywordName() == Opm::RawConsts::end) {
+            dataKeywords.flush( parserState );
             return true;
+        }
 
         if (rawKeyword->getKeywordName() == Opm::RawConsts::endinclude) {
             parserState.closeFile();
@@ -1166,9 +1474,16 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
             const auto& parserKeyword = parser.getParserKeywordFromDeckName( kwname );
             {
                 const auto& location = rawKeyword->location();
-                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
+                auto msg = fmt::format("{:5} Reading {:<8} in {} line {}", parserState.deck.size() + dataKeywords.size(), rawKeyword->getKeywordName(), location.filename, location.lineno);
                 OpmLog::info(msg);
             }
+
+            if (dataKeywords.enabled() && parserKeyword.isDataKeyword()) {
+                dataKeywords.add( std::move(rawKeyword), parserKeyword, parserState );
+                continue;
+            }
+
+            dataKeywords.flush( parserState );
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
                     if (parserState.python) {
@@ -1221,6 +1536,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         }
     }
 
+    dataKeywords.flush( parserState );
     return true;
 }
 
@@ -1331,7 +1647,9 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         else
             data_file = std::filesystem::proximate( std::filesystem::canonical(dataFileName) );
 
-        ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections);
+        ParserState parserState( this->codeKeywords(), parseContext, errors, data_file, ignore_sections,
+                                 this->m_memory_mapped_input );
+        parserState.parallel_data_keywords = this->m_parallel_data_keywords;
         parseState( parserState, *this );
         return std::move( parserState.deck );
     }
@@ -1359,6 +1677,7 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
 
     Deck Parser::parseString(const std::string &data, const ParseContext& parseContext, ErrorGuard& errors) const {
         ParserState parserState( this->codeKeywords(), parseContext, errors );
+        parserState.parallel_data_keywords = this->m_parallel_data_keywords;
         parserState.loadString( data );
         parseState( parserState, *this );
         return std::move( parserState.deck );
@@ -1378,6 +1697,34 @@ bool parseState( ParserState& parserState, const Parser& parser ) {
         return m_deckParserKeywords.size();
     }
 
+    std::uint64_t Parser::keywordHash() const {
+        Fnv1aHash hasher;
+        for (const auto& keyword : this->keyword_storage) {
+            const auto code = keyword.createCode();
+            const std::uint64_t size = code.size();
+            hasher.update(&size, sizeof size);
+            hasher.update(code);
+        }
+
+        return hasher.value();
+    }
+
+    void Parser::setMemoryMappedInput(bool on) {
+        this->m_memory_mapped_input = on;
+    }
+
+    bool Parser::memoryMappedInput() const {
+        return this->m_memory_mapped_input;
+    }
+
+    void Parser::setParallelDataKeywords(bool on) {
+        this->m_parallel_data_keywords = on;
+    }
+
+    bool Parser::parallelDataKeywords() const {
+        return this->m_parallel_data_keywords;
+    }
+
     const ParserKeyword* Parser::matchingKeyword(const std::string_view& name) const {
         for (auto iter = m_wildCardKeywords.begin(); iter != m_wildCardKeywords.end(); ++iter) {
             if (iter->second->matches(name))
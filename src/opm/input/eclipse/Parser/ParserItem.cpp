@@ -17,8 +17,14 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
 #include <ostream>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
 #include <iomanip>
 #include <cmath>
 
@@ -455,11 +461,194 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+/*
+ * Position of the '*' in a "N*value" repeat token, i.e. the number of
+ * leading digits, or npos if the token is not a repeat token.
+ */
+std::size_t star_position( std::string_view token ) {
+    std::size_t pos = 0;
+    while( pos < token.size() && static_cast< unsigned char >( token[pos] - '0' ) < 10 )
+        ++pos;
+
+    return ( pos < token.size() && token[pos] == '*' ) ? pos : std::string_view::npos;
+}
+
+/*
+ * Repeat count of a "N*value" token, or zero if the count is not a plain
+ * positive integer; such tokens are left to StarToken.
+ */
+std::size_t star_count( std::string_view token, std::size_t star ) {
+    int count = 0;
+    const auto* end = token.data() + star;
+    const auto [ptr, ec] = std::from_chars( token.data(), end, count );
+    if( ec != std::errc{} || ptr != end || count < 1 )
+        return 0;
+
+    return count;
+}
+
+/*
+ * Convert a decimal number of at most 2^53 in its digits and a decimal
+ * exponent, after moving the decimal point to the end of the digits, of at
+ * most 22 in magnitude. Both the digits and the power of ten are exact
+ * doubles then, so the single multiplication or division below is
+ * correctly rounded. It is also the operation qi performs on such numbers,
+ * so the result is bit identical to readValueToken<double>(). Fortran 'D'
+ * exponents are accepted. Returns false for all other tokens, e.g. more
+ * digits, larger exponents, NaN or malformed numbers.
+ */
+bool read_exact_double( std::string_view token, double& value ) {
+    static constexpr double powers_of_ten[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    constexpr std::uint64_t max_digits = std::uint64_t{1} << 53;
+    constexpr int max_power = 22;
+
+    const auto* pos = token.data();
+    const auto* const end = pos + token.size();
+    auto is_digit = []( char c ) { return static_cast< unsigned char >( c - '0' ) < 10; };
+
+    const bool negative = ( pos != end ) && ( *pos == '-' );
+    if( ( pos != end ) && ( *pos == '-' || *pos == '+' ) )
+        ++pos;
+
+    std::uint64_t digits = 0;
+    int num_digits = 0;
+    int exponent = 0;
+    for( ; pos != end && is_digit( *pos ); ++pos, ++num_digits ) {
+        digits = 10 * digits + ( *pos - '0' );
+        if( digits > max_digits )
+            return false;
+    }
+
+    if( pos != end && *pos == '.' ) {
+        for( ++pos; pos != end && is_digit( *pos ); ++pos, ++num_digits, --exponent ) {
+            digits = 10 * digits + ( *pos - '0' );
+            if( digits > max_digits )
+                return false;
+        }
+    }
+
+    if( num_digits == 0 )
+        return false;
+
+    if( pos != end ) {
+        if( *pos != 'e' && *pos != 'E' && *pos != 'd' && *pos != 'D' )
+            return false;
+
+        ++pos;
+        const bool negative_exponent = ( pos != end ) && ( *pos == '-' );
+        if( ( pos != end ) && ( *pos == '-' || *pos == '+' ) )
+            ++pos;
+
+        if( pos == end )
+            return false;
+
+        int exponent_value = 0;
+        for( ; pos != end; ++pos ) {
+            if( !is_digit( *pos ) || exponent_value > 100 * max_power )
+                return false;
+            exponent_value = 10 * exponent_value + ( *pos - '0' );
+        }
+
+        exponent += negative_exponent ? -exponent_value : exponent_value;
+    }
+
+    if( exponent < -max_power || exponent > max_power )
+        return false;
+
+    const auto magnitude = ( exponent >= 0 )
+        ? static_cast< double >( digits ) * powers_of_ten[ exponent ]
+        : static_cast< double >( digits ) / powers_of_ten[ -exponent ];
+
+    value = negative ? -magnitude : magnitude;
+    return true;
+}
+
+/*
+ * Convert a plain number. Integers are converted with std::from_chars() and
+ * doubles with read_exact_double(); both give the same values as the
+ * general path. Anything these do not consume completely, e.g. an integer
+ * with a leading '+' or a double with many digits, is handed to
+ * readValueToken<T>().
+ */
+template< typename T >
+T read_number( std::string_view token ) {
+    if constexpr( std::is_same_v< T, int > ) {
+        T value{};
+        const auto* end = token.data() + token.size();
+        const auto [ptr, ec] = std::from_chars( token.data(), end, value );
+        if( ec == std::errc{} && ptr == end )
+            return value;
+    }
+    else if constexpr( std::is_same_v< T, double > ) {
+        T value{};
+        if( read_exact_double( token, value ) )
+            return value;
+    }
+
+    return readValueToken< T >( token );
+}
+
+/*
+ * Fast path for items holding all the numbers of a record, e.g. the data
+ * of ZCORN, PERMX or SATNUM. The total number of values, including the
+ * repeats of "N*value" tokens, is counted first so that the item storage is
+ * allocated once, and repeat tokens are expanded without creating any
+ * temporary strings.
+ */
+template< typename T >
+void scan_numeric_data( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
+    std::size_t num_values = 0;
+    for( std::size_t index = 0; index < record.size(); ++index ) {
+        const auto token = record.getItem( index );
+        const auto star = star_position( token );
+        num_values += ( star == std::string_view::npos ) ? 1 : std::max( star_count( token, star ), std::size_t{1} );
+    }
+    deck_item.reserve_additional( num_values );
+
+    while( record.size() > 0 ) {
+        const auto token = record.pop_front();
+        const auto star = star_position( token );
+
+        if( star == std::string_view::npos ) {
+            deck_item.push_back( read_number< T >( token ) );
+            continue;
+        }
+
+        auto count = star_count( token, star );
+        const auto value = token.substr( star + 1 );
+        if( count == 0 ) {
+            // Lone '*' or malformed count; StarToken does the validation.
+            count = StarToken( token ).count();
+        }
+
+        if( !value.empty() ) {
+            deck_item.push_back( read_number< T >( value ), count );
+            continue;
+        }
+
+        if (parser_item.hasDefault()) {
+            deck_item.push_backDefault( parser_item.getDefault< T >(), count );
+        } else {
+            deck_item.push_backDummyDefault<T>( count );
+        }
+    }
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
     bool parse_raw = parser_item.parseRaw();
 
     if( parser_item.sizeType() == ParserItem::item_size::ALL ) {
+        if constexpr( std::is_same_v< T, int > || std::is_same_v< T, double > ) {
+            if( !parse_raw ) {
+                scan_numeric_data< T >( deck_item, parser_item, record );
+                return;
+            }
+        }
+
         if (parse_raw) {
             deck_item.reserve_additionalRawString(record.size());
             while (record.size()) {
@@ -108,14 +108,6 @@
 #include <fmt/chrono.h>
 #include <fmt/format.h>
 
-namespace {
-
-    bool name_match(const std::string& pattern, const std::string& name) {
-        return Opm::shmatch(pattern, name);
-    }
-
-}
-
 namespace Opm {
 
     Schedule::Schedule( const Deck& deck,
@@ -1135,9 +1127,10 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // Normal pattern matching
         auto star_pos = pattern.find('*');
         if (star_pos != std::string::npos) {
+            const ShellPattern matcher(pattern);
             std::vector<std::string> names;
             for (const auto& gname : group_order) {
-                if (name_match(pattern, gname))
+                if (matcher.match(gname))
                     names.push_back(gname);
             }
             return names;
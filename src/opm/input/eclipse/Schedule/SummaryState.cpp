@@ -23,12 +23,15 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
+#include <limits>
 #include <ostream>
 #include <set>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -63,56 +66,146 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
+    constexpr auto no_slot = std::numeric_limits<std::size_t>::max();
+
     template <class T>
     using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
 
     template <class T>
-    bool has_var(const map2<T>& values, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
+    using map3 = map2<std::unordered_map<std::size_t, T>>;
 
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
-            return false;
+    std::size_t find_slot(const map2<std::size_t>& index, const std::string& var, const std::string& wgname)
+    {
+        const auto var_iter = index.find(var);
+        if (var_iter == index.end())
+            return no_slot;
 
-        return true;
+        const auto slot_iter = var_iter->second.find(wgname);
+        return (slot_iter == var_iter->second.end()) ? no_slot : slot_iter->second;
     }
 
-    template <class T>
-    void erase_var(map2<T>& values, std::set<std::string>& var2_set, const std::string& var1, const std::string& var2) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
+    std::size_t find_slot(const map3<std::size_t>& index,
+                          const std::string&       var,
+                          const std::string&       well,
+                          const std::size_t        number)
+    {
+        const auto var_iter = index.find(var);
+        if (var_iter == index.end())
+            return no_slot;
 
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
-            }
-        }
+        const auto well_iter = var_iter->second.find(well);
+        if (well_iter == var_iter->second.end())
+            return no_slot;
+
+        const auto slot_iter = well_iter->second.find(number);
+        return (slot_iter == well_iter->second.end()) ? no_slot : slot_iter->second;
     }
 
-    template <class T>
-    std::vector<std::string> var2_list(const map2<T>& values, const std::string& var1) {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
+    template <class Slots>
+    std::vector<std::string> var2_list(const map2<std::size_t>& index, const Slots& slots, const std::string& var)
+    {
+        const auto var_iter = index.find(var);
+        if (var_iter == index.end())
             return {};
 
         std::vector<std::string> l;
-        for (const auto& pair : var1_iter->second)
-            l.push_back(pair.first);
+        for (const auto& [var2, slot] : var_iter->second) {
+            if (slots.has(slot))
+                l.push_back(var2);
+        }
         return l;
     }
 
+    template <class Slots>
+    void collect_var2(const map2<std::size_t>& index, const Slots& slots, std::set<std::string>& var2_set)
+    {
+        var2_set.clear();
+        for (const auto& [_, var2_map] : index) {
+            (void)_;
+            for (const auto& [var2, slot] : var2_map) {
+                if (slots.has(slot))
+                    var2_set.insert(var2);
+            }
+        }
+    }
+
+    std::string segment_key(const std::string& well, const std::string& var, const std::size_t segment)
+    {
+        return var + ':' + well + ':' + std::to_string(segment);
+    }
+
 } // Anonymous namespace
 
 namespace Opm
 {
 
+    std::size_t SummaryState::Slots::add(const bool is_total)
+    {
+        this->value.push_back(0.0);
+        this->defined.push_back(0);
+        this->total.push_back(is_total);
+        this->handle.push_back(no_slot);
+
+        return this->value.size() - 1;
+    }
+
+    void SummaryState::Slots::assign(const std::size_t slot, const double v)
+    {
+        this->value[slot] = v;
+        this->defined[slot] = 1;
+    }
+
+    void SummaryState::Slots::update(const std::size_t slot, const double v)
+    {
+        if (this->defined[slot] == 0) {
+            this->value[slot] = 0.0;
+            this->defined[slot] = 1;
+        }
+
+        if (this->total[slot] != 0)
+            this->value[slot] += v;
+        else
+            this->value[slot] = v;
+    }
+
+    void SummaryState::Slots::clear_defined()
+    {
+        std::fill(this->defined.begin(), this->defined.end(), 0);
+    }
+
+    SummaryState::const_iterator::const_iterator(const SummaryState* st, const std::size_t slot)
+        : st_(st)
+        , slot_(slot)
+    {
+        this->skip_undefined();
+    }
+
+    SummaryState::const_iterator::value_type SummaryState::const_iterator::operator*() const
+    {
+        return { this->st_->key_names[this->slot_], this->st_->key_slots.value[this->slot_] };
+    }
+
+    SummaryState::const_iterator& SummaryState::const_iterator::operator++()
+    {
+        ++this->slot_;
+        this->skip_undefined();
+        return *this;
+    }
+
+    SummaryState::const_iterator SummaryState::const_iterator::operator++(int)
+    {
+        auto prev = *this;
+        ++(*this);
+        return prev;
+    }
+
+    void SummaryState::const_iterator::skip_undefined()
+    {
+        const auto& slots = this->st_->key_slots;
+        while ((this->slot_ < slots.value.size()) && !slots.has(this->slot_))
+            ++this->slot_;
+    }
+
     SummaryState::SummaryState(time_point sim_start_arg)
         : sim_start(sim_start_arg)
     {
@@ -123,13 +216,99 @@ namespace Opm
         : SummaryState { TimeService::from_time_t(sim_start_arg) }
     {}
 
+    std::size_t SummaryState::key_slot(const std::string& key)
+    {
+        auto iter = this->key_index.find(key);
+        if (iter != this->key_index.end())
+            return iter->second;
+
+        const auto slot = this->key_slots.add(is_total(key));
+        this->key_names.push_back(key);
+        this->key_index.emplace(key, slot);
+        return slot;
+    }
+
+    std::size_t SummaryState::find_key_slot(const std::string& key) const
+    {
+        const auto iter = this->key_index.find(key);
+        return (iter == this->key_index.end()) ? no_slot : iter->second;
+    }
+
+    std::size_t SummaryState::var_slot(map2<std::size_t>& index,
+                                       const std::string& var,
+                                       const std::string& wgname)
+    {
+        auto& var_index = index[var];
+        auto iter = var_index.find(wgname);
+        if (iter != var_index.end())
+            return iter->second;
+
+        const auto slot = this->var_slots.add(is_total(var));
+        var_index.emplace(wgname, slot);
+        return slot;
+    }
+
+    std::size_t SummaryState::var_slot(map3<std::size_t>& index,
+                                       const std::string& var,
+                                       const std::string& well,
+                                       const std::size_t  number)
+    {
+        auto& well_index = index[var][well];
+        auto iter = well_index.find(number);
+        if (iter != well_index.end())
+            return iter->second;
+
+        const auto slot = this->var_slots.add(is_total(var));
+        well_index.emplace(number, slot);
+        return slot;
+    }
+
+    SummaryState::Handle
+    SummaryState::make_handle(const VarKind      kind,
+                              const std::size_t  key_slot,
+                              const std::size_t  var_slot,
+                              const std::string& wgname)
+    {
+        auto& handle = (kind == VarKind::Key)
+            ? this->key_slots.handle[key_slot]
+            : this->var_slots.handle[var_slot];
+
+        if (handle == no_slot) {
+            handle = this->handles.size();
+            this->handles.push_back({ kind, key_slot, var_slot, wgname });
+        }
+
+        return handle;
+    }
+
+    void SummaryState::add_well(const std::string& well)
+    {
+        if (this->m_wells.count(well) == 0) {
+            this->m_wells.insert(well);
+            this->well_names.reset();
+        }
+    }
+
+    void SummaryState::add_group(const std::string& group)
+    {
+        if (this->m_groups.count(group) == 0) {
+            this->m_groups.insert(group);
+            this->group_names.reset();
+        }
+    }
+
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        this->key_slots.assign(this->key_slot(key), value);
     }
 
     bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+        const auto slot = this->find_key_slot(key);
+        if ((slot == no_slot) || !this->key_slots.has(slot))
+            return false;
+
+        this->key_slots.defined[slot] = 0;
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -138,7 +317,11 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->well_values, this->m_wells, var, well);
+        const auto slot = find_slot(this->well_index, var, well);
+        if (slot != no_slot)
+            this->var_slots.defined[slot] = 0;
+
+        collect_var2(this->well_index, this->var_slots, this->m_wells);
         this->well_names.reset();
         return true;
     }
@@ -149,99 +332,71 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->group_values, this->m_groups, var, group);
+        const auto slot = find_slot(this->group_index, var, group);
+        if (slot != no_slot)
+            this->var_slots.defined[slot] = 0;
+
+        collect_var2(this->group_index, this->var_slots, this->m_groups);
         this->group_names.reset();
         return true;
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return this->values.find(key) != this->values.end();
+        const auto slot = this->find_key_slot(key);
+        return (slot != no_slot) && this->key_slots.has(slot);
     }
 
     bool SummaryState::has_well_var(const std::string& well, const std::string& var) const
     {
-        return has_var(this->well_values, var, well);
+        const auto slot = find_slot(this->well_index, var, well);
+        return (slot != no_slot) && this->var_slots.has(slot);
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return this->well_values.count(var) != 0;
+        return !var2_list(this->well_index, this->var_slots, var).empty();
     }
 
     bool SummaryState::has_group_var(const std::string& group, const std::string& var) const
     {
-        return has_var(this->group_values, var, group);
+        const auto slot = find_slot(this->group_index, var, group);
+        return (slot != no_slot) && this->var_slots.has(slot);
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return this->group_values.count(var) != 0;
+        return !var2_list(this->group_index, this->var_slots, var).empty();
     }
 
     bool SummaryState::has_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const
     {
-        if (!has_var(this->conn_values, var, well))
-            return false;
-
-        const auto& index_map = this->conn_values.at(var).at(well);
-        return (index_map.count(global_index) > 0);
+        const auto slot = find_slot(this->conn_index, var, well, global_index);
+        return (slot != no_slot) && this->var_slots.has(slot);
     }
 
     bool SummaryState::has_segment_var(const std::string& well,
                                        const std::string& var,
                                        const std::size_t  segment) const
     {
-        // Segment Values = [var][well][segment] -> double
-
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return false;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return false;
-        }
-
-        return wellPos->second.find(segment) != wellPos->second.end();
+        const auto slot = find_slot(this->segment_index, var, well, segment);
+        return (slot != no_slot) && this->var_slots.has(slot);
     }
 
     void SummaryState::update(const std::string& key, double value) {
-        if (is_total(key))
-            this->values[key] += value;
-        else
-            this->values[key] = value;
+        this->key_slots.update(this->key_slot(key), value);
     }
 
     void SummaryState::update_well_var(const std::string& well, const std::string& var, double value) {
-        std::string key = var + ":" + well;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->well_values[var][well] += value;
-        } else {
-            this->values[key] = value;
-            this->well_values[var][well] = value;
-        }
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->key_slots.update(this->key_slot(var + ":" + well), value);
+        this->var_slots.update(this->var_slot(this->well_index, var, well), value);
+        this->add_well(well);
     }
 
     void SummaryState::update_group_var(const std::string& group, const std::string& var, double value) {
-        std::string key = var + ":" + group;
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->group_values[var][group] += value;
-        } else {
-            this->values[key] = value;
-            this->group_values[var][group] = value;
-        }
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->key_slots.update(this->key_slot(var + ":" + group), value);
+        this->var_slots.update(this->var_slot(this->group_index, var, group), value);
+        this->add_group(group);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -293,13 +448,8 @@ namespace Opm
     void SummaryState::update_conn_var(const std::string& well, const std::string& var, std::size_t global_index, double value)
     {
         std::string key = var + ":" + well + ":" + std::to_string(global_index);
-        if (is_total(var)) {
-            this->values[key] += value;
-            this->conn_values[var][well][global_index] += value;
-        } else {
-            this->values[key] = value;
-            this->conn_values[var][well][global_index] = value;
-        }
+        this->key_slots.update(this->key_slot(key), value);
+        this->var_slots.update(this->var_slot(this->conn_index, var, well, global_index), value);
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -307,34 +457,26 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[var + ':' + well + ':' + std::to_string(segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
-        }
+        this->key_slots.update(this->key_slot(segment_key(well, var, segment)), value);
+        this->var_slots.update(this->var_slot(this->segment_index, var, well, segment), value);
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto slot = this->find_key_slot(key);
+        if ((slot == no_slot) || !this->key_slots.has(slot))
             throw std::out_of_range("No such key: " + key);
 
-        return iter->second;
+        return this->key_slots.value[slot];
     }
 
     double SummaryState::get(const std::string& key, double default_value) const
     {
-        const auto iter = this->values.find(key);
-        if (iter == this->values.end())
+        const auto slot = this->find_key_slot(key);
+        if ((slot == no_slot) || !this->key_slots.has(slot))
             return default_value;
 
-        return iter->second;
+        return this->key_slots.value[slot];
     }
 
     double SummaryState::get_elapsed() const
@@ -344,24 +486,36 @@ namespace Opm
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var) const
     {
-        return this->well_values.at(var).at(well);
+        if (!this->has_well_var(well, var))
+            throw std::out_of_range("No such well variable: " + var + ":" + well);
+
+        return this->var_slots.value[find_slot(this->well_index, var, well)];
     }
 
     double SummaryState::get_group_var(const std::string& group, const std::string& var) const
     {
-        return this->group_values.at(var).at(group);
+        if (!this->has_group_var(group, var))
+            throw std::out_of_range("No such group variable: " + var + ":" + group);
+
+        return this->var_slots.value[find_slot(this->group_index, var, group)];
     }
 
     double SummaryState::get_conn_var(const std::string& well, const std::string& var, std::size_t global_index) const
     {
-        return this->conn_values.at(var).at(well).at(global_index);
+        if (!this->has_conn_var(well, var, global_index))
+            throw std::out_of_range("No such connection variable: " + var + ":" + well + ":" + std::to_string(global_index));
+
+        return this->var_slots.value[find_slot(this->conn_index, var, well, global_index)];
     }
 
     double SummaryState::get_segment_var(const std::string& well,
                                          const std::string& var,
                                          const std::size_t  segment) const
     {
-        return this->segment_values.at(var).at(well).at(segment);
+        if (!this->has_segment_var(well, var, segment))
+            throw std::out_of_range("No such segment variable: " + segment_key(well, var, segment));
+
+        return this->var_slots.value[find_slot(this->segment_index, var, well, segment)];
     }
 
     double SummaryState::get_well_var(const std::string& well, const std::string& var, double default_value) const
@@ -392,20 +546,101 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
+        if (this->has_segment_var(well, var, segment))
+            return this->get_segment_var(well, var, segment);
+
+        return default_value;
+    }
+
+    SummaryState::Handle SummaryState::register_key(const std::string& key)
+    {
+        return this->make_handle(VarKind::Key, this->key_slot(key), no_slot, "");
+    }
+
+    SummaryState::Handle SummaryState::register_well_var(const std::string& well, const std::string& var)
+    {
+        return this->make_handle(VarKind::Well,
+                                 this->key_slot(var + ":" + well),
+                                 this->var_slot(this->well_index, var, well),
+                                 well);
+    }
+
+    SummaryState::Handle SummaryState::register_group_var(const std::string& group, const std::string& var)
+    {
+        return this->make_handle(VarKind::Group,
+                                 this->key_slot(var + ":" + group),
+                                 this->var_slot(this->group_index, var, group),
+                                 group);
+    }
+
+    SummaryState::Handle SummaryState::register_conn_var(const std::string& well,
+                                                         const std::string& var,
+                                                         const std::size_t  global_index)
+    {
+        return this->make_handle(VarKind::Conn,
+                                 this->key_slot(var + ":" + well + ":" + std::to_string(global_index)),
+                                 this->var_slot(this->conn_index, var, well, global_index),
+                                 well);
+    }
+
+    SummaryState::Handle SummaryState::register_segment_var(const std::string& well,
+                                                            const std::string& var,
+                                                            const std::size_t  segment)
+    {
+        return this->make_handle(VarKind::Segment,
+                                 this->key_slot(segment_key(well, var, segment)),
+                                 this->var_slot(this->segment_index, var, well, segment),
+                                 well);
+    }
+
+    void SummaryState::update(const Handle handle, const double value)
+    {
+        const auto& info = this->handles.at(handle);
+
+        this->key_slots.update(info.key_slot, value);
+        if (info.kind == VarKind::Key)
+            return;
+
+        const auto first_value = !this->var_slots.has(info.var_slot);
+        this->var_slots.update(info.var_slot, value);
+
+        if (first_value) {
+            if (info.kind == VarKind::Well)
+                this->add_well(info.wgname);
+            else if (info.kind == VarKind::Group)
+                this->add_group(info.wgname);
         }
+    }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
+    bool SummaryState::has(const Handle handle) const
+    {
+        const auto& info = this->handles.at(handle);
+
+        return (info.kind == VarKind::Key)
+            ? this->key_slots.has(info.key_slot)
+            : this->var_slots.has(info.var_slot);
+    }
+
+    double SummaryState::get(const Handle handle) const
+    {
+        const auto& info = this->handles.at(handle);
+
+        if (info.kind == VarKind::Key) {
+            if (!this->key_slots.has(info.key_slot))
+                throw std::out_of_range("No such key: " + this->key_names[info.key_slot]);
+
+            return this->key_slots.value[info.key_slot];
         }
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
-            ? default_value
-            : valPos->second;
+        if (!this->var_slots.has(info.var_slot))
+            throw std::out_of_range("No such variable: " + this->key_names[info.key_slot]);
+
+        return this->var_slots.value[info.var_slot];
+    }
+
+    double SummaryState::get(const Handle handle, const double default_value) const
+    {
+        return this->has(handle) ? this->get(handle) : default_value;
     }
 
     const std::vector<std::string>& SummaryState::wells() const
@@ -419,7 +654,7 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        return var2_list(this->well_index, this->var_slots, var);
     }
 
     const std::vector<std::string>& SummaryState::groups() const
@@ -433,44 +668,76 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        return var2_list(this->group_index, this->var_slots, var);
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
         this->well_names.reset();
         this->group_names.reset();
 
+        // The general values are replaced, the specialized values are
+        // replaced per variable.
+        this->key_slots.clear_defined();
+        for (const auto& [key, value] : buffer)
+            this->set(key, value);
+
+        const auto copy_vars = [this, &buffer](const map2<std::size_t>& src, map2<std::size_t>& dst)
+        {
+            for (const auto& [var, slots] : src) {
+                auto& dst_slots = dst[var];
+                for (const auto& [wgname, slot] : dst_slots) {
+                    (void)wgname;
+                    this->var_slots.defined[slot] = 0;
+                }
+
+                for (const auto& [wgname, slot] : slots) {
+                    if (buffer.var_slots.has(slot))
+                        this->var_slots.assign(this->var_slot(dst, var, wgname), buffer.var_slots.value[slot]);
+                }
+            }
+        };
+
+        const auto copy_indexed_vars = [this, &buffer](const map3<std::size_t>& src, map3<std::size_t>& dst)
+        {
+            for (const auto& [var, well_slots] : src) {
+                for (const auto& [well, slots] : dst[var]) {
+                    (void)well;
+                    for (const auto& [number, slot] : slots) {
+                        (void)number;
+                        this->var_slots.defined[slot] = 0;
+                    }
+                }
+
+                for (const auto& [well, slots] : well_slots) {
+                    for (const auto& [number, slot] : slots) {
+                        if (buffer.var_slots.has(slot))
+                            this->var_slots.assign(this->var_slot(dst, var, well, number), buffer.var_slots.value[slot]);
+                    }
+                }
+            }
+        };
+
         this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
-        }
+        copy_vars(buffer.well_index, this->well_index);
 
         this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
-        }
-
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
-        }
+        copy_vars(buffer.group_index, this->group_index);
 
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
-        }
+        copy_indexed_vars(buffer.conn_index, this->conn_index);
+        copy_indexed_vars(buffer.segment_index, this->segment_index);
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this, 0 };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this, this->key_slots.value.size() };
     }
 
     std::size_t SummaryState::num_wells() const
@@ -480,22 +747,96 @@ namespace Opm
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return std::count(this->key_slots.defined.begin(), this->key_slots.defined.end(), 1);
+    }
+
+    SummaryState::NestedMaps SummaryState::to_maps() const
+    {
+        NestedMaps maps;
+
+        for (const auto& [key, value] : *this)
+            maps.values.emplace(key, value);
+
+        const auto export_vars = [this](const map2<std::size_t>& index, map2<double>& values)
+        {
+            for (const auto& [var, slots] : index) {
+                for (const auto& [wgname, slot] : slots) {
+                    if (this->var_slots.has(slot))
+                        values[var].emplace(wgname, this->var_slots.value[slot]);
+                }
+            }
+        };
+
+        const auto export_indexed_vars = [this](const map3<std::size_t>& index, map3<double>& values)
+        {
+            for (const auto& [var, well_slots] : index) {
+                for (const auto& [well, slots] : well_slots) {
+                    for (const auto& [number, slot] : slots) {
+                        if (this->var_slots.has(slot))
+                            values[var][well].emplace(number, this->var_slots.value[slot]);
+                    }
+                }
+            }
+        };
+
+        export_vars(this->well_index, maps.well_values);
+        export_vars(this->group_index, maps.group_values);
+        export_indexed_vars(this->conn_index, maps.conn_values);
+        export_indexed_vars(this->segment_index, maps.segment_values);
+
+        return maps;
+    }
+
+    void SummaryState::from_maps(const NestedMaps& maps)
+    {
+        // Existing slots are reused, handles registered before the values
+        // were loaded remain valid.
+        this->key_slots.clear_defined();
+        this->var_slots.clear_defined();
+
+        for (const auto& [key, value] : maps.values)
+            this->set(key, value);
+
+        const auto import_vars = [this](const map2<double>& values, map2<std::size_t>& index)
+        {
+            for (const auto& [var, wg_values] : values) {
+                for (const auto& [wgname, value] : wg_values)
+                    this->var_slots.assign(this->var_slot(index, var, wgname), value);
+            }
+        };
+
+        const auto import_indexed_vars = [this](const map3<double>& values, map3<std::size_t>& index)
+        {
+            for (const auto& [var, well_values] : values) {
+                for (const auto& [well, num_values] : well_values) {
+                    for (const auto& [number, value] : num_values)
+                        this->var_slots.assign(this->var_slot(index, var, well, number), value);
+                }
+            }
+        };
+
+        import_vars(maps.well_values, this->well_index);
+        import_vars(maps.group_values, this->group_index);
+        import_indexed_vars(maps.conn_values, this->conn_index);
+        import_indexed_vars(maps.segment_values, this->segment_index);
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
     {
+        const auto maps = this->to_maps();
+        const auto other_maps = other.to_maps();
+
         return (this->sim_start == other.sim_start)
             && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
+            && (maps.values == other_maps.values)
+            && (maps.well_values == other_maps.well_values)
             && (this->m_wells == other.m_wells)
             && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
+            && (maps.group_values == other_maps.group_values)
             && (this->m_groups == other.m_groups)
             && (this->groups() == other.groups())
-            && (this->conn_values == other.conn_values)
-            && (this->segment_values == other.segment_values);
+            && (maps.conn_values == other_maps.conn_values)
+            && (maps.segment_values == other_maps.segment_values);
     }
 
     SummaryState SummaryState::serializationTestObject()
@@ -503,17 +844,19 @@ namespace Opm
         auto st = SummaryState{TimeService::from_time_t(101)};
 
         st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
         st.m_wells = {"test4"};
         st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
         st.m_groups = {"test7"};
-        st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+        st.group_names = {"test8"};
+
+        NestedMaps maps;
+        maps.values = {{"test1", 2.0}};
+        maps.well_values = {{"test2", {{"test3", 3.0}}}};
+        maps.group_values = {{"test6", {{"test7", 4.0}}}};
+        maps.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
 
         {
-            auto& sval = st.segment_values["SU1"];
+            auto& sval = maps.segment_values["SU1"];
             sval.emplace("W1", std::unordered_map<std::size_t, double> {
                     { std::size_t{ 1},  123.456   },
                     { std::size_t{ 2},   17.29    },
@@ -526,13 +869,15 @@ namespace Opm
         }
 
         {
-            auto& sval = st.segment_values["SUVIS"];
+            auto& sval = maps.segment_values["SUVIS"];
             sval.emplace("I2", std::unordered_map<std::size_t, double> {
                     { std::size_t{17},  29.0   },
                     { std::size_t{42}, - 1.618 },
                 });
         }
 
+        st.from_maps(maps);
+
         return st;
     }
 
@@ -31,6 +31,7 @@
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 
 #include "../../Parser/raw/RawConsts.hpp"
+#include "UDQEvalPlan.hpp"
 #include "UDQParser.hpp"
 
 #include <cstddef>
@@ -287,6 +288,17 @@ UDQDefine::UDQDefine(const UDQParams&                udq_params,
                           this->m_tokens,
                           parseContext,
                           errors));
+
+    this->compile_plan();
+}
+
+void UDQDefine::compile_plan()
+{
+    this->m_plan.reset();
+
+    if (this->ast != nullptr) {
+        this->m_plan = UDQEvalPlan::compile(*this->ast, this->m_var_type);
+    }
 }
 
 void UDQDefine::update_status(const UDQUpdate   update,
@@ -319,7 +331,14 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
 {
     std::optional<UDQSet> res;
     try {
-        res = this->ast->eval(this->m_var_type, context);
+        if (this->m_plan != nullptr) {
+            res = this->m_plan->eval(this->m_keyword, context);
+        }
+
+        if (! res.has_value()) {
+            res = this->ast->eval(this->m_var_type, context);
+        }
+
         res->name(this->m_keyword);
 
         if (!dynamic_type_check(this->var_type(), res->var_type())) {
@@ -0,0 +1,654 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify it under the terms
+  of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  OPM is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along with
+  OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "UDQEvalPlan.hpp"
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace {
+
+enum class Shape { Empty, Scalar, Field, Wells, Groups };
+
+// Dense values of one intermediate result.  The shapes correspond to the
+// variable types of the UDQSet produced by the AST evaluation: NONE,
+// SCALAR, FIELD_VAR, WELL_VAR and GROUP_VAR respectively.
+struct Operand
+{
+    Shape shape = Shape::Empty;
+    std::vector<double> value{};
+    std::vector<bool> defined{};
+
+    std::size_t size() const
+    {
+        return this->value.size();
+    }
+
+    void reset(const Shape shape_arg, const std::size_t size)
+    {
+        this->shape = shape_arg;
+        this->value.assign(size, 0.0);
+        this->defined.assign(size, false);
+    }
+
+    // Non-finite values are undefined, as in UDQScalar::assign().
+    void set(const std::size_t index, const double v)
+    {
+        this->value[index] = v;
+        this->defined[index] = std::isfinite(v);
+    }
+
+    void set(const std::size_t index, const std::optional<double>& v)
+    {
+        if (v.has_value()) {
+            this->set(index, *v);
+        }
+        else {
+            this->defined[index] = false;
+        }
+    }
+};
+
+bool is_scalar(const Shape shape)
+{
+    return (shape == Shape::Scalar) || (shape == Shape::Field);
+}
+
+bool is_wgset(const Shape shape)
+{
+    return (shape == Shape::Wells) || (shape == Shape::Groups);
+}
+
+// UDQSet::assign(wgname, value) treats the name as a pattern, so names
+// with pattern characters can match more than one element.
+bool plain_names(const std::vector<std::string>& names)
+{
+    return std::none_of(names.begin(), names.end(),
+                        [](const std::string& name)
+                        { return name.find_first_of("*?[\\") != std::string::npos; });
+}
+
+// Well and group names of the context, only retrieved if needed.
+class Names
+{
+public:
+    explicit Names(const Opm::UDQContext& context)
+        : context_(context)
+    {}
+
+    const std::vector<std::string>* wells()
+    {
+        if (! this->wells_.has_value()) {
+            this->wells_ = this->context_.wells();
+            this->plain_wells_ = plain_names(*this->wells_);
+        }
+
+        return this->plain_wells_ ? &*this->wells_ : nullptr;
+    }
+
+    const std::vector<std::string>* groups()
+    {
+        if (! this->groups_.has_value()) {
+            this->groups_ = this->context_.groups();
+            this->plain_groups_ = plain_names(*this->groups_);
+        }
+
+        return this->plain_groups_ ? &*this->groups_ : nullptr;
+    }
+
+    std::optional<std::size_t> well_index(const std::string& well)
+    {
+        if (this->well_index_.empty()) {
+            const auto& wells = *this->wells_;
+            for (std::size_t i = 0; i < wells.size(); ++i) {
+                this->well_index_.emplace(wells[i], i);
+            }
+        }
+
+        const auto pos = this->well_index_.find(well);
+        if (pos == this->well_index_.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
+    }
+
+private:
+    const Opm::UDQContext& context_;
+    std::optional<std::vector<std::string>> wells_{};
+    std::optional<std::vector<std::string>> groups_{};
+    std::unordered_map<std::string, std::size_t> well_index_{};
+    bool plain_wells_ = false;
+    bool plain_groups_ = false;
+};
+
+void apply_sign(const double sign, Operand& x)
+{
+    if (sign == 1.0) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (x.defined[i]) {
+            x.set(i, sign * x.value[i]);
+        }
+    }
+}
+
+// Promote a scalar operand to the shape of a well or group set, as
+// udq_cast() does for UDQSet operands.
+bool broadcast(Operand& scalar, const Operand& target)
+{
+    if (! scalar.defined[0]) {
+        return false;
+    }
+
+    const auto v = scalar.value[0];
+    scalar.reset(target.shape, target.size());
+    for (std::size_t i = 0; i < scalar.size(); ++i) {
+        scalar.set(i, v);
+    }
+
+    return true;
+}
+
+bool cast(Operand& lhs, Operand& rhs)
+{
+    if ((lhs.shape == rhs.shape) || (is_scalar(lhs.shape) && is_scalar(rhs.shape))) {
+        return lhs.size() == rhs.size();
+    }
+
+    if (is_scalar(lhs.shape) && is_wgset(rhs.shape)) {
+        return broadcast(lhs, rhs);
+    }
+
+    if (is_scalar(rhs.shape) && is_wgset(lhs.shape)) {
+        return broadcast(rhs, lhs);
+    }
+
+    return false;
+}
+
+template <typename BinOp>
+void elementwise(Operand& lhs, const Operand& rhs, BinOp&& op)
+{
+    for (std::size_t i = 0; i < lhs.size(); ++i) {
+        if (lhs.defined[i] && rhs.defined[i]) {
+            lhs.set(i, op(lhs.value[i], rhs.value[i]));
+        }
+        else {
+            lhs.defined[i] = false;
+        }
+    }
+}
+
+bool binary_function(const Opm::UDQTokenType func, Operand& lhs, Operand& rhs)
+{
+    using Opm::UDQTokenType;
+
+    if (func == UDQTokenType::binary_op_pow) {
+        // Power does not promote scalars, and the left hand side is
+        // unchanged where the right hand side is undefined.
+        if (rhs.size() < lhs.size()) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < lhs.size(); ++i) {
+            if (lhs.defined[i] && rhs.defined[i]) {
+                lhs.set(i, std::pow(lhs.value[i], rhs.value[i]));
+            }
+        }
+
+        return true;
+    }
+
+    if (! cast(lhs, rhs)) {
+        return false;
+    }
+
+    switch (func) {
+    case UDQTokenType::binary_op_add:
+        elementwise(lhs, rhs, [](const double x, const double y) { return x + y; });
+        return true;
+
+    case UDQTokenType::binary_op_sub:
+        elementwise(lhs, rhs, [](const double x, const double y) { return x + (-y); });
+        return true;
+
+    case UDQTokenType::binary_op_mul:
+        elementwise(lhs, rhs, [](const double x, const double y) { return x * y; });
+        return true;
+
+    case UDQTokenType::binary_op_div:
+        elementwise(lhs, rhs, [](const double x, const double y) { return x / y; });
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool unary_function(const Opm::UDQTokenType func, Operand& x)
+{
+    using Opm::UDQTokenType;
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (func == UDQTokenType::elemental_func_idv) {
+            x.set(i, x.defined[i] ? 1.0 : 0.0);
+            continue;
+        }
+
+        if (! x.defined[i]) {
+            continue;
+        }
+
+        const auto v = x.value[i];
+        switch (func) {
+        case UDQTokenType::elemental_func_abs:  x.set(i, std::fabs(v));      break;
+        case UDQTokenType::elemental_func_def:  x.set(i, 1.0);               break;
+        case UDQTokenType::elemental_func_exp:  x.set(i, std::exp(v));       break;
+        case UDQTokenType::elemental_func_nint: x.set(i, std::nearbyint(v)); break;
+
+        case UDQTokenType::elemental_func_ln:
+        case UDQTokenType::elemental_func_log:
+            if (! (v > 0.0)) {
+                return false;
+            }
+
+            x.set(i, (func == UDQTokenType::elemental_func_ln) ? std::log(v) : std::log10(v));
+            break;
+
+        default:
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool scalar_function(const Opm::UDQTokenType func, Operand& x)
+{
+    using Opm::UDQTokenType;
+
+    std::vector<double> values;
+    values.reserve(x.size());
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (x.defined[i]) {
+            values.push_back(x.value[i]);
+        }
+    }
+
+    if (values.empty()) {
+        x.reset(Shape::Empty, 0);
+        return true;
+    }
+
+    const auto n = values.size();
+    auto result = 0.0;
+
+    switch (func) {
+    case UDQTokenType::scalar_func_min:
+        result = *std::min_element(values.begin(), values.end());
+        break;
+
+    case UDQTokenType::scalar_func_max:
+        result = *std::max_element(values.begin(), values.end());
+        break;
+
+    case UDQTokenType::scalar_func_sum:
+    case UDQTokenType::scalar_func_avea:
+        for (const auto v : values) { result = result + v; }
+        if (func == UDQTokenType::scalar_func_avea) { result = result / n; }
+        break;
+
+    case UDQTokenType::scalar_func_prod:
+        result = 1.0;
+        for (const auto v : values) { result = result * v; }
+        break;
+
+    case UDQTokenType::scalar_func_aveg:
+        if (std::any_of(values.begin(), values.end(), [](const double v) { return v <= 0; })) {
+            return false;
+        }
+        for (const auto v : values) { result = result + std::log(v); }
+        result = std::exp(result / n);
+        break;
+
+    case UDQTokenType::scalar_func_aveh:
+        for (const auto v : values) { result = result + 1.0/v; }
+        result = n / result;
+        break;
+
+    case UDQTokenType::scalar_func_normi:
+        for (const auto v : values) { result = std::max(result, std::fabs(v)); }
+        break;
+
+    case UDQTokenType::scalar_func_norm1:
+        for (const auto v : values) { result = result + std::fabs(v); }
+        break;
+
+    case UDQTokenType::scalar_func_norm2:
+        for (const auto v : values) { result = result + v*v; }
+        result = std::sqrt(result);
+        break;
+
+    default:
+        return false;
+    }
+
+    x.reset(Shape::Scalar, 1);
+    x.set(0, result);
+
+    return true;
+}
+
+bool supported_unary_function(const Opm::UDQTokenType func)
+{
+    using Opm::UDQTokenType;
+
+    return (func == UDQTokenType::elemental_func_abs)
+        || (func == UDQTokenType::elemental_func_def)
+        || (func == UDQTokenType::elemental_func_exp)
+        || (func == UDQTokenType::elemental_func_idv)
+        || (func == UDQTokenType::elemental_func_ln)
+        || (func == UDQTokenType::elemental_func_log)
+        || (func == UDQTokenType::elemental_func_nint);
+}
+
+bool supported_binary_function(const Opm::UDQTokenType func)
+{
+    using Opm::UDQTokenType;
+
+    return (func == UDQTokenType::binary_op_add)
+        || (func == UDQTokenType::binary_op_sub)
+        || (func == UDQTokenType::binary_op_mul)
+        || (func == UDQTokenType::binary_op_div)
+        || (func == UDQTokenType::binary_op_pow);
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+UDQEvalPlan::UDQEvalPlan(const UDQVarType target_type_arg)
+    : target_type(target_type_arg)
+{}
+
+std::unique_ptr<UDQEvalPlan>
+UDQEvalPlan::compile(const UDQASTNode& ast, const UDQVarType target_type)
+{
+    auto plan = std::unique_ptr<UDQEvalPlan>(new UDQEvalPlan(target_type));
+    if (! plan->compile_node(ast)) {
+        return {};
+    }
+
+    return plan;
+}
+
+bool UDQEvalPlan::compile_node(const UDQASTNode& node)
+{
+    auto instr = Instruction { Op::Number };
+    instr.func = node.type;
+    instr.sign = node.sign;
+
+    if (node.type == UDQTokenType::number) {
+        if ((this->target_type != UDQVarType::WELL_VAR) &&
+            (this->target_type != UDQVarType::GROUP_VAR) &&
+            (this->target_type != UDQVarType::SCALAR) &&
+            (this->target_type != UDQVarType::FIELD_VAR))
+        {
+            return false;
+        }
+
+        instr.number = std::get<double>(node.value);
+    }
+    else if (node.type == UDQTokenType::ecl_expr) {
+        instr.var = std::get<std::string>(node.value);
+        const auto has_selector = ! node.selector.empty();
+        if (has_selector) {
+            instr.selector = node.selector.front();
+        }
+
+        const auto wildcard = instr.selector.find('*') != std::string::npos;
+
+        switch (UDQ::targetType(instr.var)) {
+        case UDQVarType::WELL_VAR:
+            instr.op = !has_selector ? Op::WellVar
+                : (wildcard ? Op::WellVarPattern : Op::WellVarScalar);
+            break;
+
+        case UDQVarType::GROUP_VAR:
+            if (wildcard) {
+                return false;
+            }
+            instr.op = has_selector ? Op::GroupVarScalar : Op::GroupVar;
+            break;
+
+        case UDQVarType::SEGMENT_VAR:
+        case UDQVarType::TABLE_LOOKUP:
+            return false;
+
+        case UDQVarType::FIELD_VAR:
+            instr.op = Op::FieldVar;
+            break;
+
+        default:
+            instr.op = Op::ScalarVar;
+            break;
+        }
+    }
+    else if (UDQ::scalarFunc(node.type)) {
+        if (! node.left || ! this->compile_node(*node.left)) {
+            return false;
+        }
+
+        instr.op = Op::ScalarFunc;
+    }
+    else if (UDQ::elementalUnaryFunc(node.type) && supported_unary_function(node.type)) {
+        if (! node.left || ! this->compile_node(*node.left)) {
+            return false;
+        }
+
+        instr.op = Op::UnaryFunc;
+    }
+    else if (UDQ::binaryFunc(node.type) && supported_binary_function(node.type)) {
+        if (! node.left || ! node.right ||
+            ! this->compile_node(*node.left) ||
+            ! this->compile_node(*node.right))
+        {
+            return false;
+        }
+
+        instr.op = Op::BinaryFunc;
+    }
+    else {
+        return false;
+    }
+
+    this->program.push_back(std::move(instr));
+    return true;
+}
+
+std::optional<UDQSet>
+UDQEvalPlan::eval(const std::string& keyword, const UDQContext& context) const
+{
+    auto names = Names { context };
+    auto stack = std::vector<Operand>{};
+
+    for (const auto& instr : this->program) {
+        switch (instr.op) {
+        case Op::Number: {
+            auto& x = stack.emplace_back();
+            if (this->target_type == UDQVarType::WELL_VAR) {
+                const auto* wells = names.wells();
+                if (wells == nullptr) { return std::nullopt; }
+                x.reset(Shape::Wells, wells->size());
+            }
+            else if (this->target_type == UDQVarType::GROUP_VAR) {
+                const auto* groups = names.groups();
+                if (groups == nullptr) { return std::nullopt; }
+                x.reset(Shape::Groups, groups->size());
+            }
+            else {
+                x.reset((this->target_type == UDQVarType::FIELD_VAR)
+                        ? Shape::Field : Shape::Scalar, 1);
+            }
+
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x.set(i, instr.number);
+            }
+            break;
+        }
+
+        case Op::WellVar: {
+            const auto* wells = names.wells();
+            if (wells == nullptr) { return std::nullopt; }
+
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Wells, wells->size());
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x.set(i, context.get_well_var((*wells)[i], instr.var));
+            }
+            break;
+        }
+
+        case Op::WellVarPattern: {
+            const auto* wells = names.wells();
+            if (wells == nullptr) { return std::nullopt; }
+
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Wells, wells->size());
+            for (const auto& well : context.wells(instr.selector)) {
+                const auto index = names.well_index(well);
+                if (! index.has_value()) { return std::nullopt; }
+
+                x.set(*index, context.get_well_var(well, instr.var));
+            }
+            break;
+        }
+
+        case Op::WellVarScalar: {
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Scalar, 1);
+            x.set(0, context.get_well_var(instr.selector, instr.var));
+            break;
+        }
+
+        case Op::GroupVar: {
+            const auto* groups = names.groups();
+            if (groups == nullptr) { return std::nullopt; }
+
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Groups, groups->size());
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                x.set(i, context.get_group_var((*groups)[i], instr.var));
+            }
+            break;
+        }
+
+        case Op::GroupVarScalar: {
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Scalar, 1);
+            x.set(0, context.get_group_var(instr.selector, instr.var));
+            break;
+        }
+
+        case Op::FieldVar: {
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Scalar, 1);
+            x.set(0, context.get(instr.var));
+            break;
+        }
+
+        case Op::ScalarVar: {
+            const auto v = context.get(instr.var);
+            if (! v.has_value()) { return std::nullopt; }
+
+            auto& x = stack.emplace_back();
+            x.reset(Shape::Scalar, 1);
+            x.set(0, *v);
+            break;
+        }
+
+        case Op::ScalarFunc:
+            if (! scalar_function(instr.func, stack.back())) { return std::nullopt; }
+            break;
+
+        case Op::UnaryFunc:
+            if (! unary_function(instr.func, stack.back())) { return std::nullopt; }
+            break;
+
+        case Op::BinaryFunc: {
+            auto rhs = std::move(stack.back());
+            stack.pop_back();
+
+            if (! binary_function(instr.func, stack.back(), rhs)) { return std::nullopt; }
+            break;
+        }
+        }
+
+        apply_sign(instr.sign, stack.back());
+    }
+
+    // Attach the well and group names to the final result only.
+    const auto& x = stack.back();
+    auto result = UDQSet::empty(keyword);
+
+    switch (x.shape) {
+    case Shape::Empty:
+        return result;
+
+    case Shape::Scalar:
+        result = UDQSet(keyword, UDQVarType::SCALAR);
+        break;
+
+    case Shape::Field:
+        result = UDQSet(keyword, UDQVarType::FIELD_VAR);
+        break;
+
+    case Shape::Wells:
+        result = UDQSet::wells(keyword, *names.wells());
+        break;
+
+    case Shape::Groups:
+        result = UDQSet::groups(keyword, *names.groups());
+        break;
+    }
+
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        if (x.defined[i]) {
+            result.assign(i, x.value[i]);
+        }
+    }
+
+    return result;
+}
+
+} // namespace Opm
@@ -0,0 +1,97 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify it under the terms
+  of the GNU General Public License as published by the Free Software
+  Foundation, either version 3 of the License, or (at your option) any later
+  version.
+
+  OPM is distributed in the hope that it will be useful, but WITHOUT ANY
+  WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR
+  A PARTICULAR PURPOSE.  See the GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License along with
+  OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQEVALPLAN_HPP
+#define UDQEVALPLAN_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+class UDQSet;
+
+} // namespace Opm
+
+namespace Opm {
+
+// Evaluation plan for the right hand side of a UDQ DEFINE statement.
+//
+// The expression tree is flattened to a sequence of stack instructions
+// which operate on dense arrays of values, one element per well or group,
+// with a separate mask of defined elements.  Well and group names are only
+// attached to the final result.
+//
+// The plan covers well, group and field level expressions with the
+// arithmetic operators and the common elemental and scalar functions.
+// Expressions with other constructs do not get a plan, and eval() returns
+// std::nullopt whenever the data leads to a case which the general AST
+// evaluation handles differently, e.g. by throwing an exception.  In both
+// cases the caller should use UDQASTNode::eval() instead.
+class UDQEvalPlan
+{
+public:
+    // Returns nullptr if the expression is not supported.
+    static std::unique_ptr<UDQEvalPlan>
+    compile(const UDQASTNode& ast, UDQVarType target_type);
+
+    std::optional<UDQSet> eval(const std::string& keyword, const UDQContext& context) const;
+
+private:
+    enum class Op
+    {
+        Number,           // Numeric constant
+        WellVar,          // Well variable for all wells
+        WellVarScalar,    // Well variable for a single named well
+        WellVarPattern,   // Well variable for wells matching a pattern
+        GroupVar,         // Group variable for all groups
+        GroupVarScalar,   // Group variable for a single named group
+        FieldVar,         // Field level variable
+        ScalarVar,        // Other scalar variable, e.g., TIME
+        ScalarFunc,       // SUM, AVEA, ...
+        UnaryFunc,        // ABS, EXP, ...
+        BinaryFunc,       // +, -, *, / and ^
+    };
+
+    struct Instruction
+    {
+        Op op;
+        UDQTokenType func = UDQTokenType::error;
+        double number = 0.0;
+        double sign = 1.0;
+        std::string var{};
+        std::string selector{};
+    };
+
+    explicit UDQEvalPlan(UDQVarType target_type);
+
+    UDQVarType target_type;
+    std::vector<Instruction> program{};
+
+    bool compile_node(const UDQASTNode& node);
+};
+
+} // namespace Opm
+
+#endif // UDQEVALPLAN_HPP
@@ -303,9 +303,10 @@ std::size_t UDQSet::size() const
 
 void UDQSet::assign(const std::string& wgname, const double value)
 {
+    const ShellPattern matcher(wgname);
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (matcher.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -326,9 +327,10 @@ void UDQSet::assign(const std::size_t index, const std::optional<double>& value)
 void UDQSet::assign(const std::string&           wgname,
                     const std::optional<double>& value)
 {
+    const ShellPattern matcher(wgname);
     bool assigned = false;
     for (auto& udq_value : this->values) {
-        if (shmatch(wgname, udq_value.wgname())) {
+        if (matcher.match(udq_value.wgname())) {
             udq_value.assign(value);
             assigned = true;
         }
@@ -345,10 +347,11 @@ void UDQSet::assign(const std::string&           wgname,
                     const std::size_t            number,
                     const std::optional<double>& value)
 {
+    const ShellPattern matcher(wgname);
     auto assigned = false;
 
     for (auto& udq : this->values) {
-        if ((udq.number() == number) && shmatch(wgname, udq.wgname())) {
+        if ((udq.number() == number) && matcher.match(udq.wgname())) {
             udq.assign(value);
             assigned = true;
         }
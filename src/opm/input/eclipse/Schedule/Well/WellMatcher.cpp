@@ -66,9 +66,10 @@ std::vector<std::string> WellMatcher::wells(const std::string& pattern) const {
     // Normal pattern matching
     auto star_pos = pattern.find('*');
     if (star_pos != std::string::npos) {
+        const ShellPattern matcher(pattern);
         std::vector<std::string> names;
         for (const auto& wname : this->m_well_order) {
-            if (shmatch(pattern, wname))
+            if (matcher.match(wname))
                 names.push_back(wname);
         }
         return names;
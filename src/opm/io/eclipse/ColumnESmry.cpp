@@ -0,0 +1,317 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ColumnESmry.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/shmatch.hpp>
+#include <opm/common/utility/TimeService.hpp>
+
+#include "src/opm/io/eclipse/ColumnSmryFormat.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+
+Opm::time_point make_date(const std::vector<int>& datetime)
+{
+    if (datetime.size() < 3)
+        return Opm::TimeService::from_time_t(0);
+
+    auto hour = 0;
+    auto minute = 0;
+    auto second = 0;
+
+    if (datetime.size() >= 6) {
+        hour = datetime[3];
+        minute = datetime[4];
+        second = datetime[5];
+    }
+
+    const auto ts = Opm::TimeStampUTC{ Opm::TimeStampUTC::YMD{ datetime[2], datetime[1], datetime[0] } }
+        .hour(hour).minutes(minute).seconds(second);
+
+    return Opm::TimeService::from_time_t( Opm::asTimeT(ts) );
+}
+
+std::vector<float> as_float(const std::vector<std::uint32_t>& bits)
+{
+    std::vector<float> values(bits.size());
+    std::memcpy(values.data(), bits.data(), bits.size() * sizeof(float));
+    return values;
+}
+
+}
+
+
+namespace Opm { namespace EclIO {
+
+ColumnESmry::ColumnESmry(const std::string& filename)
+    : m_inputFileName(filename)
+    , m_nTstep(0)
+{
+    this->refresh();
+}
+
+
+ColumnESmry::~ColumnESmry() = default;
+
+
+void ColumnESmry::refresh()
+{
+    std::ifstream fileH(m_inputFileName, std::ios::binary);
+    if (!fileH)
+        OPM_THROW(std::runtime_error, "Can not open columnar summary file " + m_inputFileName.string());
+
+    std::array<char, ColumnSmry::headerSize> header;
+    fileH.read(header.data(), header.size());
+    if (!fileH || !std::equal(ColumnSmry::magic.begin(), ColumnSmry::magic.end(), header.begin()) ||
+        (ColumnSmry::getLE<std::uint32_t>(header.data() + ColumnSmry::magic.size()) != ColumnSmry::formatVersion))
+        OPM_THROW(std::runtime_error, m_inputFileName.string() + " is not a columnar summary file");
+
+    const auto committed = ColumnSmry::getLE<std::uint64_t>(header.data() + ColumnSmry::committedSizePos);
+
+    fileH.seekg(0, std::ios::end);
+    const std::uint64_t fileSize = fileH.tellg();
+    if ((committed < ColumnSmry::headerSize) || (committed > fileSize))
+        OPM_THROW(std::runtime_error, "Invalid index in columnar summary file " + m_inputFileName.string());
+
+    // A file which is shorter than what has been read already has been
+    // rewritten, start from scratch.
+    if (!m_index || (committed < m_index->end)) {
+        auto index = std::make_unique<ColumnSmry::Index>();
+
+        std::array<char, sizeof(std::uint64_t)> size;
+        fileH.seekg(static_cast<std::streamoff>(ColumnSmry::headerSize));
+        fileH.read(size.data(), size.size());
+
+        const auto metadataSize = ColumnSmry::getLE<std::uint64_t>(size.data());
+        if (!fileH || (metadataSize > committed - ColumnSmry::headerSize - size.size()))
+            OPM_THROW(std::runtime_error, "Invalid index in columnar summary file " + m_inputFileName.string());
+
+        std::vector<char> buffer(metadataSize);
+        fileH.read(buffer.data(), buffer.size());
+        ColumnSmry::decodeMetadata(buffer.data(), buffer.size(), *index);
+        index->end = ColumnSmry::headerSize + size.size() + metadataSize;
+
+        m_index = std::move(index);
+
+        m_keyIndex.clear();
+        for (std::size_t n = 0; n < m_index->keys.size(); ++n)
+            m_keyIndex.emplace(m_index->keys[n], n);
+
+        m_startdat = make_date(m_index->startDate);
+    }
+
+    const auto nVect = m_index->keys.size();
+    std::vector<char> buffer(ColumnSmry::chunkIndexSize(nVect));
+
+    while (m_index->end < committed) {
+        ColumnSmry::ChunkIndex chunk;
+
+        fileH.seekg(static_cast<std::streamoff>(m_index->end));
+        fileH.read(buffer.data(), buffer.size());
+        const auto chunkSize = ColumnSmry::decodeChunkIndex(buffer.data(), nVect, chunk);
+
+        const auto numSteps = m_index->chunks.empty() ? 0
+            : m_index->chunks.back().firstStep + m_index->chunks.back().numSteps;
+
+        if (!fileH || (chunkSize < buffer.size()) || (chunkSize > committed - m_index->end) ||
+            (chunk.columnOffset.front() != 0) || (chunk.columnOffset.back() != chunkSize - buffer.size()) ||
+            !std::is_sorted(chunk.columnOffset.begin(), chunk.columnOffset.end()) || (chunk.firstStep != numSteps))
+            OPM_THROW(std::runtime_error, "Invalid index in columnar summary file " + m_inputFileName.string());
+
+        chunk.offset = m_index->end + buffer.size();
+        m_index->chunks.push_back(std::move(chunk));
+        m_index->end += chunkSize;
+    }
+
+    m_nTstep = 0;
+    if (!m_index->chunks.empty())
+        m_nTstep = m_index->chunks.back().firstStep + m_index->chunks.back().numSteps;
+}
+
+
+std::size_t ColumnESmry::keyIndex(const std::string& name) const
+{
+    auto search = m_keyIndex.find(name);
+    if (search == m_keyIndex.end())
+        throw std::invalid_argument("summary key '" + name + "' not found");
+
+    return search->second;
+}
+
+
+std::vector<std::vector<std::uint32_t>>
+ColumnESmry::readColumns(const std::vector<std::size_t>& columns, std::size_t from, std::size_t to) const
+{
+    to = std::min(to, m_nTstep);
+    from = std::min(from, to);
+
+    std::vector<std::vector<std::uint32_t>> result(columns.size());
+    for (auto& values : result)
+        values.reserve(to - from);
+
+    if ((from == to) || columns.empty())
+        return result;
+
+    std::ifstream fileH(m_inputFileName, std::ios::binary);
+    if (!fileH)
+        OPM_THROW(std::runtime_error, "Can not open columnar summary file " + m_inputFileName.string());
+
+    const auto [first_col, last_col] = std::minmax_element(columns.begin(), columns.end());
+
+    std::vector<char> buffer;
+    std::vector<std::uint32_t> values;
+    for (const auto& chunk : m_index->chunks) {
+        const auto chunk_end = chunk.firstStep + chunk.numSteps;
+        if ((chunk_end <= from) || (chunk.firstStep >= to))
+            continue;
+
+        // One read per chunk, covering all the requested columns.
+        const auto begin = chunk.columnOffset[*first_col];
+        const auto end = chunk.columnOffset[*last_col + 1];
+
+        buffer.resize(end - begin);
+        fileH.seekg(static_cast<std::streamoff>(chunk.offset + begin));
+        fileH.read(buffer.data(), buffer.size());
+        if (!fileH)
+            OPM_THROW(std::runtime_error, "Error reading columnar summary file " + m_inputFileName.string());
+
+        const auto lo = std::max<std::uint64_t>(from, chunk.firstStep) - chunk.firstStep;
+        const auto hi = std::min<std::uint64_t>(to, chunk_end) - chunk.firstStep;
+
+        values.resize(chunk.numSteps);
+        for (std::size_t c = 0; c < columns.size(); ++c) {
+            const auto col = columns[c];
+            ColumnSmry::decompressColumn(buffer.data() + (chunk.columnOffset[col] - begin),
+                                         chunk.columnOffset[col + 1] - chunk.columnOffset[col],
+                                         values.data(), values.size());
+
+            result[c].insert(result[c].end(), values.begin() + lo, values.begin() + hi);
+        }
+    }
+
+    return result;
+}
+
+
+std::vector<float> ColumnESmry::get(const std::string& name) const
+{
+    return this->get(name, 0, m_nTstep);
+}
+
+
+std::vector<float> ColumnESmry::get(const std::string& name, std::size_t from, std::size_t to) const
+{
+    return as_float(this->readColumns({ this->keyIndex(name) }, from, to).front());
+}
+
+
+std::vector<std::vector<float>>
+ColumnESmry::get(const std::vector<std::string>& names, std::size_t from, std::size_t to) const
+{
+    std::vector<std::size_t> columns;
+    columns.reserve(names.size());
+    for (const auto& name : names)
+        columns.push_back(this->keyIndex(name));
+
+    std::vector<std::vector<float>> result;
+    result.reserve(names.size());
+    for (const auto& bits : this->readColumns(columns, from, to))
+        result.push_back(as_float(bits));
+
+    return result;
+}
+
+
+std::vector<float> ColumnESmry::get_at_rstep(const std::string& name) const
+{
+    const auto nVect = m_index->keys.size();
+    const auto columns = this->readColumns({ this->keyIndex(name), nVect }, 0, m_nTstep);
+
+    const auto values = as_float(columns[0]);
+    const auto& is_rstep = columns[1];
+
+    std::vector<float> rs_vect;
+    for (std::size_t n = 0; n < values.size(); ++n)
+        if (is_rstep[n] != 0)
+            rs_vect.push_back(values[n]);
+
+    return rs_vect;
+}
+
+
+const std::string& ColumnESmry::get_unit(const std::string& name) const
+{
+    return m_index->units[this->keyIndex(name)];
+}
+
+
+const std::vector<int>& ColumnESmry::start_v() const
+{
+    return m_index->startDate;
+}
+
+
+std::vector<time_point> ColumnESmry::dates() const
+{
+    const double time_unit = 24 * 3600;
+    std::vector<time_point> d;
+
+    for (const auto& t : this->get("TIME"))
+        d.push_back( m_startdat + std::chrono::duration_cast<std::chrono::seconds>( std::chrono::duration<double, std::chrono::seconds::period>( t * time_unit)));
+
+    return d;
+}
+
+
+bool ColumnESmry::hasKey(const std::string& key) const
+{
+    return m_keyIndex.find(key) != m_keyIndex.end();
+}
+
+
+std::size_t ColumnESmry::numberOfVectors() const
+{
+    return m_index->keys.size();
+}
+
+
+const std::vector<std::string>& ColumnESmry::keywordList() const
+{
+    return m_index->keys;
+}
+
+
+std::vector<std::string> ColumnESmry::keywordList(const std::string& pattern) const
+{
+    std::vector<std::string> list;
+
+    for (auto index : shmatch(pattern, m_index->keys))
+        list.push_back(m_index->keys[index]);
+
+    return list;
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,261 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "src/opm/io/eclipse/ColumnSmryFormat.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+
+constexpr std::size_t maxRun = 128;
+
+template <typename T>
+void append(std::vector<char>& buffer, T value)
+{
+    const auto pos = buffer.size();
+    buffer.resize(pos + sizeof value);
+    Opm::EclIO::ColumnSmry::putLE(buffer.data() + pos, value);
+}
+
+void append(std::vector<char>& buffer, const std::string& value)
+{
+    append<std::uint32_t>(buffer, value.size());
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+class MetadataReader
+{
+public:
+    MetadataReader(const char* data, std::size_t size)
+        : m_data(data), m_size(size)
+    {}
+
+    template <typename T>
+    T read()
+    {
+        return Opm::EclIO::ColumnSmry::getLE<T>(this->next(sizeof(T)));
+    }
+
+    std::string readString()
+    {
+        const auto size = this->read<std::uint32_t>();
+        return { this->next(size), size };
+    }
+
+private:
+    const char* m_data;
+    std::size_t m_size;
+    std::size_t m_pos = 0;
+
+    const char* next(std::size_t size)
+    {
+        if (size > this->m_size - this->m_pos)
+            throw std::runtime_error("Unexpected end of summary metadata");
+
+        const char* ptr = this->m_data + this->m_pos;
+        this->m_pos += size;
+        return ptr;
+    }
+};
+
+}
+
+namespace Opm { namespace EclIO { namespace ColumnSmry {
+
+std::vector<char> compressColumn(const std::uint32_t* values, std::size_t size)
+{
+    std::vector<unsigned char> planes(4 * size);
+
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        const std::uint32_t x = values[i] ^ prev;
+        prev = values[i];
+
+        for (std::size_t b = 0; b < 4; ++b)
+            planes[b * size + i] = static_cast<unsigned char>(x >> (8 * b));
+    }
+
+    // Control byte c: c < 0x80 => c + 1 literal bytes follow,
+    //                 c >= 0x80 => (c & 0x7f) + 1 zero bytes.
+    std::vector<char> out;
+    std::size_t pos = 0;
+    while (pos < planes.size()) {
+        if (planes[pos] == 0) {
+            std::size_t run = 1;
+            while ((pos + run < planes.size()) && (planes[pos + run] == 0) && (run < maxRun))
+                ++run;
+
+            out.push_back(static_cast<char>(0x80 | (run - 1)));
+            pos += run;
+        }
+        else {
+            std::size_t run = 1;
+            while ((pos + run < planes.size()) && (run < maxRun)) {
+                const bool zero_run = (planes[pos + run] == 0) &&
+                    ((pos + run + 1 == planes.size()) || (planes[pos + run + 1] == 0));
+
+                if (zero_run)
+                    break;
+
+                ++run;
+            }
+
+            out.push_back(static_cast<char>(run - 1));
+            out.insert(out.end(), planes.begin() + pos, planes.begin() + pos + run);
+            pos += run;
+        }
+    }
+
+    return out;
+}
+
+
+void decompressColumn(const char* data, std::size_t dataSize, std::uint32_t* values, std::size_t size)
+{
+    std::vector<unsigned char> planes(4 * size);
+
+    std::size_t in = 0;
+    std::size_t pos = 0;
+    while (in < dataSize) {
+        const auto control = static_cast<unsigned char>(data[in++]);
+        const std::size_t run = (control & 0x7f) + 1;
+
+        if (pos + run > planes.size())
+            throw std::runtime_error("Corrupt summary data column");
+
+        if (control & 0x80) {
+            std::fill_n(planes.begin() + pos, run, 0);
+        }
+        else {
+            if (in + run > dataSize)
+                throw std::runtime_error("Corrupt summary data column");
+
+            std::memcpy(planes.data() + pos, data + in, run);
+            in += run;
+        }
+
+        pos += run;
+    }
+
+    if (pos != planes.size())
+        throw std::runtime_error("Corrupt summary data column");
+
+    std::uint32_t prev = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        std::uint32_t x = 0;
+        for (std::size_t b = 0; b < 4; ++b)
+            x |= static_cast<std::uint32_t>(planes[b * size + i]) << (8 * b);
+
+        prev ^= x;
+        values[i] = prev;
+    }
+}
+
+
+std::vector<char> encodeHeader(std::uint64_t committedSize)
+{
+    std::vector<char> buffer(magic.begin(), magic.end());
+    append<std::uint32_t>(buffer, formatVersion);
+    append<std::uint32_t>(buffer, 0);
+    append<std::uint64_t>(buffer, committedSize);
+
+    return buffer;
+}
+
+
+std::vector<char> encodeMetadata(const std::vector<int>& startDate,
+                                 const std::vector<std::string>& keys,
+                                 const std::vector<std::string>& units)
+{
+    std::vector<char> buffer;
+    append<std::uint64_t>(buffer, 0);
+
+    append<std::uint32_t>(buffer, startDate.size());
+    for (const auto& value : startDate)
+        append<std::int32_t>(buffer, value);
+
+    append<std::uint32_t>(buffer, keys.size());
+    for (std::size_t n = 0; n < keys.size(); ++n) {
+        append(buffer, keys[n]);
+        append(buffer, units[n]);
+    }
+
+    putLE<std::uint64_t>(buffer.data(), buffer.size() - sizeof(std::uint64_t));
+
+    return buffer;
+}
+
+
+void decodeMetadata(const char* data, std::size_t size, Index& index)
+{
+    MetadataReader reader(data, size);
+
+    index.startDate.resize(reader.read<std::uint32_t>());
+    for (auto& value : index.startDate)
+        value = reader.read<std::int32_t>();
+
+    const auto nVect = reader.read<std::uint32_t>();
+    index.keys.clear();
+    index.units.clear();
+    for (std::size_t n = 0; n < nVect; ++n) {
+        index.keys.push_back(reader.readString());
+        index.units.push_back(reader.readString());
+    }
+}
+
+
+std::size_t chunkIndexSize(std::size_t nVect)
+{
+    return 2 * sizeof(std::uint64_t) + sizeof(std::uint32_t) + (nVect + 2) * sizeof(std::uint32_t);
+}
+
+
+std::vector<char> encodeChunkIndex(std::uint64_t chunkSize, const ChunkIndex& chunk)
+{
+    std::vector<char> buffer;
+    buffer.reserve(chunkIndexSize(chunk.columnOffset.size() - 2));
+
+    append(buffer, chunkSize);
+    append(buffer, chunk.firstStep);
+    append(buffer, chunk.numSteps);
+
+    for (const auto& offset : chunk.columnOffset)
+        append(buffer, offset);
+
+    return buffer;
+}
+
+
+std::uint64_t decodeChunkIndex(const char* data, std::size_t nVect, ChunkIndex& chunk)
+{
+    MetadataReader reader(data, chunkIndexSize(nVect));
+
+    const auto chunkSize = reader.read<std::uint64_t>();
+    chunk.firstStep = reader.read<std::uint64_t>();
+    chunk.numSteps = reader.read<std::uint32_t>();
+
+    chunk.columnOffset.resize(nVect + 2);
+    for (auto& offset : chunk.columnOffset)
+        offset = reader.read<std::uint32_t>();
+
+    return chunkSize;
+}
+
+}}} // namespace Opm::EclIO::ColumnSmry
@@ -0,0 +1,130 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#ifndef OPM_IO_COLUMN_SMRY_FORMAT_HPP
+#define OPM_IO_COLUMN_SMRY_FORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/*
+  Layout of the columnar summary (.CSMRY) file. All integers are stored
+  little endian, independent of the byte order of the host, see putLE()
+  and getLE(). Summary values are stored as the bit patterns of IEEE 754
+  single precision numbers, and handled as 32 bit unsigned integers.
+
+    header   : magic (8 bytes), format version (uint32), unused (uint32),
+               committed size (uint64)
+    metadata : size (uint64), start date, keys, units
+    chunk 0  : chunk index, column 0 .. column nVect-1, report step flags
+    chunk 1  : ...
+
+  A chunk holds a fixed range of time steps. Each column in a chunk is
+  compressed separately, so a single vector can be read for a range of
+  time steps with one read per chunk. The chunk index holds the size of
+  the chunk and the position of each column, and readers find the chunks
+  by stepping from one chunk index to the next.
+
+  The file is only appended to. The writer writes and flushes a new chunk
+  after the existing data, and then updates the committed size in the
+  header. Readers ignore data beyond the committed size, so they never
+  see a partially written chunk, and a reader which is refreshed only
+  reads the chunk indices written since the previous refresh.
+*/
+
+namespace Opm { namespace EclIO { namespace ColumnSmry {
+
+constexpr std::array<char, 8> magic = { 'O', 'P', 'M', 'C', 'S', 'M', 'R', 'Y' };
+constexpr std::uint32_t formatVersion = 2;
+
+constexpr std::size_t committedSizePos = magic.size() + 2 * sizeof(std::uint32_t);
+constexpr std::size_t headerSize = committedSizePos + sizeof(std::uint64_t);
+
+template <typename T>
+void putLE(char* out, T value)
+{
+    const auto bits = static_cast<std::make_unsigned_t<T>>(value);
+    for (std::size_t b = 0; b < sizeof(T); ++b)
+        out[b] = static_cast<char>((bits >> (8 * b)) & 0xff);
+}
+
+template <typename T>
+T getLE(const char* in)
+{
+    std::make_unsigned_t<T> bits = 0;
+    for (std::size_t b = 0; b < sizeof(T); ++b)
+        bits |= static_cast<std::make_unsigned_t<T>>(static_cast<unsigned char>(in[b])) << (8 * b);
+
+    return static_cast<T>(bits);
+}
+
+struct ChunkIndex
+{
+    // File position of the first column.
+    std::uint64_t offset = 0;
+    std::uint64_t firstStep = 0;
+    std::uint32_t numSteps = 0;
+
+    // Start of each column relative to offset, with one extra entry for
+    // the end of the chunk. The last column holds the report step flags.
+    std::vector<std::uint32_t> columnOffset;
+};
+
+struct Index
+{
+    std::vector<int> startDate;
+    std::vector<std::string> keys;
+    std::vector<std::string> units;
+    std::vector<ChunkIndex> chunks;
+
+    // File position after the last chunk in chunks.
+    std::uint64_t end = 0;
+};
+
+// Compress the 32 bit values in a column. Consecutive values are XOR'ed,
+// the result is split into byte planes and runs of zero bytes are run
+// length encoded; slowly varying and constant vectors compress well.
+std::vector<char> compressColumn(const std::uint32_t* values, std::size_t size);
+void decompressColumn(const char* data, std::size_t dataSize, std::uint32_t* values, std::size_t size);
+
+std::vector<char> encodeHeader(std::uint64_t committedSize);
+
+// Metadata with its size prefix.
+std::vector<char> encodeMetadata(const std::vector<int>& startDate,
+                                 const std::vector<std::string>& keys,
+                                 const std::vector<std::string>& units);
+
+// Metadata without the size prefix. Sets startDate, keys and units.
+void decodeMetadata(const char* data, std::size_t size, Index& index);
+
+std::size_t chunkIndexSize(std::size_t nVect);
+
+// Chunk index for a chunk of the given size, including the chunk index.
+std::vector<char> encodeChunkIndex(std::uint64_t chunkSize, const ChunkIndex& chunk);
+
+// Returns the size of the chunk, and sets all members of chunk except
+// offset.
+std::uint64_t decodeChunkIndex(const char* data, std::size_t nVect, ChunkIndex& chunk);
+
+}}} // namespace Opm::EclIO::ColumnSmry
+
+#endif // OPM_IO_COLUMN_SMRY_FORMAT_HPP
@@ -0,0 +1,156 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include <opm/io/eclipse/ColumnSmryOutput.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include "src/opm/io/eclipse/ColumnSmryFormat.hpp"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace Opm { namespace EclIO {
+
+ColumnSmryOutput::ColumnSmryOutput(const std::string& filename,
+                                   const std::vector<std::string>& keys,
+                                   const std::vector<std::string>& units,
+                                   const std::vector<int>& startDate,
+                                   std::size_t chunkSize)
+    : m_chunkSize(chunkSize)
+    , m_nVect(keys.size())
+    , m_numWritten(0)
+    , m_end(0)
+    , m_pending(keys.size() + 1)
+{
+    if (units.size() != keys.size())
+        throw std::invalid_argument("number of summary units not same as number of summary keys");
+
+    if (chunkSize == 0)
+        throw std::invalid_argument("chunk size of columnar summary file must be positive");
+
+    m_file.open(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!m_file)
+        throw std::runtime_error("Could not open summary file " + filename);
+
+    const auto header = ColumnSmry::encodeHeader(0);
+    const auto metadata = ColumnSmry::encodeMetadata(startDate, keys, units);
+    m_file.write(header.data(), header.size());
+    m_file.write(metadata.data(), metadata.size());
+
+    // Empty file with valid metadata, readers can open the file at once.
+    this->commit(header.size() + metadata.size());
+}
+
+
+ColumnSmryOutput::~ColumnSmryOutput()
+{
+    try {
+        this->flush();
+    }
+    catch (const std::exception& e) {
+        OpmLog::warning(std::string("Failed writing columnar summary file: ") + e.what());
+    }
+}
+
+
+void ColumnSmryOutput::write(const std::vector<float>& ts_data, bool is_report_step)
+{
+    if (ts_data.size() != m_nVect)
+        throw std::invalid_argument("size of ts_data vector not same as number of smry vectors");
+
+    for (std::size_t n = 0; n < m_nVect; ++n) {
+        std::uint32_t bits;
+        std::memcpy(&bits, &ts_data[n], sizeof bits);
+        m_pending[n].push_back(bits);
+    }
+
+    m_pending[m_nVect].push_back(is_report_step ? 1 : 0);
+
+    if (m_pending[m_nVect].size() >= m_chunkSize)
+        this->flush();
+}
+
+
+void ColumnSmryOutput::flush()
+{
+    const auto numSteps = m_pending[m_nVect].size();
+    if (numSteps == 0)
+        return;
+
+    ColumnSmry::ChunkIndex chunk;
+    chunk.firstStep = m_numWritten;
+    chunk.numSteps = static_cast<std::uint32_t>(numSteps);
+    chunk.columnOffset.reserve(m_pending.size() + 1);
+
+    std::vector<char> data;
+    for (auto& column : m_pending) {
+        const auto compressed = ColumnSmry::compressColumn(column.data(), column.size());
+
+        if (data.size() + compressed.size() > std::numeric_limits<std::uint32_t>::max())
+            throw std::runtime_error("Summary chunk too large, reduce the chunk size");
+
+        chunk.columnOffset.push_back(static_cast<std::uint32_t>(data.size()));
+        data.insert(data.end(), compressed.begin(), compressed.end());
+    }
+    chunk.columnOffset.push_back(static_cast<std::uint32_t>(data.size()));
+
+    const auto chunkSize = ColumnSmry::chunkIndexSize(m_nVect) + data.size();
+    const auto index = ColumnSmry::encodeChunkIndex(chunkSize, chunk);
+
+    m_file.seekp(static_cast<std::streamoff>(m_end));
+    m_file.write(index.data(), index.size());
+    m_file.write(data.data(), data.size());
+
+    this->commit(m_end + chunkSize);
+
+    for (auto& column : m_pending)
+        column.clear();
+
+    m_numWritten += numSteps;
+}
+
+
+// Data up to end must be written before the committed size is updated,
+// readers may see the new size as soon as it is written.
+void ColumnSmryOutput::commit(std::uint64_t end)
+{
+    m_file.flush();
+
+    std::array<char, sizeof end> committed;
+    ColumnSmry::putLE(committed.data(), end);
+
+    m_file.seekp(static_cast<std::streamoff>(ColumnSmry::committedSizePos));
+    m_file.write(committed.data(), committed.size());
+    m_file.flush();
+
+    if (!m_file)
+        throw std::runtime_error("Failed writing columnar summary file");
+
+    m_end = end;
+}
+
+
+std::size_t ColumnSmryOutput::numberOfTimeSteps() const
+{
+    return m_numWritten + m_pending[m_nVect].size();
+}
+
+}} // namespace Opm::EclIO
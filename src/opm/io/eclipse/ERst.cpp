@@ -17,6 +17,7 @@
    */
 
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/RestartIndex.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
@@ -52,8 +53,21 @@ namespace {
 namespace Opm { namespace EclIO {
 
 ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+    : ERst(filename, MemoryMapped{ false })
+{}
+
+
+// Use the restart index if there is one which matches the file.  This
+// avoids scanning all array headers of a large unified restart file.
+ERst::ERst(const std::string& filename, MemoryMapped mmap)
+    : EclFile(filename, mmap, Deferred{})
 {
+    if (this->initIndexed()) {
+        return;
+    }
+
+    this->load(false);
+
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
     }
@@ -90,6 +104,25 @@ void ERst::loadReportStepNumber(int number)
 }
 
 
+void ERst::loadReportStepNumber(int number, const std::vector<std::string>& names)
+{
+    if (!hasReportStepNumber(number)) {
+        std::string message="Trying to load non existing report step number " + std::to_string(number);
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    std::vector<int> arrayIndexList;
+
+    for (int i = arrIndexRange.at(number).first; i < arrIndexRange.at(number).second; i++) {
+        if (std::find(names.begin(), names.end(), array_name[i]) != names.end()) {
+            arrayIndexList.push_back(i);
+        }
+    }
+
+    loadData(arrayIndexList);
+}
+
+
 std::vector<EclFile::EclEntry> ERst::listOfRstArrays(int reportStepNumber)
 {
     return this->listOfRstArrays(reportStepNumber, "global");
@@ -188,6 +221,53 @@ void ERst::initUnified()
         }
     }
 
+    this->initRanges(firstIndex);
+}
+
+bool ERst::initIndexed()
+{
+    if (this->formatted) {
+        return false;
+    }
+
+    const auto steps = RestartIndex::read(this->inputFilename);
+    if (steps.empty()) {
+        return false;
+    }
+
+    std::vector<int> firstIndex;
+
+    for (const auto& step : steps) {
+        firstIndex.push_back(array_name.size());
+        seqnum.push_back(step.seqnum);
+        lgr_names.push_back({});
+
+        for (const auto& array : step.arrays) {
+            this->addArray(array.name, array.type, array.size,
+                           array.elementSize, array.dataPos);
+        }
+    }
+
+    this->addEndOfFile(steps.back().endPos);
+    this->initRanges(firstIndex);
+
+    // SEQNUM values are known from the index.  Only the LGR names, if
+    // any, must be read from the file.
+    for (size_t i = 0; i < seqnum.size(); i++) {
+        const auto& range = arrIndexRange[seqnum[i]];
+
+        for (int n = range.first; n < range.second; n++) {
+            if (array_name[n] == "LGRNAMES") {
+                lgr_names[i] = getImpl(n, CHAR, char_array, "string");
+            }
+        }
+    }
+
+    return true;
+}
+
+void ERst::initRanges(const std::vector<int>& firstIndex)
+{
     for (size_t i = 0; i < seqnum.size(); i++) {
         std::pair<int,int> range;
         range.first = firstIndex[i];
@@ -24,6 +24,7 @@
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/io/eclipse/ColumnSmryOutput.hpp>
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
@@ -37,6 +38,7 @@
 #include <fstream>
 #include <iterator>
 #include <limits>
+#include <numeric>
 #include <regex>
 #include <set>
 #include <stdexcept>
@@ -498,6 +500,7 @@ ESmry::ESmry(const std::string &filename, bool loadBaseRunData) :
 
     vectorData.reserve(nVect);
     vectorLoaded.reserve(nVect);
+    vectorLoading.assign(nVect, false);
 
     for (size_t n = 0; n < nVect; n ++){
         vectorData.push_back({});
@@ -715,29 +718,97 @@ std::string ESmry::read_string_from_disk(std::fstream& fileH, uint64_t size) con
 
 void ESmry::loadData(const std::vector<std::string>& vectList) const
 {
-    auto start = std::chrono::system_clock::now();
-    size_t nvect = vectList.size();
-
     std::vector<int> keywIndVect;
-    keywIndVect.reserve(nvect);
-
-    for (auto key : vectList) {
-        if (!hasKey(key))
-            OPM_THROW(std::invalid_argument, "error loading key " + key );
+    keywIndVect.reserve(vectList.size());
 
+    for (const auto& key : vectList) {
         auto it = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
-            keywIndVect.push_back(it->second);
+        if (it == keyword_index.end())
+            OPM_THROW(std::invalid_argument, "error loading key " + key );
+
+        keywIndVect.push_back(it->second);
     }
 
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
+    this->loadVectors(keywIndVect, false);
+}
 
-    std::fstream fileH;
+// Load the vectors in keywIndVect which are not already loaded. Vectors
+// are read without holding m_load_mutex, so threads loading different
+// vectors do not wait for each other. A thread claims the vectors which
+// are neither loaded nor being loaded, reads them and publishes them.
+// Vectors claimed by other threads are waited for, and claimed again if
+// the other thread fails to load them.
+void ESmry::loadVectors(const std::vector<int>& keywIndVect, bool allParams) const
+{
+    std::vector<int> pending(keywIndVect);
+
+    while (true) {
+        std::vector<int> loadInd;
+
+        {
+            std::unique_lock<std::mutex> lock(m_load_mutex);
+
+            pending.erase(std::remove_if(pending.begin(), pending.end(),
+                                         [this](int ind) { return vectorLoaded[ind]; }),
+                          pending.end());
+
+            for (auto ind : pending) {
+                if (!vectorLoading[ind]) {
+                    vectorLoading[ind] = true;
+                    loadInd.push_back(ind);
+                }
+            }
+
+            if (loadInd.empty()) {
+                if (pending.empty())
+                    return;
+
+                m_load_cv.wait(lock);
+                continue;
+            }
+        }
+
+        auto start = std::chrono::system_clock::now();
+        std::vector<std::vector<float>> data(loadInd.size());
+
+        try {
+            if (allParams)
+                this->readAllVectors(loadInd, data);
+            else
+                this->readVectors(loadInd, data);
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(m_load_mutex);
+            for (auto ind : loadInd)
+                vectorLoading[ind] = false;
+
+            m_load_cv.notify_all();
+            throw;
+        }
+
+        std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+
+        std::lock_guard<std::mutex> lock(m_load_mutex);
+        for (std::size_t n = 0; n < loadInd.size(); ++n) {
+            vectorData[loadInd[n]] = std::move(data[n]);
+            vectorLoaded[loadInd[n]] = true;
+            vectorLoading[loadInd[n]] = false;
+        }
+
+        m_io_loading += elapsed_seconds.count();
+        m_load_cv.notify_all();
+    }
+}
+
+// Read the vectors in loadInd. For each ministep the part of the PARAMS
+// array which covers all the requested vectors is read at once, and the
+// values are scattered to the vectors.
+void ESmry::readVectors(const std::vector<int>& loadInd, std::vector<std::vector<float>>& data) const
+{
+    for (auto& values : data)
+        values.reserve(nTstep);
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
     std::uint64_t blockSize_f;
 
     {
@@ -747,15 +818,71 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
         blockSize_f= static_cast<std::uint64_t>(MaxNumBlockReal * numColumnsReal * columnWidthReal + nLinesBlock);
     }
 
+    // Position of each requested vector relative to the start of the
+    // PARAMS data for one ministep, -1 if not defined in the spec file.
+    auto elementPositions = [&](int specInd)
+    {
+        std::vector<std::int64_t> positions;
+        positions.reserve(loadInd.size());
+
+        for (auto ind : loadInd) {
+            auto it = arrayPos[specInd].find(ind);
+            if (it == arrayPos[specInd].end()) {
+                // undefined vector in current summary file. Typically when loading
+                // base restart run and including base run data. Vectors can be added to restart runs
+                positions.push_back(-1);
+                continue;
+            }
+
+            const int paramPos = it->second;
+
+            if (formattedFiles[specInd]) {
+                std::uint64_t elementPos = 0;
+                int nBlocks = paramPos / MaxBlockSizeReal;
+                int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
+
+                if (nBlocks > 0)
+                    elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+
+                int nLines = sizeOfLastBlock / numColumnsReal;
+                positions.push_back(elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines));
+            }
+            else {
+                const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
+                std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
+                positions.push_back(elementPos + static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal));
+            }
+        }
+
+        return positions;
+    };
+
+    std::fstream fileH;
+
+    auto specInd = std::get<0>(timeStepList[0]);
+    auto dataFileIndex = std::get<1>(timeStepList[0]);
+
+    auto positions = elementPositions(specInd);
+    std::int64_t elementSize = formattedFiles[specInd] ? columnWidthReal : sizeOfReal;
+
     if (formattedFiles[specInd])
         fileH.open(dataFileList[dataFileIndex], std::ios::in);
     else
         fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
 
+    std::vector<char> buffer;
+    std::string element;
+
     for (const auto& ministep : timeStepList) {
         if (dataFileIndex != std::get<1>(ministep)) {
             fileH.close();
-            specInd = std::get<0>(ministep);
+
+            if (specInd != std::get<0>(ministep)) {
+                specInd = std::get<0>(ministep);
+                positions = elementPositions(specInd);
+                elementSize = formattedFiles[specInd] ? columnWidthReal : sizeOfReal;
+            }
+
             dataFileIndex = std::get<1>(ministep);
 
             if (formattedFiles[specInd])
@@ -764,59 +891,41 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                 fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
         }
 
-        const auto stepFilePos = std::get<2>(ministep);;
-
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
-            if (it == arrayPos[specInd].end()) {
-                // undefined vector in current summary file. Typically when loading
-                // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
-            }
-            else {
-                int paramPos = it->second;
-
-                if (formattedFiles[specInd]) {
-                    std::uint64_t elementPos = 0;
-                    int nBlocks = paramPos / MaxBlockSizeReal;
-                    int sizeOfLastBlock = paramPos %  MaxBlockSizeReal;
-
-                    if (nBlocks > 0)
-                        elementPos = static_cast<uint64_t>(nBlocks * blockSize_f);
+        std::int64_t lo = std::numeric_limits<std::int64_t>::max();
+        std::int64_t hi = -1;
+        for (auto pos : positions) {
+            if (pos < 0)
+                continue;
 
-                    int nLines = sizeOfLastBlock / numColumnsReal;
-                    elementPos = stepFilePos + elementPos + static_cast<std::uint64_t>(sizeOfLastBlock*columnWidthReal + nLines);
-
-                    fileH.seekg (elementPos, fileH.beg);
-
-                    const std::size_t size = columnWidthReal;
-                    std::vector<char> buffer(size);
-                    fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
-                }
-                else {
-                    const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
-                    std::uint64_t elementPos = ((2 * nFullBlocks) + 1) * static_cast<std::uint64_t>(sizeOfInte);
-                    elementPos += static_cast<std::uint64_t>(paramPos) * static_cast<std::uint64_t>(sizeOfReal) + stepFilePos;
+            lo = std::min(lo, pos);
+            hi = std::max(hi, pos + elementSize);
+        }
 
-                    fileH.seekg (elementPos, fileH.beg);
+        if (hi > lo) {
+            buffer.resize(hi - lo);
+            fileH.seekg (std::get<2>(ministep) + lo, fileH.beg);
+            fileH.read (buffer.data(), buffer.size());
+        }
 
-                    float value;
-                    fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
+        for (std::size_t n = 0; n < loadInd.size(); ++n) {
+            const auto pos = positions[n];
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
-                }
+            if (pos < 0) {
+                data[n].push_back(std::nanf(""));
+            }
+            else if (formattedFiles[specInd]) {
+                element.assign(buffer.data() + (pos - lo), elementSize);
+                data[n].push_back(std::strtof(element.c_str(), nullptr));
+            }
+            else {
+                float value;
+                std::memcpy(&value, buffer.data() + (pos - lo), sizeof value);
+                data[n].push_back(Opm::EclIO::flipEndianFloat(value));
             }
         }
     }
 
     fileH.close();
-
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
-
-    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
-    m_io_loading += elapsed_seconds.count();
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -843,6 +952,22 @@ std::vector<int> ESmry::makeKeywPosVector(int specInd) const
 
 void ESmry::loadData() const
 {
+    std::vector<int> keywIndVect(nVect);
+    std::iota(keywIndVect.begin(), keywIndVect.end(), 0);
+
+    this->loadVectors(keywIndVect, true);
+}
+
+// Read the vectors in loadInd by reading the complete PARAMS array of each
+// ministep.
+void ESmry::readAllVectors(const std::vector<int>& loadInd, std::vector<std::vector<float>>& data) const
+{
+    std::vector<int> slot(nVect, -1);
+    for (std::size_t n = 0; n < loadInd.size(); ++n) {
+        slot[loadInd[n]] = static_cast<int>(n);
+        data[n].reserve(nTstep);
+    }
+
     std::fstream fileH;
 
     auto specInd = std::get<0>(timeStepList[0]);
@@ -886,14 +1011,16 @@ void ESmry::loadData() const
             const auto fileStr = std::string_view(buffer.data(), size);
             std::size_t p = 0;
             std::int64_t p1= 0;
+            std::string element;
 
             for (int i=0; i< nParamsSpecFile[specInd]; ++i, ++p) {
                 p1 = fileStr.find_first_not_of(' ',p1);
                 const std::int64_t p2 = fileStr.find_first_of(' ', p1);
 
-                if ((keywpos[p] > -1) && !vectorLoaded[keywpos[p]]) {
-                    const auto dtmpv = std::strtof(fileStr.substr(p1, p2-p1).data(), nullptr);
-                    vectorData[keywpos[p]].push_back(dtmpv);
+                // The element is not null terminated in the file buffer.
+                if ((keywpos[p] > -1) && (slot[keywpos[p]] > -1)) {
+                    element.assign(fileStr.substr(p1, p2-p1));
+                    data[slot[keywpos[p]]].push_back(std::strtof(element.c_str(), nullptr));
                 }
 
                 p1 = fileStr.find_first_not_of(' ',p2);
@@ -916,8 +1043,8 @@ void ESmry::loadData() const
                     float value;
                     fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
 
-                    if ((keywpos[p] > -1) && !vectorLoaded[keywpos[p]])
-                        vectorData[keywpos[p]].push_back(Opm::EclIO::flipEndianFloat(value));
+                    if ((keywpos[p] > -1) && (slot[keywpos[p]] > -1))
+                        data[slot[keywpos[p]]].push_back(Opm::EclIO::flipEndianFloat(value));
                 }
 
                 rest -= num;
@@ -938,8 +1065,6 @@ void ESmry::loadData() const
             }
         }
     }
-
-    std::fill_n(vectorLoaded.begin(), nVect, true);
 }
 
 
@@ -1126,6 +1251,55 @@ bool ESmry::make_esmry_file()
     }
 }
 
+bool ESmry::make_csmry_file(std::size_t chunkSize)
+{
+    // Same restrictions as make_esmry_file(), an existing CSMRY file is
+    // not replaced.
+
+    if (!fromSingleRun)
+        OPM_THROW(std::invalid_argument, "creating csmry file only possible when loadBaseRunData=false");
+
+    std::filesystem::path smryDataFile = inputFileName.parent_path() / inputFileName.stem() += ".CSMRY";
+
+    if (Opm::EclIO::fileExists(smryDataFile))
+        return false;
+
+    this->loadData();
+
+    std::vector<int> start_date_vect = start_vect;
+    if (start_date_vect.size() < 6)
+        start_date_vect.resize(6);
+
+    const int sec = start_date_vect[5] / 1000000;
+    const int millisec = (start_date_vect[5] % 1000000) / 1000;
+
+    start_date_vect[5] = sec;
+    start_date_vect.push_back(millisec);
+
+    std::vector<std::string> units;
+    units.reserve(keyword.size());
+
+    for (const auto& key : keyword)
+        units.push_back(kwunits.at(key));
+
+    ColumnSmryOutput outFile(smryDataFile.string(), keyword, units, start_date_vect, chunkSize);
+
+    std::vector<float> ts_data(vectorData.size());
+    auto rstep = seqIndex.begin();
+    for (size_t i = 0; i < timeStepList.size(); i++) {
+        for (size_t n = 0; n < vectorData.size(); n++)
+            ts_data[n] = vectorData[n][i];
+
+        const bool is_rstep = (rstep != seqIndex.end()) && (*rstep == static_cast<int>(i));
+        if (is_rstep)
+            ++rstep;
+
+        outFile.write(ts_data, is_rstep);
+    }
+
+    return true;
+}
+
 std::vector<std::string> ESmry::checkForMultipleResultFiles(const std::filesystem::path& rootN, bool formatted) const {
 
     std::vector<std::string> fileList;
@@ -1358,10 +1532,9 @@ const std::vector<float>& ESmry::get(const std::string& name) const
 
     int ind = std::distance(keyword.begin(), it);
 
-    if (!vectorLoaded[ind]){
-        loadData({name});
-        vectorLoaded[ind]=true;
-    }
+    // A loaded vector is never modified again, the reference can be used
+    // without holding the lock.
+    this->loadVectors({ind}, false);
 
     return vectorData[ind];
 }
@@ -1399,9 +1572,8 @@ std::vector<std::string> ESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
 
-    for (auto key : keyword)
-        if (shmatch(pattern, key))
-            list.push_back(key);
+    for (auto index : shmatch(pattern, keyword))
+        list.push_back(keyword[index]);
 
     return list;
 }
@@ -1429,6 +1601,7 @@ std::vector<time_point> ESmry::dates_at_rstep() const {
 
 std::tuple<double, double> ESmry::get_io_elapsed() const
 {
+    std::lock_guard<std::mutex> lock(m_load_mutex);
     std::tuple<double, double> duration = std::make_tuple(m_io_opening, m_io_loading);
     return duration;
 }
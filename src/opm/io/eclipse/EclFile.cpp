@@ -16,24 +16,177 @@
    along with OPM.  If not, see <http://www.gnu.org/licenses/>.
    */
 
+#include <config.h>
+
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/common/ErrorMacros.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
 
 #include <fmt/format.h>
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <exception>
 #include <functional>
 #include <fstream>
 #include <iomanip>
 #include <iterator>
+#include <streambuf>
 #include <string>
 #include <numeric>
 #include <cmath>
 
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Read size bytes at offset from fd, without touching the file position
+// so several threads can read through the same descriptor.
+void readAt(int fd, std::uint64_t offset, std::size_t size, char* buffer)
+{
+    while (size > 0) {
+        const auto nread = ::pread(fd, buffer, size, static_cast<off_t>(offset));
+        if (nread <= 0)
+            throw std::runtime_error("Error reading binary data, unexpected end of file");
+
+        buffer += nread;
+        offset += nread;
+        size -= nread;
+    }
+}
+
+// Copy the elements of a binary array, stored in blocks enclosed by
+// record markers, to out and convert them from big endian. The swap
+// loops operate on plain unsigned integers and are vectorized. The
+// records must lie within the bufferSize bytes at buffer, and the head
+// and tail markers of each record must match.
+template <typename T>
+void decodeBinaryArray(const char* buffer, std::uint64_t bufferSize, std::int64_t size, T* out)
+{
+    using Raw = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+    constexpr int maxNumberOfElements = Opm::EclIO::MaxNumBlockInte;
+
+    const char* end = buffer + bufferSize;
+
+    std::int64_t rest = size;
+    while (rest > 0) {
+        if (static_cast<std::size_t>(end - buffer) < 2 * sizeof(std::int32_t))
+            OPM_THROW_NOLOG(std::runtime_error, "Error reading binary data, unexpected end of file");
+
+        std::int32_t dhead;
+        std::memcpy(&dhead, buffer, sizeof dhead);
+        const int num = Opm::EclIO::flipEndianInt(dhead) / static_cast<int>(sizeof(T));
+
+        if ((num > maxNumberOfElements) || (num <= 0) || (num > rest) ||
+            ((num < maxNumberOfElements) && (num != rest)))
+            OPM_THROW_NOLOG(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+
+        buffer += sizeof dhead;
+        if (static_cast<std::size_t>(end - buffer) < num * sizeof(T) + sizeof(std::int32_t))
+            OPM_THROW_NOLOG(std::runtime_error, "Error reading binary data, unexpected end of file");
+
+        std::int32_t dtail;
+        std::memcpy(&dtail, buffer + num * sizeof(T), sizeof dtail);
+        if (dtail != dhead)
+            OPM_THROW_NOLOG(std::runtime_error, "Error reading binary data, tail not matching header.");
+
+        std::memcpy(out, buffer, num * sizeof(T));
+
+        Raw* raw = reinterpret_cast<Raw*>(out);
+        for (int i = 0; i < num; ++i)
+            raw[i] = Opm::EclIO::byteSwap(raw[i]);
+
+        buffer += num * sizeof(T) + sizeof(std::int32_t);
+        out += num;
+        rest -= num;
+    }
+}
+
+// Read-only stream buffer on top of the decompressed records of an array.
+class ArrayBuffer : public std::streambuf
+{
+public:
+    explicit ArrayBuffer(std::vector<char>& data)
+    {
+        this->setg(data.data(), data.data(), data.data() + data.size());
+    }
+};
+
+// Checks for the marker of a compressed binary file.  Leaves the stream
+// positioned at the first array header.
+bool readCompressedFileMarker(std::fstream& fileH)
+{
+    char marker[Opm::EclIO::sizeOfCompressedFileMarker];
+    fileH.read(marker, sizeof marker);
+
+    const bool found = (fileH.gcount() == sizeof marker)
+        && (std::memcmp(marker, Opm::EclIO::compressedFileMarker, sizeof marker) == 0);
+
+    fileH.clear();
+    if (!found)
+        fileH.seekg(0, std::ios_base::beg);
+
+    return found;
+}
+
+}
+
 namespace Opm { namespace EclIO {
 
+class EclFile::Mapping
+{
+public:
+    explicit Mapping(const std::string& filename)
+    {
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error(fmt::format("Can not stat EclFile: {}", filename));
+        }
+
+        this->m_size = static_cast<std::size_t>(st.st_size);
+        if (this->m_size > 0) {
+            void* addr = ::mmap(nullptr, this->m_size, PROT_READ, MAP_SHARED, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error(fmt::format("Can not memory map EclFile: {}", filename));
+            }
+
+            this->m_data = static_cast<const char*>(addr);
+        }
+
+        ::close(fd);
+    }
+
+    ~Mapping()
+    {
+        if (this->m_data != nullptr)
+            ::munmap(const_cast<char*>(this->m_data), this->m_size);
+    }
+
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+
+    const char* data() const { return this->m_data; }
+    std::size_t size() const { return this->m_size; }
+
+private:
+    const char* m_data{nullptr};
+    std::size_t m_size{0};
+};
+
 void EclFile::load(bool preload) {
     std::fstream fileH;
 
@@ -46,6 +199,16 @@ void EclFile::load(bool preload) {
     if (!fileH)
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", this->inputFilename));
 
+    if (!formatted && readCompressedFileMarker(fileH)) {
+#if !HAVE_ZLIB
+        throw std::runtime_error(fmt::format("Can not read compressed EclFile: {}, "
+                                             "zlib support is not available", this->inputFilename));
+#endif
+        // The data of compressed files are never accessed in place.
+        this->compressed = true;
+        this->mapping.reset();
+    }
+
     int n = 0;
     while (!isEOF(&fileH)) {
         std::string arrName(8,' ');
@@ -71,10 +234,15 @@ void EclFile::load(bool preload) {
 
         arrayLoaded.push_back(false);
 
+        if (compressed)
+            compressedArrays.emplace_back();
+
         if (num > 0){
             if (formatted) {
                 std::uint64_t sizeOfNextArray = sizeOnDiskFormatted(num, arrType, sizeOfElement);
                 fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
+            } else if (compressed) {
+                readCompressedIndex(fileH, n);
             } else {
                 std::uint64_t sizeOfNextArray = sizeOnDiskBinary(num, arrType, sizeOfElement);
                 fileH.seekg(static_cast<std::streamoff>(sizeOfNextArray), std::ios_base::cur);
@@ -84,6 +252,8 @@ void EclFile::load(bool preload) {
         n++;
     };
 
+    // The stream is at end of file, clear its state before seeking.
+    fileH.clear();
     fileH.seekg(0, std::ios_base::end);
     this->ifStreamPos.push_back(static_cast<std::uint64_t>(fileH.tellg()));
     fileH.close();
@@ -102,20 +272,163 @@ EclFile::EclFile(const std::string& filename, EclFile::Formatted fmt, bool prelo
 
 
 EclFile::EclFile(const std::string& filename, bool preload) :
+    EclFile(filename, MemoryMapped{ false }, preload)
+{}
+
+
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
+    EclFile(filename, mmap, Deferred{})
+{
+    this->load(preload);
+}
+
+
+// Formatted files can not be memory mapped, they are silently read
+// through a file stream as usual.
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, Deferred) :
     inputFilename(filename)
 {
     if (!fileExists(filename))
         throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
 
     formatted = isFormatted(filename);
-    this->load(preload);
+    if (mmap.value && !formatted)
+        this->mapFile();
 }
 
 
-void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
+void EclFile::addArray(const std::string& name, eclArrType type, std::int64_t size,
+                       int elementSize, std::uint64_t dataPos)
 {
-    fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
+    array_index[name] = static_cast<int>(array_name.size());
+
+    array_name.push_back(name);
+    array_type.push_back(type);
+    array_size.push_back(size);
+    array_element_size.push_back(elementSize);
+    ifStreamPos.push_back(dataPos);
+    arrayLoaded.push_back(false);
+}
+
+
+void EclFile::addEndOfFile(std::uint64_t fileSize)
+{
+    ifStreamPos.push_back(fileSize);
+}
+
+
+void EclFile::mapFile()
+{
+    this->mapping = std::make_shared<const Mapping>(this->inputFilename);
+}
+
+
+bool EclFile::loadMappedArray(std::size_t arrIndex)
+{
+    if (!this->mapping)
+        return false;
 
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = this->viewImpl<int>(arrIndex, INTE, "integer").copy();
+        break;
+    case REAL:
+        real_array[arrIndex] = this->viewImpl<float>(arrIndex, REAL, "float").copy();
+        break;
+    case DOUB:
+        doub_array[arrIndex] = this->viewImpl<double>(arrIndex, DOUB, "double").copy();
+        break;
+    case LOGI:
+        logi_array[arrIndex] = this->viewImpl<bool>(arrIndex, LOGI, "bool").copy();
+        break;
+    default:
+        return false;
+    }
+
+    arrayLoaded[arrIndex] = true;
+    return true;
+}
+
+
+// Reads the block index which follows the header of a non-empty array in
+// a compressed file, and moves on to the next header.
+void EclFile::readCompressedIndex(std::fstream& fileH, std::size_t arrIndex)
+{
+    std::int64_t rawSize;
+    int blockSize, numBlocks;
+
+    fileH.read(reinterpret_cast<char*>(&rawSize), sizeof rawSize);
+    fileH.read(reinterpret_cast<char*>(&blockSize), sizeof blockSize);
+    fileH.read(reinterpret_cast<char*>(&numBlocks), sizeof numBlocks);
+
+    rawSize = flipEndianLongInt(rawSize);
+    blockSize = flipEndianInt(blockSize);
+    numBlocks = flipEndianInt(numBlocks);
+
+    const auto expected = sizeOnDiskBinary(array_size[arrIndex], array_type[arrIndex], array_element_size[arrIndex]);
+
+    if (!fileH || (static_cast<std::uint64_t>(rawSize) != expected) || (blockSize <= 0) ||
+        (static_cast<std::uint64_t>(numBlocks) != (expected + blockSize - 1) / blockSize))
+    {
+        OPM_THROW(std::runtime_error, "Error reading compressed binary data, inconsistent block index");
+    }
+
+    std::vector<int> blockSizes(numBlocks);
+    fileH.read(reinterpret_cast<char*>(blockSizes.data()), numBlocks * sizeof(int));
+
+    auto& array = compressedArrays[arrIndex];
+    array.rawSize = rawSize;
+    array.blockSize = blockSize;
+    array.blockPos.resize(numBlocks + 1);
+    array.blockPos[0] = static_cast<std::uint64_t>(fileH.tellg());
+
+    for (int block = 0; block < numBlocks; ++block)
+        array.blockPos[block + 1] = array.blockPos[block] + static_cast<std::uint32_t>(flipEndianInt(blockSizes[block]));
+
+    fileH.seekg(static_cast<std::streamoff>(array.blockPos.back()), std::ios_base::beg);
+}
+
+
+// Decompresses the binary records of an array in a compressed file. The
+// blocks are read from fd with pread().
+void EclFile::readCompressedArray(int fd, std::size_t arrIndex, std::vector<char>& buffer) const
+{
+#if HAVE_ZLIB
+    const auto& array = compressedArrays[arrIndex];
+
+    buffer.clear();
+    if (array.blockPos.empty())
+        return;
+
+    const auto start = array.blockPos.front();
+
+    std::vector<char> blocks(array.blockPos.back() - start);
+    readAt(fd, start, blocks.size(), blocks.data());
+
+    buffer.resize(array.rawSize);
+
+    for (std::size_t block = 0; block + 1 < array.blockPos.size(); ++block) {
+        const auto offset = block * array.blockSize;
+        const auto expected = std::min(array.blockSize, array.rawSize - offset);
+
+        uLongf size = expected;
+        const auto status = uncompress(reinterpret_cast<Bytef*>(buffer.data() + offset), &size,
+                                       reinterpret_cast<const Bytef*>(blocks.data() + (array.blockPos[block] - start)),
+                                       array.blockPos[block + 1] - array.blockPos[block]);
+
+        if ((status != Z_OK) || (size != expected))
+            OPM_THROW_NOLOG(std::runtime_error, "Error reading compressed binary data, corrupt block");
+    }
+#else
+    static_cast<void>(fd);
+    static_cast<void>(arrIndex);
+    static_cast<void>(buffer);
+#endif
+}
+
+
+void EclFile::loadBinaryArray(std::istream& fileH, std::size_t arrIndex)
+{
     switch (array_type[arrIndex]) {
     case INTE:
         inte_array[arrIndex] = readBinaryInteArray(fileH, array_size[arrIndex]);
@@ -190,19 +503,10 @@ void EclFile::loadData()
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        for (size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
+        std::vector<int> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), 0);
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -232,21 +536,14 @@ void EclFile::loadData(const std::string& name)
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
+        std::vector<int> arrIndices;
         for (size_t i = 0; i < array_name.size(); i++) {
             if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
+                arrIndices.push_back(i);
             }
         }
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -272,6 +569,156 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
+        this->loadBinaryArrays(arrIndex);
+    }
+}
+
+
+// Numeric arrays are read and converted in parallel, each thread reads
+// its arrays with pread() from a shared descriptor, or directly from the
+// mapping in memory mapped mode. The remaining array types are read
+// sequentially through a file stream.
+void EclFile::loadBinaryArrays(const std::vector<int>& arrIndex)
+{
+    struct Job {
+        int index;
+        char* out;
+    };
+
+    std::vector<int> indices(arrIndex);
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+
+    std::vector<Job> jobs;
+    std::vector<int> sequential;
+    for (int ind : indices) {
+        const auto num = array_size[ind];
+
+        switch (array_type[ind]) {
+        case INTE:
+            inte_array[ind].resize(num);
+            jobs.push_back({ind, reinterpret_cast<char*>(inte_array[ind].data())});
+            break;
+        case REAL:
+            real_array[ind].resize(num);
+            jobs.push_back({ind, reinterpret_cast<char*>(real_array[ind].data())});
+            break;
+        case DOUB:
+            doub_array[ind].resize(num);
+            jobs.push_back({ind, reinterpret_cast<char*>(doub_array[ind].data())});
+            break;
+        default:
+            sequential.push_back(ind);
+        }
+    }
+
+    if (!jobs.empty()) {
+        int fd = -1;
+        if (!this->mapping) {
+            fd = ::open(inputFilename.c_str(), O_RDONLY);
+            if (fd < 0) {
+                std::string message="Could not open file: '" + inputFilename +"'";
+                OPM_THROW(std::runtime_error, message);
+            }
+        }
+
+        std::vector<std::exception_ptr> errors(jobs.size());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+            std::vector<char> buffer;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+            for (std::size_t job = 0; job < jobs.size(); ++job) {
+                const int ind = jobs[job].index;
+
+                try {
+                    const auto sizeOnDisk = sizeOnDiskBinary(array_size[ind], array_type[ind], array_element_size[ind]);
+
+                    const char* data;
+                    if (this->mapping) {
+                        if (ifStreamPos[ind] + sizeOnDisk > this->mapping->size()) {
+                            std::string message = "Array with index " + std::to_string(ind) + " extends beyond end of file " + inputFilename;
+                            OPM_THROW_NOLOG(std::runtime_error, message);
+                        }
+
+                        data = this->mapping->data() + ifStreamPos[ind];
+                    } else if (this->compressed) {
+                        readCompressedArray(fd, ind, buffer);
+                        data = buffer.data();
+                    } else {
+                        buffer.resize(sizeOnDisk);
+                        readAt(fd, ifStreamPos[ind], buffer.size(), buffer.data());
+                        data = buffer.data();
+                    }
+
+                    switch (array_type[ind]) {
+                    case INTE:
+                        decodeBinaryArray(data, sizeOnDisk, array_size[ind], reinterpret_cast<int*>(jobs[job].out));
+                        break;
+                    case REAL:
+                        decodeBinaryArray(data, sizeOnDisk, array_size[ind], reinterpret_cast<float*>(jobs[job].out));
+                        break;
+                    default:
+                        decodeBinaryArray(data, sizeOnDisk, array_size[ind], reinterpret_cast<double*>(jobs[job].out));
+                        break;
+                    }
+                }
+                catch (...) {
+                    errors[job] = std::current_exception();
+                }
+            }
+        }
+
+        if (fd >= 0)
+            ::close(fd);
+
+        // OpmLog is not thread safe, errors raised by the worker threads
+        // are logged here.
+        for (std::size_t job = 0; job < jobs.size(); ++job) {
+            if (errors[job]) {
+                try {
+                    std::rethrow_exception(errors[job]);
+                }
+                catch (const std::exception& e) {
+                    Opm::OpmLog::error(e.what());
+                    throw;
+                }
+            }
+
+            arrayLoaded[jobs[job].index] = true;
+        }
+    }
+
+    if (!sequential.empty() && this->compressed) {
+        const int fd = ::open(inputFilename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::string message="Could not open file: '" + inputFilename +"'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        try {
+            std::vector<char> buffer;
+            for (int ind : sequential) {
+                readCompressedArray(fd, ind, buffer);
+
+                ArrayBuffer records(buffer);
+                std::istream is(&records);
+                loadBinaryArray(is, ind);
+            }
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+
+        ::close(fd);
+    }
+    else if (!sequential.empty()) {
         std::fstream fileH;
         fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
@@ -280,7 +727,11 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
             OPM_THROW(std::runtime_error, message);
         }
 
-        for (int ind : arrIndex) {
+        for (int ind : sequential) {
+            if (this->loadMappedArray(ind))
+                continue;
+
+            fileH.seekg (ifStreamPos[ind], fileH.beg);
             loadBinaryArray(fileH, ind);
         }
 
@@ -307,17 +758,7 @@ void EclFile::loadData(int arrIndex)
 
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            std::string message="Could not open file: '" + inputFilename +"'";
-            OPM_THROW(std::runtime_error, message);
-        }
-
-        loadBinaryArray(fileH, arrIndex);
-
-        fileH.close();
+        this->loadBinaryArrays({arrIndex});
     }
 }
 
@@ -377,6 +818,29 @@ std::vector<unsigned int> EclFile::get_bin_logi_raw_values(int arrIndex) const
     if (array_type[arrIndex] != Opm::EclIO::LOGI)
         OPM_THROW(std::runtime_error, "Error, selected array is not of type LOGI");
 
+    if (compressed) {
+        const int fd = ::open(inputFilename.c_str(), O_RDONLY);
+        if (fd < 0) {
+            std::string message="Could not open file: '" + inputFilename +"'";
+            OPM_THROW(std::runtime_error, message);
+        }
+
+        std::vector<char> buffer;
+        try {
+            readCompressedArray(fd, arrIndex, buffer);
+        }
+        catch (...) {
+            ::close(fd);
+            throw;
+        }
+
+        ::close(fd);
+
+        ArrayBuffer records(buffer);
+        std::istream is(&records);
+        return readBinaryRawLogiArray(is, array_size[arrIndex]);
+    }
+
     std::fstream fileH;
     fileH.open(inputFilename, std::ios::in |  std::ios::binary);
 
@@ -634,6 +1098,84 @@ const std::vector<T>& EclFile::getImpl(int arrIndex, eclArrType type,
 }
 
 
+template<class T>
+EclFile::ArrayView<T> EclFile::viewImpl(int arrIndex, eclArrType type, const std::string& typeStr) const
+{
+    if (!this->mapping) {
+        std::string message = "Array views are only available for binary files opened in memory mapped mode: " + inputFilename;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    if (array_type[arrIndex] != type) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " is not of type " + typeStr;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    const auto num = array_size[arrIndex];
+    const auto start = ifStreamPos[arrIndex];
+    if (start + sizeOnDiskBinary(num, type, array_element_size[arrIndex]) > this->mapping->size()) {
+        std::string message = "Array with index " + std::to_string(arrIndex) + " extends beyond end of file " + inputFilename;
+        OPM_THROW(std::runtime_error, message);
+    }
+
+    const char* data = this->mapping->data() + start;
+    if (num > 0) {
+        std::int32_t head;
+        std::memcpy(&head, data, sizeof head);
+
+        const auto expected = std::min<std::int64_t>(num, MaxNumBlockInte) * static_cast<std::int64_t>(ArrayView<T>::elementSize);
+        if (flipEndianInt(head) != expected)
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+    }
+
+    return { data, static_cast<std::size_t>(num), this->mapping };
+}
+
+
+template<>
+EclFile::ArrayView<int> EclFile::view<int>(int arrIndex) const
+{
+    return viewImpl<int>(arrIndex, INTE, "integer");
+}
+
+template<>
+EclFile::ArrayView<float> EclFile::view<float>(int arrIndex) const
+{
+    return viewImpl<float>(arrIndex, REAL, "float");
+}
+
+template<>
+EclFile::ArrayView<double> EclFile::view<double>(int arrIndex) const
+{
+    return viewImpl<double>(arrIndex, DOUB, "double");
+}
+
+template<>
+EclFile::ArrayView<bool> EclFile::view<bool>(int arrIndex) const
+{
+    return viewImpl<bool>(arrIndex, LOGI, "bool");
+}
+
+
+template <typename T>
+EclFile::ArrayView<T> EclFile::view(const std::string& name) const
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        std::string message="key '"+name + "' not found";
+        OPM_THROW(std::invalid_argument, message);
+    }
+
+    return this->view<T>(search->second);
+}
+
+template EclFile::ArrayView<int> EclFile::view<int>(const std::string&) const;
+template EclFile::ArrayView<float> EclFile::view<float>(const std::string&) const;
+template EclFile::ArrayView<double> EclFile::view<double>(const std::string&) const;
+template EclFile::ArrayView<bool> EclFile::view<bool>(const std::string&) const;
+
+
 std::size_t EclFile::size() const {
     return this->array_name.size();
 }
@@ -16,23 +16,197 @@
    along with OPM.  If not, see <http://www.gnu.org/licenses/>.
    */
 
+#include <config.h>
+
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iterator>
 #include <iomanip>
 #include <iostream>
 #include <ios>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
+#include <type_traits>
 #include <typeinfo>
 
+#include <fmt/format.h>
+
+#if HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+namespace {
+
+    // Staging buffer grows up to this size (4 MiB) before its contents
+    // are written to file.
+    constexpr std::size_t maxStagingBufferSize = std::size_t{1} << 22;
+
+    // Copy 'num' elements of type 'Word' from 'src' to 'dst', reversing
+    // the byte order of each element.  The plain loop over fixed-size
+    // copies is vectorised by the compiler.
+    template <typename Word>
+    void copyByteSwapped(const char* src, const std::size_t num, char* dst)
+    {
+        for (std::size_t i = 0; i < num; ++i) {
+            Word w;
+            std::memcpy(&w, src + i*sizeof(Word), sizeof(Word));
+            w = Opm::EclIO::byteSwap(w);
+            std::memcpy(dst + i*sizeof(Word), &w, sizeof(Word));
+        }
+    }
+
+    // Whether or not an existing binary file is compressed.  Nullopt if
+    // the file does not exist or is empty.
+    std::optional<bool> isCompressedFile(const std::string& filename)
+    {
+        std::ifstream is(filename, std::ios::binary);
+
+        char marker[Opm::EclIO::sizeOfCompressedFileMarker];
+        is.read(marker, sizeof marker);
+
+        if (is.gcount() == 0) {
+            return std::nullopt;
+        }
+
+        return (is.gcount() == sizeof marker)
+            && (std::memcmp(marker, Opm::EclIO::compressedFileMarker, sizeof marker) == 0);
+    }
+
+} // Anonymous namespace
+
+#if HAVE_ZLIB
+
+namespace Opm { namespace EclIO {
+
+// Compresses the binary records of one array at a time.  Data are
+// collected in fixed size blocks, and each full block is compressed
+// right away.  The block index and the compressed blocks are written
+// once the last byte of the array has been received.
+class EclOutput::Compressor
+{
+public:
+    bool active() const
+    {
+        return this->remaining_ > 0;
+    }
+
+    void begin(const std::uint64_t rawSize)
+    {
+        this->rawSize_ = this->remaining_ = rawSize;
+        this->block_.resize(std::min<std::uint64_t>(rawSize, compressedBlockSize));
+        this->filled_ = 0;
+        this->blockSizes_.clear();
+        this->compressed_.clear();
+    }
+
+    void append(const char* data, std::size_t numBytes, std::ofstream& os)
+    {
+        if (numBytes > this->remaining_) {
+            OPM_THROW(std::logic_error, "Binary records exceed size of array in compressed output");
+        }
+
+        while (numBytes > 0) {
+            const auto n = std::min(numBytes, this->block_.size() - this->filled_);
+            std::memcpy(this->block_.data() + this->filled_, data, n);
+
+            this->filled_ += n;
+            this->remaining_ -= n;
+            data += n;
+            numBytes -= n;
+
+            if ((this->filled_ == this->block_.size()) || (this->remaining_ == 0)) {
+                this->compressBlock();
+            }
+        }
+
+        if (this->remaining_ == 0) {
+            this->writeArray(os);
+        }
+    }
+
+private:
+    std::uint64_t rawSize_{0};
+    std::uint64_t remaining_{0};
+
+    std::vector<char> block_{};
+    std::size_t filled_{0};
+
+    std::vector<std::uint32_t> blockSizes_{};
+    std::vector<char> compressed_{};
+
+    void compressBlock()
+    {
+        const auto start = this->compressed_.size();
+        auto size = compressBound(this->filled_);
+        this->compressed_.resize(start + size);
+
+        // The fastest level compresses solution arrays almost as well as
+        // the default level, at a quarter of the time.
+        const auto status = compress2(reinterpret_cast<Bytef*>(this->compressed_.data() + start), &size,
+                                      reinterpret_cast<const Bytef*>(this->block_.data()), this->filled_,
+                                      Z_BEST_SPEED);
+
+        if (status != Z_OK) {
+            OPM_THROW(std::runtime_error, fmt::format("Compression of binary records failed with zlib error {}", status));
+        }
+
+        this->compressed_.resize(start + size);
+        this->blockSizes_.push_back(static_cast<std::uint32_t>(size));
+        this->filled_ = 0;
+    }
+
+    void writeArray(std::ofstream& os)
+    {
+        std::vector<char> index(16 + 4*this->blockSizes_.size());
+
+        const auto rawSize = flipEndianLongInt(static_cast<std::int64_t>(this->rawSize_));
+        const auto blockSize = flipEndianInt(compressedBlockSize);
+        const auto numBlocks = flipEndianInt(static_cast<int>(this->blockSizes_.size()));
+
+        std::memcpy(index.data()     , &rawSize  , 8);
+        std::memcpy(index.data() +  8, &blockSize, 4);
+        std::memcpy(index.data() + 12, &numBlocks, 4);
+
+        for (std::size_t i = 0; i < this->blockSizes_.size(); ++i) {
+            const auto size = flipEndianInt(static_cast<int>(this->blockSizes_[i]));
+            std::memcpy(index.data() + 16 + 4*i, &size, 4);
+        }
+
+        os.write(index.data(), index.size());
+        os.write(this->compressed_.data(), this->compressed_.size());
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#else
+
+namespace Opm { namespace EclIO {
+
+// Never instantiated without zlib support.
+class EclOutput::Compressor
+{
+public:
+    bool active() const { return false; }
+    void begin(std::uint64_t) {}
+    void append(const char*, std::size_t, std::ofstream&) {}
+};
+
+}} // namespace Opm::EclIO
+
+#endif // HAVE_ZLIB
+
 namespace Opm { namespace EclIO {
 
 EclOutput::EclOutput(const std::string&            filename,
@@ -40,10 +214,55 @@ EclOutput::EclOutput(const std::string&            filename,
                      const std::ios_base::openmode mode)
     : isFormatted{formatted}
 {
-    const auto binmode = mode | std::ios_base::binary;
+    this->open(filename, mode);
+}
+
+EclOutput::EclOutput(const std::string&            filename,
+                     const Compressed              compressed,
+                     const std::ios_base::openmode mode)
+    : isFormatted{false}
+{
+    if (compressed.value) {
+#if HAVE_ZLIB
+        this->compressor_ = std::make_unique<Compressor>();
+#else
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Cannot create compressed file {}, "
+                              "zlib support is not available", filename));
+#endif
+    }
+
+    this->open(filename, mode);
+}
+
+EclOutput::~EclOutput() = default;
+
+void EclOutput::open(const std::string& filename, const std::ios_base::openmode mode)
+{
     ix_standard = false;
 
-    this->ofileH.open(filename, this->isFormatted ? mode : binmode);
+    if (this->isFormatted) {
+        this->ofileH.open(filename, mode);
+        return;
+    }
+
+    // Appending to a file of the other binary encoding would produce a
+    // file which is readable in neither.
+    const auto existing = (mode & std::ios_base::app)
+        ? isCompressedFile(filename) : std::nullopt;
+
+    if (existing.has_value() && (*existing != this->compressedOutput())) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Cannot append {} output to {} file {}",
+                              this->compressedOutput() ? "compressed" : "uncompressed",
+                              *existing ? "compressed" : "uncompressed", filename));
+    }
+
+    this->ofileH.open(filename, mode | std::ios_base::binary);
+
+    if (this->compressedOutput() && !existing.has_value() && this->ofileH) {
+        this->ofileH.write(compressedFileMarker, sizeOfCompressedFileMarker);
+    }
 }
 
 
@@ -88,6 +307,8 @@ void EclOutput::write<std::string>(const std::string& name,
             writeBinaryCharArray(data, sizeOfChar);
        }
     }
+
+    writeStaged();
 }
 
 void EclOutput::write(const std::string& name, const std::vector<std::string>& data, int element_size)
@@ -125,6 +346,8 @@ void EclOutput::write(const std::string& name, const std::vector<std::string>& d
             writeBinaryCharArray(data, sizeOfChar);
         }
     }
+
+    writeStaged();
 }
 
 template <>
@@ -140,6 +363,8 @@ void EclOutput::write<PaddedOutputString<8>>
         writeBinaryHeader(name, data.size(), CHAR, sizeOfChar);
         writeBinaryCharArray(data);
     }
+
+    writeStaged();
 }
 
 void EclOutput::message(const std::string& msg)
@@ -153,79 +378,148 @@ void EclOutput::message(const std::string& msg)
 
 void EclOutput::flushStream()
 {
+    this->writeStaged();
     this->ofileH.flush();
 }
 
+char* EclOutput::stage(const std::size_t numBytes)
+{
+    const auto required = this->staged_ + numBytes;
+
+    if (required > this->buffer_.size()) {
+        if (required <= maxStagingBufferSize) {
+            // Grow buffer geometrically.  Small files never allocate the
+            // maximum size.
+            this->buffer_.resize(std::min(std::max(required, 2 * this->buffer_.size()),
+                                          maxStagingBufferSize));
+        }
+        else {
+            this->writeStaged();
+
+            if (numBytes > this->buffer_.size()) {
+                this->buffer_.resize(numBytes);
+            }
+        }
+    }
+
+    char* dst = this->buffer_.data() + this->staged_;
+    this->staged_ += numBytes;
+
+    return dst;
+}
+
+void EclOutput::stage(const char* str, const std::size_t len)
+{
+    std::memcpy(this->stage(len), str, len);
+}
+
+void EclOutput::stageRightAligned(const char* str, const std::size_t len, const std::size_t width)
+{
+    // Same as 'ofileH << std::setw(width) << str'.
+    const auto pad = (len < width) ? width - len : std::size_t{0};
+
+    char* dst = this->stage(pad + len);
+    std::fill_n(dst, pad, ' ');
+    std::memcpy(dst + pad, str, len);
+}
+
+void EclOutput::writeStaged()
+{
+    if ((this->staged_ > 0) && this->compressor_ && this->compressor_->active()) {
+        this->compressor_->append(this->buffer_.data(), this->staged_, this->ofileH);
+        this->staged_ = 0;
+    }
+    else if (this->staged_ > 0) {
+        this->ofileH.write(this->buffer_.data(), this->staged_);
+        this->staged_ = 0;
+
+        // Formatted output has traditionally been flushed at the end of
+        // each line and is therefore complete on disk after each write.
+        // Preserve that, but flush once per array only.
+        if (this->isFormatted) {
+            this->ofileH.flush();
+        }
+    }
+}
+
 void EclOutput::writeBinaryHeader(const std::string&arrName, int64_t size, eclArrType arrType, int element_size)
 {
-    int bhead = flipEndianInt(16);
+    if (this->compressor_ && this->compressor_->active()) {
+        OPM_THROW(std::logic_error, "Incomplete array in compressed output");
+    }
+
+    const auto numElements = size;
+    const int bhead = flipEndianInt(16);
     std::string name = arrName + std::string(8 - arrName.size(),' ');
 
+    auto stageRecord = [this, &bhead, &name](const int value, const char* type)
+    {
+        char* dst = this->stage(24);
+
+        std::memcpy(dst     , &bhead      , 4);
+        std::memcpy(dst +  4, name.c_str(), 8);
+        std::memcpy(dst + 12, &value      , 4);
+        std::memcpy(dst + 16, type        , 4);
+        std::memcpy(dst + 20, &bhead      , 4);
+    };
+
     // write X231 header if size larger that limits for 4 byte integers
     if (size > std::numeric_limits<int>::max()) {
         int64_t val231 = std::pow(2,31);
         int64_t x231 = size / val231;
 
-        int flippedx231 = flipEndianInt(static_cast<int>( (-1)*x231 ));
-
-        ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
-        ofileH.write(name.c_str(), 8);
-        ofileH.write(reinterpret_cast<char*>(&flippedx231), sizeof(flippedx231));
-        ofileH.write("X231", 4);
-        ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
+        stageRecord(flipEndianInt(static_cast<int>( (-1)*x231 )), "X231");
 
         size = size - (x231 * val231);
     }
 
-    int flippedSize = flipEndianInt(size);
-
-    ofileH.write(reinterpret_cast<char*>(&bhead), sizeof(bhead));
-
-    ofileH.write(name.c_str(), 8);
-    ofileH.write(reinterpret_cast<char*>(&flippedSize), sizeof(flippedSize));
-
-    std::string c0nn_str;
-
-    if (arrType == C0NN){
-        std::ostringstream ss;
-        ss << "C" << std::setw(3) << std::setfill('0') << element_size;
-        c0nn_str = ss.str();
-    }
+    const int flippedSize = flipEndianInt(size);
 
     switch(arrType) {
     case INTE:
-        ofileH.write("INTE", 4);
+        stageRecord(flippedSize, "INTE");
         break;
     case REAL:
-        ofileH.write("REAL", 4);
+        stageRecord(flippedSize, "REAL");
         break;
     case DOUB:
-        ofileH.write("DOUB", 4);
+        stageRecord(flippedSize, "DOUB");
         break;
     case LOGI:
-        ofileH.write("LOGI", 4);
+        stageRecord(flippedSize, "LOGI");
         break;
     case CHAR:
-        ofileH.write("CHAR", 4);
+        stageRecord(flippedSize, "CHAR");
         break;
-    case C0NN:
-        ofileH.write(c0nn_str.c_str(), 4);
+    case C0NN: {
+        std::ostringstream ss;
+        ss << "C" << std::setw(3) << std::setfill('0') << element_size;
+        stageRecord(flippedSize, ss.str().c_str());
         break;
+    }
     case MESS:
-        ofileH.write("MESS", 4);
+        stageRecord(flippedSize, "MESS");
         break;
     }
 
-    ofileH.write(reinterpret_cast<char *>(&bhead), sizeof(bhead));
+    this->lastHeader_.name = arrName;
+    this->lastHeader_.type = arrType;
+    this->lastHeader_.size = numElements;
+    this->lastHeader_.elementSize = element_size;
+    this->lastHeader_.headerSize = (numElements > std::numeric_limits<int>::max()) ? 48 : 24;
+
+    // Headers are not compressed.  The compressor takes over once they
+    // are written and finishes the array when it has received all data.
+    if (this->compressor_ && (numElements > 0) && (arrType != MESS)) {
+        this->writeStaged();
+        this->compressor_->begin(sizeOnDiskBinary(numElements, arrType, element_size));
+    }
 }
 
 template <typename T>
 void EclOutput::writeBinaryArray(const std::vector<T>& data)
 {
-    int num;
-    int64_t rest, offset;
-    int dhead;
-    int64_t size = data.size();
+    const auto size = data.size();
 
     eclArrType arrType = MESS;
 
@@ -241,84 +535,49 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
     auto sizeData = block_size_data_binary(arrType);
 
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
+    const std::size_t sizeOfElement = std::get<0>(sizeData);
+    const std::size_t maxBlockSize = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
 
     if (!ofileH.is_open()) {
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
-    int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
-
-    rest = size * static_cast<int64_t>(sizeOfElement);
-
-    offset = 0;
-
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = static_cast<int>(rest) / sizeOfElement;
-            rest = 0;
-        }
-
-        dhead = flipEndianInt(num * sizeOfElement);
-
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
-
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
+    const int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
+    const int logi_false_val = false_value;
 
-        } else if (arrType == DOUB) {
+    // Each record, including its leading and trailing size markers, is
+    // assembled in the staging buffer.
+    for (std::size_t offset = 0; offset < size; ) {
+        const auto num = std::min(maxNumberOfElements, size - offset);
+        const auto numBytes = num * sizeOfElement;
+        const int dhead = flipEndianInt(static_cast<int>(numBytes));
 
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
+        char* dst = this->stage(numBytes + 2*sizeof(dhead));
 
-            for (int m = 0; m < num; m++)
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-
-            ofileH.write((char*)(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
-
-            std::vector<int> logi_data;
-            logi_data.resize(num, 0);
-
-            for (int m = 0; m < num; m++)
-                if (data[m + offset])
-                    logi_data[m] = logi_true_val;
-                else
-                    logi_data[m] = false_value;
-
-            ofileH.write((char*)(logi_data.data()), logi_data.size() * sizeof(int)) ;
+        std::memcpy(dst, &dhead, sizeof(dhead));
+        dst += sizeof(dhead);
 
+        if constexpr (std::is_same_v<T, bool>) {
+            for (std::size_t m = 0; m < num; ++m) {
+                std::memcpy(dst + m*sizeof(int),
+                            data[m + offset] ? &logi_true_val : &logi_false_val,
+                            sizeof(int));
+            }
+        } else if constexpr (std::is_same_v<T, int> || std::is_same_v<T, float>) {
+            static_assert(sizeof(T) == sizeof(std::uint32_t));
+            copyByteSwapped<std::uint32_t>(reinterpret_cast<const char*>(data.data() + offset), num, dst);
+        } else if constexpr (std::is_same_v<T, double>) {
+            static_assert(sizeof(T) == sizeof(std::uint64_t));
+            copyByteSwapped<std::uint64_t>(reinterpret_cast<const char*>(data.data() + offset), num, dst);
         } else {
-
             std::cerr << "type not supported in write binaryarray\n";
             std::exit(EXIT_FAILURE);
         }
 
+        std::memcpy(dst + numBytes, &dhead, sizeof(dhead));
+
         offset += num;
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
     }
 }
 
@@ -332,11 +591,6 @@ template void EclOutput::writeBinaryArray<char>(const std::vector<char>& data);
 
 void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int element_size)
 {
-    int num,dhead;
-
-    int n = 0;
-    int size = data.size();
-
     auto sizeData = block_size_data_binary(CHAR);
 
     if (element_size > sizeOfChar){
@@ -344,72 +598,68 @@ void EclOutput::writeBinaryCharArray(const std::vector<std::string>& data, int e
         std::get<0>(sizeData) = element_size;
     }
 
-    int sizeOfElement = std::get<0>(sizeData);
-    int maxBlockSize = std::get<1>(sizeData);
-    int maxNumberOfElements = maxBlockSize / sizeOfElement;
-
-    int rest = size * sizeOfElement;
+    const std::size_t sizeOfElement = std::get<0>(sizeData);
+    const std::size_t maxBlockSize = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
 
     if (!ofileH.is_open()) {
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
-    while (rest > 0) {
-        if (rest > maxBlockSize) {
-            rest -= maxBlockSize;
-            num = maxNumberOfElements;
-        } else {
-            num = rest / sizeOfElement;
-            rest = 0;
-        }
+    const auto size = data.size();
+    for (std::size_t offset = 0; offset < size; ) {
+        const auto num = std::min(maxNumberOfElements, size - offset);
+        const auto numBytes = num * sizeOfElement;
+        const int dhead = flipEndianInt(static_cast<int>(numBytes));
 
-        dhead = flipEndianInt(num * sizeOfElement);
+        char* dst = this->stage(numBytes + 2*sizeof(dhead));
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        std::memcpy(dst, &dhead, sizeof(dhead));
+        dst += sizeof(dhead);
 
-        for (int i = 0; i < num; i++) {
-            std::string tmpStr = data[n] + std::string(sizeOfElement - data[n].size(),' ');
-            ofileH.write(tmpStr.c_str(), sizeOfElement);
-            n++;
+        // Blank padded strings
+        std::fill_n(dst, numBytes, ' ');
+        for (std::size_t i = 0; i < num; ++i) {
+            const auto& str = data[offset + i];
+            std::memcpy(dst + i*sizeOfElement, str.data(), std::min(str.size(), sizeOfElement));
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        std::memcpy(dst + numBytes, &dhead, sizeof(dhead));
+
+        offset += num;
     }
 }
 
 void EclOutput::writeBinaryCharArray(const std::vector<PaddedOutputString<8>>& data)
 {
-    const auto size = data.size();
-
     const auto sizeData = block_size_data_binary(CHAR);
 
-    const int sizeOfElement       = std::get<0>(sizeData);
-    const int maxBlockSize        = std::get<1>(sizeData);
-    const int maxNumberOfElements = maxBlockSize / sizeOfElement;
-
-    int rest = size * sizeOfElement;
+    const std::size_t sizeOfElement       = std::get<0>(sizeData);
+    const std::size_t maxBlockSize        = std::get<1>(sizeData);
+    const std::size_t maxNumberOfElements = maxBlockSize / sizeOfElement;
 
     if (!ofileH.is_open()) {
         OPM_THROW(std::runtime_error,"fstream fileH not open for writing");
     }
 
-    auto elm = data.begin();
-    while (rest > 0) {
-        const auto numElm = (rest > maxBlockSize)
-            ? maxNumberOfElements
-            : rest / sizeOfElement;
-
-        rest = (rest > maxBlockSize) ? rest - maxBlockSize : 0;
+    const auto size = data.size();
+    for (std::size_t offset = 0; offset < size; ) {
+        const auto numElm = std::min(maxNumberOfElements, size - offset);
+        const auto numBytes = numElm * sizeOfElement;
+        const int dhead = flipEndianInt(static_cast<int>(numBytes));
 
-        auto dhead = flipEndianInt(numElm * sizeOfElement);
+        char* dst = this->stage(numBytes + 2*sizeof(dhead));
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        std::memcpy(dst, &dhead, sizeof(dhead));
+        dst += sizeof(dhead);
 
-        for (auto i = 0*numElm; i < numElm; ++i, ++elm) {
-            ofileH.write(elm->c_str(), sizeOfElement);
+        for (std::size_t i = 0; i < numElm; ++i) {
+            std::memcpy(dst + i*sizeOfElement, data[offset + i].c_str(), sizeOfElement);
         }
 
-        ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        std::memcpy(dst + numBytes, &dhead, sizeof(dhead));
+
+        offset += numElm;
     }
 }
 
@@ -417,40 +667,35 @@ void EclOutput::writeFormattedHeader(const std::string& arrName, int size, eclAr
 {
     std::string name = arrName + std::string(8 - arrName.size(),' ');
 
-    ofileH << " '" << name << "' " << std::setw(11) << size;
-
-    std::string c0nn_str;
-
-    if (arrType == C0NN){
-        std::ostringstream ss;
-        ss << "C" << std::setw(3) << std::setfill('0') << element_size;
-        c0nn_str = ss.str();
-    }
-
+    std::ostringstream header;
+    header << " '" << name << "' " << std::setw(11) << size;
 
     switch (arrType) {
     case INTE:
-        ofileH << " 'INTE'" <<  std::endl;
+        header << " 'INTE'\n";
         break;
     case REAL:
-        ofileH << " 'REAL'" <<  std::endl;
+        header << " 'REAL'\n";
         break;
     case DOUB:
-        ofileH << " 'DOUB'" <<  std::endl;
+        header << " 'DOUB'\n";
         break;
     case LOGI:
-        ofileH << " 'LOGI'" <<  std::endl;
+        header << " 'LOGI'\n";
         break;
     case CHAR:
-        ofileH << " 'CHAR'" <<  std::endl;
+        header << " 'CHAR'\n";
         break;
     case C0NN:
-        ofileH << " '" << c0nn_str << "'" <<  std::endl;
+        header << " 'C" << std::setw(3) << std::setfill('0') << element_size << "'\n";
         break;
     case MESS:
-        ofileH << " 'MESS'" <<  std::endl;
+        header << " 'MESS'\n";
         break;
     }
+
+    const auto str = header.str();
+    this->stage(str.data(), str.size());
 }
 
 
@@ -605,40 +850,33 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
 
     int maxBlockSize = std::get<0>(sizeData);
     int nColumns = std::get<1>(sizeData);
-    int columnWidth = std::get<2>(sizeData);
+    const std::size_t columnWidth = std::get<2>(sizeData);
+
+    auto stageString = [this, columnWidth](const std::string& str)
+    {
+        this->stageRightAligned(str.data(), str.size(), columnWidth);
+    };
 
     for (int i = 0; i < size; i++) {
         n++;
 
-        switch (arrType) {
-        case INTE:
-            ofileH << std::setw(columnWidth) << data[i];
-            break;
-        case REAL:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_real_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_real_string_ecl(data[i]);
-            break;
-        case DOUB:
-            if (ix_standard)
-                ofileH << std::setw(columnWidth) << make_doub_string_ix(data[i]);
-            else
-                ofileH << std::setw(columnWidth) << make_doub_string_ecl(data[i]);
-            break;
-        case LOGI:
-            if (data[i]) {
-                ofileH << "  T";
-            } else {
-                ofileH << "  F";
-            }
-            break;
-        default:
-            break;
+        if constexpr (std::is_same_v<T, int>) {
+            char buffer[16];
+            const auto result = std::to_chars(std::begin(buffer), std::end(buffer), data[i]);
+            this->stageRightAligned(buffer, result.ptr - buffer, columnWidth);
+        }
+        else if constexpr (std::is_same_v<T, float>) {
+            stageString(ix_standard ? make_real_string_ix(data[i]) : make_real_string_ecl(data[i]));
+        }
+        else if constexpr (std::is_same_v<T, double>) {
+            stageString(ix_standard ? make_doub_string_ix(data[i]) : make_doub_string_ecl(data[i]));
+        }
+        else if constexpr (std::is_same_v<T, bool>) {
+            this->stage(data[i] ? "  T" : "  F", 3);
         }
 
         if ((n % nColumns) == 0 || (n % maxBlockSize) == 0) {
-            ofileH << std::endl;
+            this->stage("\n", 1);
         }
 
         if ((n % maxBlockSize) == 0) {
@@ -647,7 +885,7 @@ void EclOutput::writeFormattedArray(const std::vector<T>& data)
     }
 
     if ((n % nColumns) != 0 && (n % maxBlockSize) != 0) {
-        ofileH << std::endl;
+        this->stage("\n", 1);
     }
 }
 
@@ -673,6 +911,8 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, in
     } else
         nColumns = 80 / (element_size + 3);
 
+    const std::size_t elementSize = element_size;
+
     int rest = data.size();
     int n = 0;
 
@@ -683,19 +923,24 @@ void EclOutput::writeFormattedCharArray(const std::vector<std::string>& data, in
             size = maxBlockSize;
 
         for (int i = 0; i < size; i++) {
-            std::string str1(element_size,' ');
-            str1 = data[n] + std::string(element_size - data[n].size(),' ');
-
+            const auto& str = data[n];
             n++;
-            ofileH << " '" << str1 << "'";
+
+            // " 'str'" with str blank padded to element size
+            char* dst = this->stage(elementSize + 3);
+            dst[0] = ' ';
+            dst[1] = '\'';
+            std::fill_n(dst + 2, elementSize, ' ');
+            std::memcpy(dst + 2, str.data(), std::min(str.size(), elementSize));
+            dst[elementSize + 2] = '\'';
 
             if ((i+1) % nColumns == 0) {
-                ofileH  << std::endl;
+                this->stage("\n", 1);
             }
         }
 
         if ((size % nColumns) != 0) {
-            ofileH  << std::endl;
+            this->stage("\n", 1);
         }
 
         rest = (rest > maxBlockSize) ? rest - maxBlockSize : 0;
@@ -712,15 +957,19 @@ void EclOutput::writeFormattedCharArray(const std::vector<PaddedOutputString<8>>
     const auto size = data.size();
 
     for (auto i = 0*size; i < size; ++i) {
-        ofileH << " '" << data[i].c_str() << '\'';
+        char* dst = this->stage(11);
+        dst[0] = ' ';
+        dst[1] = '\'';
+        std::memcpy(dst + 2, data[i].c_str(), 8);
+        dst[10] = '\'';
 
         if ((i+1) % nColumns == 0) {
-            ofileH << '\n';
+            this->stage("\n", 1);
         }
     }
 
     if ((size % nColumns) != 0) {
-        ofileH << '\n';
+        this->stage("\n", 1);
     }
 }
 
@@ -601,9 +601,8 @@ std::vector<std::string> ExtESmry::keywordList(const std::string& pattern) const
 {
     std::vector<std::string> list;
 
-    for (const auto& key : m_keyword)
-        if (shmatch( pattern, key) )
-            list.push_back(key);
+    for (auto index : shmatch(pattern, m_keyword))
+        list.push_back(m_keyword[index]);
 
     return list;
 }
@@ -216,7 +216,7 @@ std::vector<std::string> ExtSmryOutput::make_modified_keys(const std::vector<std
 
 }
 
-std::array<int, 3> ExtSmryOutput::ijk_from_global_index(const GridDims& dims, int globInd) const
+std::array<int, 3> ExtSmryOutput::ijk_from_global_index(const GridDims& dims, int globInd)
 {
 
     if (globInd < 0 || static_cast<size_t>(globInd) >= dims[0] * dims[1] * dims[2])
@@ -23,9 +23,11 @@
 
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
+#include <opm/io/eclipse/RestartIndex.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstdint>
 #include <ctime>
 #include <exception>
 #include <filesystem>
@@ -36,6 +38,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 #include <utility>
 #include <vector>
 
@@ -99,18 +102,37 @@ namespace {
 
     namespace Open
     {
-        namespace Init
+        // Compression applies to binary output only.
+        std::unique_ptr<Opm::EclIO::EclOutput>
+        stream(const std::string&            filename,
+               const bool                    isFmt,
+               const bool                    compressed,
+               const std::ios_base::openmode mode)
         {
-            std::unique_ptr<Opm::EclIO::EclOutput>
-            write(const std::string& filename,
-                  const bool         isFmt)
-            {
+            if (compressed && !isFmt) {
                 return std::unique_ptr<Opm::EclIO::EclOutput> {
                     new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::out
+                        filename, Opm::EclIO::EclOutput::Compressed{ true }, mode
                     }
                 };
             }
+
+            return std::unique_ptr<Opm::EclIO::EclOutput> {
+                new Opm::EclIO::EclOutput {
+                    filename, isFmt, mode
+                }
+            };
+        }
+
+        namespace Init
+        {
+            std::unique_ptr<Opm::EclIO::EclOutput>
+            write(const std::string& filename,
+                  const bool         isFmt,
+                  const bool         compressed)
+            {
+                return stream(filename, isFmt, compressed, std::ios_base::out);
+            }
         }
 
         namespace Restart
@@ -144,24 +166,18 @@ namespace {
 
             std::unique_ptr<Opm::EclIO::EclOutput>
             writeNew(const std::string& filename,
-                     const bool         isFmt)
+                     const bool         isFmt,
+                     const bool         compressed)
             {
-                return std::unique_ptr<Opm::EclIO::EclOutput> {
-                    new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::out
-                    }
-                };
+                return stream(filename, isFmt, compressed, std::ios_base::out);
             }
 
             std::unique_ptr<Opm::EclIO::EclOutput>
             writeExisting(const std::string& filename,
-                          const bool         isFmt)
+                          const bool         isFmt,
+                          const bool         compressed)
             {
-                return std::unique_ptr<Opm::EclIO::EclOutput> {
-                    new Opm::EclIO::EclOutput {
-                        filename, isFmt, std::ios_base::app
-                    }
-                };
+                return stream(filename, isFmt, compressed, std::ios_base::app);
             }
         } // namespace Restart
 
@@ -209,12 +225,13 @@ namespace {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Init::
-Init(const ResultSet& rset,
-     const Formatted& fmt)
+Init(const ResultSet&  rset,
+     const Formatted&  fmt,
+     const Compressed& compr)
 {
     const auto fname = outputFileName(rset, FileExtension::init(fmt.set));
 
-    this->open(fname, fmt.set);
+    this->open(fname, fmt.set, compr.set);
 }
 
 Opm::EclIO::OutputStream::Init::~Init()
@@ -263,9 +280,10 @@ write(const std::string& kw, const std::vector<double>& data)
 void
 Opm::EclIO::OutputStream::Init::
 open(const std::string& fname,
-     const bool         formatted)
+     const bool         formatted,
+     const bool         compressed)
 {
-    this->stream_ = Open::Init::write(fname, formatted);
+    this->stream_ = Open::Init::write(fname, formatted, compressed);
 }
 
 Opm::EclIO::EclOutput&
@@ -288,10 +306,11 @@ namespace Opm { namespace EclIO { namespace OutputStream {
 // =====================================================================
 
 Opm::EclIO::OutputStream::Restart::
-Restart(const ResultSet& rset,
-        const int        seqnum,
-        const Formatted& fmt,
-        const Unified&   unif)
+Restart(const ResultSet&  rset,
+        const int         seqnum,
+        const Formatted&  fmt,
+        const Unified&    unif,
+        const Compressed& compr)
 {
     const auto ext = FileExtension::
         restart(seqnum, fmt.set, unif.set);
@@ -300,7 +319,7 @@ Restart(const ResultSet& rset,
 
     if (unif.set) {
         // Run uses unified restart files.
-        this->openUnified(fname, fmt.set, seqnum);
+        this->openUnified(fname, fmt.set, compr.set, seqnum);
 
         // Write SEQNUM value to stream to start new output sequence.
         this->stream_->write("SEQNUM", std::vector<int>{ seqnum });
@@ -308,28 +327,64 @@ Restart(const ResultSet& rset,
     else {
         // Run uses separate, not unified, restart files.  Create a
         // new output file and open an output stream on it.
-        this->openNew(fname, fmt.set);
+        this->openNew(fname, fmt.set, compr.set);
     }
 }
 
-Opm::EclIO::OutputStream::Restart::~Restart()
+Opm::EclIO::OutputStream::Restart::
+Restart(std::shared_ptr<EclOutput>    stream,
+        std::shared_ptr<RestartIndex> index)
+    : stream_{ std::move(stream) }
+    , index_ { std::move(index) }
 {}
 
+Opm::EclIO::OutputStream::Restart::~Restart()
+{
+    // Make report step's contents visible to readers even if the stream
+    // is kept open by a UnifiedRestart object.  Errors are reported by
+    // finish(), and must not escape from here.
+    if (this->stream_ != nullptr) {
+        try {
+            this->stream_->flushStream();
+        }
+        catch (...) {}
+    }
+}
+
+void Opm::EclIO::OutputStream::Restart::finish()
+{
+    if (this->stream_ == nullptr) {
+        return;
+    }
+
+    const auto stream = std::move(this->stream_);
+    const auto index  = std::move(this->index_);
+
+    stream->flushStream();
+
+    // Index the report step only once it is complete on disk.
+    if (index != nullptr) {
+        index->endStep(static_cast<std::uint64_t>(stream->ofileH.tellp()));
+    }
+}
+
 Opm::EclIO::OutputStream::Restart::Restart(Restart&& rhs)
     : stream_{ std::move(rhs.stream_) }
+    , index_ { std::move(rhs.index_) }
 {}
 
 Opm::EclIO::OutputStream::Restart&
 Opm::EclIO::OutputStream::Restart::operator=(Restart&& rhs)
 {
     this->stream_ = std::move(rhs.stream_);
+    this->index_  = std::move(rhs.index_);
 
     return *this;
 }
 
 void Opm::EclIO::OutputStream::Restart::message(const std::string& msg)
 {
-    this->stream().message(msg);
+    this->writeIndexed([&msg](EclOutput& stream) { stream.message(msg); });
 }
 
 void
@@ -379,8 +434,14 @@ void
 Opm::EclIO::OutputStream::Restart::
 openUnified(const std::string& fname,
             const bool         formatted,
+            const bool         compressed,
             const int          seqnum)
 {
+    // This object does not maintain the restart index.  Discard any
+    // index since it no longer matches the file.
+    std::error_code ec;
+    std::filesystem::remove(RestartIndex::fileName(fname), ec);
+
     // Determine if we're creating a new output/restart file or
     // if we're opening an existing one, possibly at a specific
     // write position.
@@ -388,7 +449,7 @@ openUnified(const std::string& fname,
 
     if (rst == nullptr) {
         // No such unified restart file exists.  Create new file.
-        this->openNew(fname, formatted);
+        this->openNew(fname, formatted, compressed);
     }
     else if (! rst->hasKey("SEQNUM")) {
         // File with correct filename exists but does not appear
@@ -403,7 +464,7 @@ openUnified(const std::string& fname,
         // Restart file exists and appears to be a unified restart
         // resource.  Open writable restart stream backed by the
         // specific file.
-        this->openExisting(fname, formatted,
+        this->openExisting(fname, formatted, compressed,
                            rst->restartStepWritePosition(seqnum));
     }
 }
@@ -411,18 +472,20 @@ openUnified(const std::string& fname,
 void
 Opm::EclIO::OutputStream::Restart::
 openNew(const std::string& fname,
-        const bool         formatted)
+        const bool         formatted,
+        const bool         compressed)
 {
-    this->stream_ = Open::Restart::writeNew(fname, formatted);
+    this->stream_ = Open::Restart::writeNew(fname, formatted, compressed);
 }
 
 void
 Opm::EclIO::OutputStream::Restart::
 openExisting(const std::string&   fname,
              const bool           formatted,
+             const bool           compressed,
              const std::streampos writePos)
 {
-    this->stream_ = Open::Restart::writeExisting(fname, formatted);
+    this->stream_ = Open::Restart::writeExisting(fname, formatted, compressed);
 
     if (writePos == std::streampos(-1)) {
         // No specified initial write position.  Typically the case if
@@ -466,13 +529,200 @@ namespace Opm { namespace EclIO { namespace OutputStream {
     void Restart::writeImpl(const std::string&    kw,
                             const std::vector<T>& data)
     {
-        this->stream().write(kw, data);
+        this->writeIndexed([&kw, &data](EclOutput& stream) { stream.write(kw, data); });
+    }
+
+    template <typename WriteArray>
+    void Restart::writeIndexed(WriteArray&& writeArray)
+    {
+        if (this->index_ == nullptr) {
+            writeArray(this->stream());
+            return;
+        }
+
+        // All previous output has been passed on to the file stream, so
+        // this is the position of the array's header.
+        const auto pos = static_cast<std::uint64_t>(this->stream().ofileH.tellp());
+
+        writeArray(this->stream());
+
+        const auto& header = this->stream().lastHeader_;
+        this->index_->addArray({ header.name, header.type, header.size,
+                                 header.elementSize, pos + header.headerSize });
     }
 
 }}}
 
 // =====================================================================
 
+Opm::EclIO::OutputStream::UnifiedRestart::
+UnifiedRestart(const ResultSet&  rset,
+               const Formatted&  fmt,
+               const Compressed& compr,
+               const Indexed&    indexed)
+    : fname_     { outputFileName(rset, FileExtension::restart(0, fmt.set, true)) }
+    , formatted_ { fmt.set }
+    , compressed_{ compr.set }
+    , indexed_   { indexed.set }
+{}
+
+Opm::EclIO::OutputStream::UnifiedRestart::~UnifiedRestart()
+{}
+
+Opm::EclIO::OutputStream::UnifiedRestart::UnifiedRestart(UnifiedRestart&& rhs)
+    : fname_     { std::move(rhs.fname_) }
+    , formatted_ { rhs.formatted_ }
+    , compressed_{ rhs.compressed_ }
+    , indexed_   { rhs.indexed_ }
+    , stream_    { std::move(rhs.stream_) }
+    , seqnumPos_ { std::move(rhs.seqnumPos_) }
+    , index_     { std::move(rhs.index_) }
+{}
+
+Opm::EclIO::OutputStream::UnifiedRestart&
+Opm::EclIO::OutputStream::UnifiedRestart::operator=(UnifiedRestart&& rhs)
+{
+    this->fname_      = std::move(rhs.fname_);
+    this->formatted_  = rhs.formatted_;
+    this->compressed_ = rhs.compressed_;
+    this->indexed_    = rhs.indexed_;
+    this->stream_     = std::move(rhs.stream_);
+    this->seqnumPos_  = std::move(rhs.seqnumPos_);
+    this->index_      = std::move(rhs.index_);
+
+    return *this;
+}
+
+Opm::EclIO::OutputStream::Restart
+Opm::EclIO::OutputStream::UnifiedRestart::prepareStep(const int seqnum)
+{
+    if (this->stream_ == nullptr) {
+        this->open();
+    }
+
+    // Rewriting an existing report step discards that step and all
+    // subsequent steps, as in Restart::openUnified().
+    if (auto pos = this->seqnumPos_.lower_bound(seqnum);
+        pos != this->seqnumPos_.end())
+    {
+        this->truncate(pos->second);
+        this->seqnumPos_.erase(pos, this->seqnumPos_.end());
+
+        if (this->index_ != nullptr) {
+            this->index_->truncate(seqnum);
+        }
+    }
+
+    this->seqnumPos_.emplace(seqnum, this->stream_->ofileH.tellp());
+
+    if (this->index_ != nullptr) {
+        this->index_->beginStep(seqnum);
+    }
+
+    // Write SEQNUM value to stream to start new output sequence.
+    auto step = Restart { this->stream_, this->index_ };
+    step.write("SEQNUM", std::vector<int>{ seqnum });
+
+    return step;
+}
+
+void Opm::EclIO::OutputStream::UnifiedRestart::open()
+{
+    auto rst = Open::Restart::read(this->fname_);
+
+    if (rst == nullptr) {
+        // No such unified restart file exists.  Create new file.
+        this->stream_ = Open::Restart::writeNew(this->fname_, this->formatted_, this->compressed_);
+    }
+    else if (! rst->hasKey("SEQNUM")) {
+        // File with correct filename exists but does not appear
+        // to be an actual unified restart file.
+        throw std::invalid_argument {
+            "Purported existing unified restart file '"
+            + std::filesystem::path{this->fname_}.filename().string()
+            + "' does not appear to be a unified restart file"
+        };
+    }
+    else {
+        // Resuming output to an existing unified restart file.  This is
+        // the only case in which we need to scan the file contents.
+        for (const auto& seqnum : rst->listOfReportStepNumbers()) {
+            this->seqnumPos_.emplace(seqnum, rst->restartStepWritePosition(seqnum));
+        }
+
+        this->stream_ = Open::Restart::writeExisting(this->fname_, this->formatted_, this->compressed_);
+        this->stream_->ofileH.seekp(0, std::ios_base::end);
+    }
+
+    if (! this->stream_->ofileH) {
+        throw std::runtime_error {
+            "Unable to open unified restart file '" + this->fname_ + "' for writing"
+        };
+    }
+
+    this->createIndex(rst.get());
+}
+
+void
+Opm::EclIO::OutputStream::UnifiedRestart::
+createIndex(const ERst* rst)
+{
+    if (! this->indexed_ || this->formatted_ || this->compressed_) {
+        // Not indexed.  Discard index from any previous run since it no
+        // longer matches the file.
+        std::error_code ec;
+        std::filesystem::remove(RestartIndex::fileName(this->fname_), ec);
+        return;
+    }
+
+    // Always rewrite the index of an existing file.  It might be missing
+    // or out of date.
+    std::vector<RestartIndex::Step> steps;
+
+    if (rst != nullptr) {
+        for (const auto& seqnum : rst->listOfReportStepNumbers()) {
+            const auto [first, last] = rst->getIndexRange(seqnum);
+
+            auto& step = steps.emplace_back();
+            step.seqnum = seqnum;
+            step.endPos = static_cast<std::uint64_t>(rst->seekPosition(last));
+
+            for (int i = first; i < last; ++i) {
+                step.arrays.push_back({ rst->array_name[i], rst->array_type[i],
+                                        rst->array_size[i], rst->array_element_size[i],
+                                        rst->ifStreamPos[i] });
+            }
+        }
+    }
+
+    this->index_ = std::make_shared<RestartIndex>(this->fname_);
+    this->index_->create(steps);
+}
+
+void
+Opm::EclIO::OutputStream::UnifiedRestart::
+truncate(const std::streampos writePos)
+{
+    // Resize file (as if by POSIX function ::truncate()) to requested
+    // size.  Pending output must reach the file first lest it be written
+    // beyond the new end of file.  The stream is opened in append mode
+    // when resuming, and in that case subsequent writes go to the new end
+    // of file irrespective of seekp().
+    this->stream_->flushStream();
+
+    std::filesystem::resize_file(this->fname_, writePos);
+
+    if (! this->stream_->ofileH.seekp(writePos)) {
+        throw std::invalid_argument {
+            "Unable to Seek to Write Position " +
+            std::to_string(writePos) + " of File '"
+            + this->fname_ + "'"
+        };
+    }
+}
+
+// =====================================================================
+
 Opm::EclIO::OutputStream::RFT::
 RFT(const ResultSet&    rset,
     const Formatted&    fmt,
@@ -101,6 +101,13 @@ public:
         return this->rst_file_->occurrence_count(vector, this->report_step_);
     }
 
+    void loadKeywords(const std::vector<std::string>& vectors)
+    {
+        if (this->rst_file_ == nullptr) { return; }
+
+        this->rst_file_->loadReportStepNumber(this->report_step_, vectors);
+    }
+
     template <typename ElmType>
     bool hasKeyword(const std::string& vector) const
     {
@@ -190,8 +197,8 @@ Implementation(std::shared_ptr<ERst> restart_file,
         return;
     }
 
-    this->rst_file_->loadReportStepNumber(this->report_step_);
-
+    // Vectors are read on demand.  A restarted run typically needs only a
+    // few of the report step's vectors.
     for (const auto& vector : this->rst_file_->listOfRstArrays(this->report_step_)) {
         const auto& type = std::get<1>(vector);
 
@@ -260,6 +267,11 @@ int Opm::EclIO::RestartFileView::occurrenceCount(const std::string& vector) cons
     return this->pImpl_->occurrenceCount(vector);
 }
 
+void Opm::EclIO::RestartFileView::loadKeywords(const std::vector<std::string>& vectors) const
+{
+    this->pImpl_->loadKeywords(vectors);
+}
+
 const std::vector<int>& Opm::EclIO::RestartFileView::intehead() const
 {
     return this->pImpl_->intehead();
@@ -0,0 +1,282 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/RestartIndex.hpp>
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace {
+    const std::array<std::string, 7> stepArrays {
+        "SEQNUM", "NAME", "TYPE", "ELMSIZE", "SIZE", "DATAPOS", "ENDPOS"
+    };
+
+    // Size of an array header in an unformatted file.
+    const std::uint64_t headerSize = 24;
+
+    bool validType(const int type)
+    {
+        return (type >= Opm::EclIO::INTE) && (type <= Opm::EclIO::C0NN);
+    }
+
+    // Arrays must be in order, contained in their report step, and each
+    // report step must start with a SEQNUM array right after the previous
+    // report step.
+    bool consistent(const std::vector<Opm::EclIO::RestartIndex::Step>& steps,
+                    const std::uint64_t                                 fileSize)
+    {
+        std::uint64_t prevEnd = 0;
+
+        for (auto step = steps.begin(); step != steps.end(); ++step) {
+            if (step->arrays.empty() ||
+                (step->arrays.front().name != "SEQNUM") ||
+                (step->arrays.front().dataPos != prevEnd + headerSize) ||
+                ((step != steps.begin()) && (step->seqnum <= std::prev(step)->seqnum)))
+            {
+                return false;
+            }
+
+            for (const auto& array : step->arrays) {
+                if ((array.dataPos <= prevEnd) || (array.dataPos > step->endPos)) {
+                    return false;
+                }
+
+                prevEnd = array.dataPos;
+            }
+
+            prevEnd = step->endPos;
+        }
+
+        return !steps.empty() && (prevEnd == fileSize);
+    }
+
+    // The restart file may have been rewritten with the same size by a
+    // process which does not maintain the index.  Check the last SEQNUM
+    // array on disk.
+    bool lastStepMatches(const std::string&                    restartFile,
+                         const Opm::EclIO::RestartIndex::Step& step)
+    {
+        std::ifstream rst(restartFile, std::ios::binary);
+
+        std::array<char, headerSize + 2*sizeof(int)> record;
+        rst.seekg(static_cast<std::streamoff>(step.arrays.front().dataPos - headerSize));
+        rst.read(record.data(), record.size());
+
+        if (!rst || (std::memcmp(record.data() + 4, "SEQNUM  ", 8) != 0)) {
+            return false;
+        }
+
+        int seqnum;
+        std::memcpy(&seqnum, record.data() + headerSize + sizeof(int), sizeof seqnum);
+
+        return Opm::EclIO::flipEndianInt(seqnum) == step.seqnum;
+    }
+}
+
+namespace Opm { namespace EclIO {
+
+std::string RestartIndex::fileName(const std::string& restartFile)
+{
+    return restartFile + ".INDEX";
+}
+
+std::vector<RestartIndex::Step> RestartIndex::read(const std::string& restartFile)
+{
+    const auto fname = fileName(restartFile);
+
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(fname, ec)) {
+        return {};
+    }
+
+    const auto fileSize = std::filesystem::file_size(restartFile, ec);
+    if (ec) {
+        return {};
+    }
+
+    std::vector<Step> steps;
+
+    try {
+        EclFile index(fname, EclFile::Formatted{ false });
+        index.loadData();
+
+        const auto& names = index.arrayNames();
+        if (names.size() % stepArrays.size() != 0) {
+            return {};
+        }
+
+        for (std::size_t i = 0; i < names.size(); i += stepArrays.size()) {
+            for (std::size_t j = 0; j < stepArrays.size(); ++j) {
+                if (names[i + j] != stepArrays[j]) {
+                    return {};
+                }
+            }
+
+            const auto& seqnum    = index.get<int>(i);
+            const auto& arrName   = index.get<std::string>(i + 1);
+            const auto& type      = index.get<int>(i + 2);
+            const auto& elemSize  = index.get<int>(i + 3);
+            const auto& size      = index.get<double>(i + 4);
+            const auto& dataPos   = index.get<double>(i + 5);
+            const auto& endPos    = index.get<double>(i + 6);
+
+            const auto n = arrName.size();
+            if ((seqnum.size() != 1) || (endPos.size() != 1) ||
+                (type.size() != n) || (elemSize.size() != n) ||
+                (size.size() != n) || (dataPos.size() != n))
+            {
+                return {};
+            }
+
+            auto& step = steps.emplace_back();
+            step.seqnum = seqnum.front();
+            step.endPos = static_cast<std::uint64_t>(endPos.front());
+            step.arrays.reserve(n);
+
+            for (std::size_t k = 0; k < n; ++k) {
+                if (!validType(type[k])) {
+                    return {};
+                }
+
+                step.arrays.push_back({ arrName[k], static_cast<eclArrType>(type[k]),
+                                        static_cast<std::int64_t>(size[k]), elemSize[k],
+                                        static_cast<std::uint64_t>(dataPos[k]) });
+            }
+        }
+    }
+    catch (const std::exception&) {
+        return {};
+    }
+
+    if (!consistent(steps, fileSize) || !lastStepMatches(restartFile, steps.back())) {
+        return {};
+    }
+
+    return steps;
+}
+
+RestartIndex::RestartIndex(const std::string& restartFile)
+    : fname_{ fileName(restartFile) }
+{}
+
+RestartIndex::~RestartIndex()
+{}
+
+void RestartIndex::create(const std::vector<Step>& steps)
+{
+    this->stream_ = std::make_unique<EclOutput>(this->fname_, false, std::ios::out);
+    this->stepPos_.clear();
+
+    for (const auto& step : steps) {
+        this->write(step);
+    }
+}
+
+void RestartIndex::truncate(const int seqnum)
+{
+    auto pos = this->stepPos_.lower_bound(seqnum);
+    if ((this->stream_ == nullptr) || (pos == this->stepPos_.end())) {
+        return;
+    }
+
+    this->stream_->flushStream();
+
+    std::filesystem::resize_file(this->fname_, pos->second);
+
+    if (! this->stream_->ofileH.seekp(pos->second)) {
+        throw std::invalid_argument {
+            "Unable to Seek to Write Position " +
+            std::to_string(pos->second) + " of File '"
+            + this->fname_ + "'"
+        };
+    }
+
+    this->stepPos_.erase(pos, this->stepPos_.end());
+}
+
+void RestartIndex::beginStep(const int seqnum)
+{
+    this->current_ = Step{};
+    this->current_.seqnum = seqnum;
+}
+
+void RestartIndex::addArray(Array array)
+{
+    this->current_.arrays.push_back(std::move(array));
+}
+
+void RestartIndex::endStep(const std::uint64_t endPos)
+{
+    this->current_.endPos = endPos;
+
+    if (this->stream_ != nullptr) {
+        this->write(this->current_);
+    }
+
+    this->current_ = Step{};
+}
+
+void RestartIndex::write(const Step& step)
+{
+    const auto n = step.arrays.size();
+
+    std::vector<std::string> names;    names.reserve(n);
+    std::vector<int>         types;    types.reserve(n);
+    std::vector<int>         elmSizes; elmSizes.reserve(n);
+    std::vector<double>      sizes;    sizes.reserve(n);
+    std::vector<double>      dataPos;  dataPos.reserve(n);
+
+    for (const auto& array : step.arrays) {
+        names.push_back(array.name);
+        types.push_back(static_cast<int>(array.type));
+        elmSizes.push_back(array.elementSize);
+        sizes.push_back(static_cast<double>(array.size));
+        dataPos.push_back(static_cast<double>(array.dataPos));
+    }
+
+    this->stepPos_.insert_or_assign(step.seqnum, this->stream_->ofileH.tellp());
+
+    this->stream_->write(stepArrays[0], std::vector<int>{ step.seqnum });
+    this->stream_->write(stepArrays[1], names);
+    this->stream_->write(stepArrays[2], types);
+    this->stream_->write(stepArrays[3], elmSizes);
+    this->stream_->write(stepArrays[4], sizes);
+    this->stream_->write(stepArrays[5], dataPos);
+    this->stream_->write(stepArrays[6], std::vector<double>{ static_cast<double>(step.endPos) });
+
+    // Index must never be ahead of restart file contents on disk, which
+    // have been flushed before the report step is ended.
+    this->stream_->flushStream();
+}
+
+}} // namespace Opm::EclIO
@@ -143,7 +143,7 @@ applySwatinit(unsigned elemIdx,
               Scalar pcow,
               Scalar Sw)
 {
-    auto& elemScaledEpsInfo = oilWaterScaledEpsInfoDrainage_[elemIdx];
+    auto elemScaledEpsInfo = oilWaterScaledEpsInfoDrainage_.get(elemIdx);
     bool newSwatInit = false;
 
     // TODO: Mixed wettability systems - see ecl kw OPTIONS switch 74
@@ -204,6 +204,7 @@ applySwatinit(unsigned elemIdx,
             elemEclEpsScalingPoints.init(elemScaledEpsInfo,
                                          *oilWaterEclEpsConfig_,
                                          EclTwoPhaseSystemType::OilWater);
+            oilWaterScaledEpsInfoDrainage_.set(elemIdx, elemScaledEpsInfo);
         }
     }
 
@@ -217,10 +218,11 @@ EclMaterialLawManager<TraitsT>::applyRestartSwatInit(const unsigned elemIdx,
 {
     // Maximum capillary pressure adjusted from SWATINIT data.
 
-    auto& elemScaledEpsInfo =
-        this->oilWaterScaledEpsInfoDrainage_[elemIdx];
+    auto elemScaledEpsInfo =
+        this->oilWaterScaledEpsInfoDrainage_.get(elemIdx);
 
     elemScaledEpsInfo.maxPcow = maxPcow;
+    this->oilWaterScaledEpsInfoDrainage_.set(elemIdx, elemScaledEpsInfo);
 
     this->oilWaterScaledEpsPointsDrainage(elemIdx)
         .init(elemScaledEpsInfo,
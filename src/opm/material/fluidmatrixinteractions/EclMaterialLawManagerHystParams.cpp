@@ -22,18 +22,39 @@
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
 
+namespace {
+
+template <class Storage>
+auto& paramSlot(Storage& storage, std::size_t paramIdx)
+{
+    auto& params = storage[storage.size() == 1 ? 0 : paramIdx];
+    params = {};
+    return params;
+}
+
+// The parameter objects are owned by the manager's ParamStorage arrays,
+// which never reallocate after initialisation. Hand them out without
+// reference counting.
+template <class Params>
+std::shared_ptr<Params> nonOwning(Params* params)
+{
+    return std::shared_ptr<Params>(std::shared_ptr<Params>{}, params);
+}
+
+}
+
 namespace Opm {
 
 /* constructors*/
 template <class Traits>
 EclMaterialLawManager<Traits>::InitParams::HystParams::
-HystParams(EclMaterialLawManager<Traits>::InitParams& init_params) :
+HystParams(EclMaterialLawManager<Traits>::InitParams& init_params, std::size_t paramIdx) :
     init_params_{init_params}, parent_{init_params_.parent_},
     eclState_{init_params_.eclState_}
 {
-    gasOilParams_ = std::make_shared<GasOilTwoPhaseHystParams>();
-    oilWaterParams_ = std::make_shared<OilWaterTwoPhaseHystParams>();
-    gasWaterParams_ = std::make_shared<GasWaterTwoPhaseHystParams>();
+    gasOilParams_ = &paramSlot(parent_.gasOilParamStorage_, paramIdx);
+    oilWaterParams_ = &paramSlot(parent_.oilWaterParamStorage_, paramIdx);
+    gasWaterParams_ = &paramSlot(parent_.gasWaterParamStorage_, paramIdx);
 }
 
 /* public methods, alphabetically sorted */
@@ -56,7 +77,7 @@ std::shared_ptr<typename EclMaterialLawManager<Traits>::GasOilTwoPhaseHystParams
 EclMaterialLawManager<Traits>::InitParams::HystParams::
 getGasOilParams()
 {
-    return gasOilParams_;
+    return nonOwning(gasOilParams_);
 }
 
 template <class Traits>
@@ -64,7 +85,7 @@ std::shared_ptr<typename EclMaterialLawManager<Traits>::OilWaterTwoPhaseHystPara
 EclMaterialLawManager<Traits>::InitParams::HystParams::
 getOilWaterParams()
 {
-    return oilWaterParams_;
+    return nonOwning(oilWaterParams_);
 }
 
 template <class Traits>
@@ -72,7 +93,7 @@ std::shared_ptr<typename EclMaterialLawManager<Traits>::GasWaterTwoPhaseHystPara
 EclMaterialLawManager<Traits>::InitParams::HystParams::
 getGasWaterParams()
 {
-    return gasWaterParams_;
+    return nonOwning(gasWaterParams_);
 }
 
 template <class Traits>
@@ -143,7 +164,7 @@ setDrainageParamsOilWater(unsigned elemIdx, unsigned satRegionIdx)
     //  since we currently does not support facedir for the scaling points info
     //  When such support is added, we need to extend the below vector which has info for each cell
     //   to include three more vectors, one with info for each facedir of a cell
-    this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx] = oilWaterScaledInfo;
+    this->parent_.oilWaterScaledEpsInfoDrainage_.set(elemIdx, oilWaterScaledInfo);
     if (hasOilWater_()) {
         OilWaterEpsTwoPhaseParams oilWaterDrainParams;
         oilWaterDrainParams.setConfig(this->parent_.oilWaterConfig_);
@@ -64,11 +64,13 @@ run() {
     std::vector<std::vector<MaterialLawParams>*> mlpArray;
     initArrays_(satnumArray, imbnumArray, mlpArray);
     auto num_arrays = mlpArray.size();
+    initParamStorage_(num_arrays);
     for (unsigned i=0; i<num_arrays; i++) {
         for (unsigned elemIdx = 0; elemIdx < this->numCompressedElems_; ++elemIdx) {
             unsigned satRegionIdx = satRegion_(*satnumArray[i], elemIdx);
             //unsigned satNumCell = this->parent_.satnumRegionArray_[elemIdx];
-            HystParams hystParams {*this};
+            const std::size_t paramIdx = i*this->numCompressedElems_ + elemIdx;
+            HystParams hystParams {*this, paramIdx};
             hystParams.setConfig(satRegionIdx);
             hystParams.setDrainageParamsOilGas(elemIdx, satRegionIdx);
             hystParams.setDrainageParamsOilWater(elemIdx, satRegionIdx);
@@ -80,7 +82,7 @@ run() {
                 hystParams.setImbibitionParamsGasWater(elemIdx, imbRegionIdx);
             }
             hystParams.finalize();
-            initThreePhaseParams_(hystParams, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
+            initThreePhaseParams_(hystParams, paramIdx, (*mlpArray[i])[elemIdx], satRegionIdx, elemIdx);
         }
     }
 }
@@ -178,6 +180,28 @@ initOilWaterScaledEpsInfo_()
     this->parent_.oilWaterScaledEpsInfoDrainage_.resize(this->numCompressedElems_);
 }
 
+template <class Traits>
+void
+EclMaterialLawManager<Traits>::InitParams::
+initParamStorage_(std::size_t numArrays)
+{
+    auto& parent = this->parent_;
+    const auto numParams = numArrays * this->numCompressedElems_;
+    const auto approach = parent.threePhaseApproach_;
+
+    // One entry per cell and direction for the selected approach.
+    parent.stone1ParamStorage_.allocate(approach == EclMultiplexerApproach::Stone1 ? numParams : 0);
+    parent.stone2ParamStorage_.allocate(approach == EclMultiplexerApproach::Stone2 ? numParams : 0);
+    parent.defaultParamStorage_.allocate(approach == EclMultiplexerApproach::Default ? numParams : 0);
+    parent.twoPhaseParamStorage_.allocate(approach == EclMultiplexerApproach::TwoPhase ? numParams : 0);
+
+    // One entry per cell and direction for the simulated phase pairs,
+    // a single placeholder otherwise.
+    parent.gasOilParamStorage_.allocate((parent.hasGas && parent.hasOil) ? numParams : 1);
+    parent.oilWaterParamStorage_.allocate((parent.hasOil && parent.hasWater) ? numParams : 1);
+    parent.gasWaterParamStorage_.allocate((parent.hasGas && parent.hasWater && !parent.hasOil) ? numParams : 1);
+}
+
 template <class Traits>
 void
 EclMaterialLawManager<Traits>::InitParams::
@@ -202,19 +226,20 @@ template <class Traits>
 void
 EclMaterialLawManager<Traits>::InitParams::
 initThreePhaseParams_(HystParams &hystParams,
+                      std::size_t paramIdx,
                       MaterialLawParams& materialParams,
                       unsigned satRegionIdx,
                       unsigned elemIdx)
 {
-    const auto& epsInfo = this->parent_.oilWaterScaledEpsInfoDrainage_[elemIdx];
+    const auto epsInfo = this->parent_.oilWaterScaledEpsInfoDrainage_.get(elemIdx);
 
     auto oilWaterParams = hystParams.getOilWaterParams();
     auto gasOilParams = hystParams.getGasOilParams();
     auto gasWaterParams = hystParams.getGasWaterParams();
-    materialParams.setApproach(this->parent_.threePhaseApproach_);
-    switch (materialParams.approach()) {
+    switch (this->parent_.threePhaseApproach_) {
         case EclMultiplexerApproach::Stone1: {
-            auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone1>();
+            auto& realParams = this->parent_.stone1ParamStorage_[paramIdx];
+            materialParams.setApproach(EclMultiplexerApproach::Stone1, realParams);
             realParams.setGasOilParams(gasOilParams);
             realParams.setOilWaterParams(oilWaterParams);
             realParams.setSwl(epsInfo.Swl);
@@ -229,7 +254,8 @@ initThreePhaseParams_(HystParams &hystParams,
         }
 
         case EclMultiplexerApproach::Stone2: {
-            auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Stone2>();
+            auto& realParams = this->parent_.stone2ParamStorage_[paramIdx];
+            materialParams.setApproach(EclMultiplexerApproach::Stone2, realParams);
             realParams.setGasOilParams(gasOilParams);
             realParams.setOilWaterParams(oilWaterParams);
             realParams.setSwl(epsInfo.Swl);
@@ -238,7 +264,8 @@ initThreePhaseParams_(HystParams &hystParams,
         }
 
         case EclMultiplexerApproach::Default: {
-            auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::Default>();
+            auto& realParams = this->parent_.defaultParamStorage_[paramIdx];
+            materialParams.setApproach(EclMultiplexerApproach::Default, realParams);
             realParams.setGasOilParams(gasOilParams);
             realParams.setOilWaterParams(oilWaterParams);
             realParams.setSwl(epsInfo.Swl);
@@ -247,7 +274,8 @@ initThreePhaseParams_(HystParams &hystParams,
         }
 
         case EclMultiplexerApproach::TwoPhase: {
-            auto& realParams = materialParams.template getRealParams<EclMultiplexerApproach::TwoPhase>();
+            auto& realParams = this->parent_.twoPhaseParamStorage_[paramIdx];
+            materialParams.setApproach(EclMultiplexerApproach::TwoPhase, realParams);
             realParams.setGasOilParams(gasOilParams);
             realParams.setOilWaterParams(oilWaterParams);
             realParams.setGasWaterParams(gasWaterParams);
@@ -257,7 +285,8 @@ initThreePhaseParams_(HystParams &hystParams,
         }
 
         case EclMultiplexerApproach::OnePhase: {
-            // Nothing to do, no parameters.
+            // No parameters.
+            materialParams.setApproach(EclMultiplexerApproach::OnePhase);
             break;
         }
     } // end switch()
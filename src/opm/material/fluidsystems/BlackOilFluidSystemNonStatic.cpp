@@ -0,0 +1,62 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+#include <opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#if HAVE_ECL_INPUT
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/FlatTable.hpp>
+#include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
+#endif
+
+#include <fmt/format.h>
+
+#include <type_traits>
+
+#define FLUIDSYSTEM_CLASSNAME BlackOilFluidSystemNonStatic
+#define STATIC_OR_NOTHING
+#define CONST_OR_NOTHING const
+#define FLUIDSYSTEM_IS_STATIC 0
+#include "BlackOilFluidSystem_impl_macrotemplate.hpp"
+#undef FLUIDSYSTEM_CLASSNAME
+#undef STATIC_OR_NOTHING
+#undef CONST_OR_NOTHING
+#undef FLUIDSYSTEM_IS_STATIC
+
+namespace Opm {
+
+template class BlackOilFluidSystemNonStatic<double,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<float,BlackOilDefaultIndexTraits>;
+template class BlackOilFluidSystemNonStatic<double,BlackOilDefaultIndexTraits,
+                                            WetGasPvt<double>,
+                                            LiveOilPvt<double>,
+                                            ConstantCompressibilityWaterPvt<double>>;
+template class BlackOilFluidSystemNonStatic<float,BlackOilDefaultIndexTraits,
+                                            WetGasPvt<float>,
+                                            LiveOilPvt<float>,
+                                            ConstantCompressibilityWaterPvt<float>>;
+
+} // namespace Opm
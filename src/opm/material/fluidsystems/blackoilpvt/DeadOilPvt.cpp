@@ -114,6 +114,9 @@ void DeadOilPvt<Scalar>::initEnd()
                                               pressureColumn,
                                               invBMuColumn);
     }
+
+    packedInverseOilB_ = PackedTabulated1DFunctions<Scalar>(inverseOilB_);
+    packedInverseOilBMu_ = PackedTabulated1DFunctions<Scalar>(inverseOilBMu_);
 }
 
 template class DeadOilPvt<double>;
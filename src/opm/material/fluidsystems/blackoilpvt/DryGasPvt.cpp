@@ -134,6 +134,9 @@ void DryGasPvt<Scalar>::initEnd()
 
         inverseGasBMu_[regionIdx].setXYContainers(pressureValues, invGasBMuValues);
     }
+
+    packedInverseGasB_ = PackedTabulated1DFunctions<Scalar>(inverseGasB_);
+    packedInverseGasBMu_ = PackedTabulated1DFunctions<Scalar>(inverseGasBMu_);
 }
 
 template class DryGasPvt<double>;
@@ -28,29 +28,39 @@
 
 namespace Opm {
 template <class Scalar, bool enableThermal>
-void GasPvtMultiplexer<Scalar,enableThermal>::
-initFromState(const EclipseState& eclState, const Schedule& schedule)
+GasPvtApproach GasPvtMultiplexer<Scalar,enableThermal>::
+chooseApproach(const EclipseState& eclState)
 {
     if (!eclState.runspec().phases().active(Phase::GAS))
-        return;
+        return GasPvtApproach::NoGas;
 
     if (eclState.runspec().co2Storage())
-        setApproach(GasPvtApproach::Co2Gas);
-    else if (eclState.runspec().h2Storage())
-        setApproach(GasPvtApproach::H2Gas);
-    else if (enableThermal && eclState.getSimulationConfig().isThermal())
-        setApproach(GasPvtApproach::ThermalGas);
-    else if (!eclState.getTableManager().getPvtgwTables().empty() &&
+        return GasPvtApproach::Co2Gas;
+    if (eclState.runspec().h2Storage())
+        return GasPvtApproach::H2Gas;
+    if (enableThermal && eclState.getSimulationConfig().isThermal())
+        return GasPvtApproach::ThermalGas;
+    if (!eclState.getTableManager().getPvtgwTables().empty() &&
             !eclState.getTableManager().getPvtgTables().empty())
-        setApproach(GasPvtApproach::WetHumidGas);
-    else if (!eclState.getTableManager().getPvtgTables().empty())
-        setApproach(GasPvtApproach::WetGas);
-    else if (eclState.getTableManager().hasTables("PVDG"))
-        setApproach(GasPvtApproach::DryGas);
-    else if (!eclState.getTableManager().getPvtgwTables().empty())
-        setApproach(GasPvtApproach::DryHumidGas);
+        return GasPvtApproach::WetHumidGas;
+    if (!eclState.getTableManager().getPvtgTables().empty())
+        return GasPvtApproach::WetGas;
+    if (eclState.getTableManager().hasTables("PVDG"))
+        return GasPvtApproach::DryGas;
+    if (!eclState.getTableManager().getPvtgwTables().empty())
+        return GasPvtApproach::DryHumidGas;
 
+    return GasPvtApproach::NoGas;
+}
+
+template <class Scalar, bool enableThermal>
+void GasPvtMultiplexer<Scalar,enableThermal>::
+initFromState(const EclipseState& eclState, const Schedule& schedule)
+{
+    if (!eclState.runspec().phases().active(Phase::GAS))
+        return;
 
+    setApproach(chooseApproach(eclState));
     OPM_GAS_PVT_MULTIPLEXER_CALL(pvtImpl.initFromState(eclState, schedule));
 }
 
@@ -341,6 +341,9 @@ void LiveOilPvt<Scalar>::initEnd()
 
         updateSaturationPressure_(regionIdx);
     }
+
+    packedInverseOilBTable_ = PackedUniformXTabulated2DFunctions<Scalar>(inverseOilBTable_);
+    packedInverseOilBMuTable_ = PackedUniformXTabulated2DFunctions<Scalar>(inverseOilBMuTable_);
 }
 
 template<class Scalar>
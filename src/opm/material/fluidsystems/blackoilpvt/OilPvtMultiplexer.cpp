@@ -30,27 +30,38 @@
 namespace Opm {
 
 template <class Scalar, bool enableThermal>
-void OilPvtMultiplexer<Scalar,enableThermal>::
-initFromState(const EclipseState& eclState, const Schedule& schedule)
+OilPvtApproach OilPvtMultiplexer<Scalar,enableThermal>::
+chooseApproach(const EclipseState& eclState)
 {
     if (!eclState.runspec().phases().active(Phase::OIL))
-        return;
+        return OilPvtApproach::NoOil;
 
     // The co2Storage option both works with oil + gas
     // and water/brine + gas
     if (eclState.runspec().co2Storage())
-        setApproach(OilPvtApproach::BrineCo2);
-    else if (eclState.runspec().h2Storage())
-        setApproach(OilPvtApproach::BrineH2);
-    else if (enableThermal && eclState.getSimulationConfig().isThermal())
-        setApproach(OilPvtApproach::ThermalOil);
-    else if (!eclState.getTableManager().getPvcdoTable().empty())
-        setApproach(OilPvtApproach::ConstantCompressibilityOil);
-    else if (eclState.getTableManager().hasTables("PVDO"))
-        setApproach(OilPvtApproach::DeadOil);
-    else if (!eclState.getTableManager().getPvtoTables().empty())
-        setApproach(OilPvtApproach::LiveOil);
+        return OilPvtApproach::BrineCo2;
+    if (eclState.runspec().h2Storage())
+        return OilPvtApproach::BrineH2;
+    if (enableThermal && eclState.getSimulationConfig().isThermal())
+        return OilPvtApproach::ThermalOil;
+    if (!eclState.getTableManager().getPvcdoTable().empty())
+        return OilPvtApproach::ConstantCompressibilityOil;
+    if (eclState.getTableManager().hasTables("PVDO"))
+        return OilPvtApproach::DeadOil;
+    if (!eclState.getTableManager().getPvtoTables().empty())
+        return OilPvtApproach::LiveOil;
+
+    return OilPvtApproach::NoOil;
+}
+
+template <class Scalar, bool enableThermal>
+void OilPvtMultiplexer<Scalar,enableThermal>::
+initFromState(const EclipseState& eclState, const Schedule& schedule)
+{
+    if (!eclState.runspec().phases().active(Phase::OIL))
+        return;
 
+    setApproach(chooseApproach(eclState));
     OPM_OIL_PVT_MULTIPLEXER_CALL(pvtImpl.initFromState(eclState, schedule));
 }
 
@@ -30,25 +30,36 @@
 namespace Opm {
 
 template<class Scalar, bool enableThermal, bool enableBrine>
-void WaterPvtMultiplexer<Scalar,enableThermal,enableBrine>::
-initFromState(const EclipseState& eclState, const Schedule& schedule)
+WaterPvtApproach WaterPvtMultiplexer<Scalar,enableThermal,enableBrine>::
+chooseApproach(const EclipseState& eclState)
 {
     if (!eclState.runspec().phases().active(Phase::WATER))
-        return;
+        return WaterPvtApproach::NoWater;
 
     // The co2Storage option both works with oil + gas
     // and water/brine + gas
     if (eclState.runspec().co2Storage())
-        setApproach(WaterPvtApproach::BrineCo2);
-    else if (eclState.runspec().h2Storage())
-        setApproach(WaterPvtApproach::BrineH2);
-    else if (enableThermal && eclState.getSimulationConfig().isThermal())
-        setApproach(WaterPvtApproach::ThermalWater);
-    else if (!eclState.getTableManager().getPvtwTable().empty())
-        setApproach(WaterPvtApproach::ConstantCompressibilityWater);
-    else if (enableBrine && !eclState.getTableManager().getPvtwSaltTables().empty())
-        setApproach(WaterPvtApproach::ConstantCompressibilityBrine);
+        return WaterPvtApproach::BrineCo2;
+    if (eclState.runspec().h2Storage())
+        return WaterPvtApproach::BrineH2;
+    if (enableThermal && eclState.getSimulationConfig().isThermal())
+        return WaterPvtApproach::ThermalWater;
+    if (!eclState.getTableManager().getPvtwTable().empty())
+        return WaterPvtApproach::ConstantCompressibilityWater;
+    if (enableBrine && !eclState.getTableManager().getPvtwSaltTables().empty())
+        return WaterPvtApproach::ConstantCompressibilityBrine;
+
+    return WaterPvtApproach::NoWater;
+}
+
+template<class Scalar, bool enableThermal, bool enableBrine>
+void WaterPvtMultiplexer<Scalar,enableThermal,enableBrine>::
+initFromState(const EclipseState& eclState, const Schedule& schedule)
+{
+    if (!eclState.runspec().phases().active(Phase::WATER))
+        return;
 
+    setApproach(chooseApproach(eclState));
     OPM_WATER_PVT_MULTIPLEXER_CALL(pvtImpl.initFromState(eclState, schedule));
 }
 
@@ -371,6 +371,9 @@ void WetGasPvt<Scalar>::initEnd()
 
         updateSaturationPressure_(regionIdx);
     }
+
+    packedInverseGasB_ = PackedUniformXTabulated2DFunctions<Scalar>(inverseGasB_);
+    packedInverseGasBMu_ = PackedUniformXTabulated2DFunctions<Scalar>(inverseGasBMu_);
 }
 
 template<class Scalar>
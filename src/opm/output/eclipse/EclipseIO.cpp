@@ -31,8 +31,12 @@
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
@@ -54,14 +58,21 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <functional>
 #include <limits>
 #include <memory>     // unique_ptr
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 #include <utility>    // move
+#include <vector>
 
 
 namespace {
@@ -98,13 +109,192 @@ void ensure_directory_exists( const std::filesystem::path& odir )
     }
 }
 
+/// Runs output tasks, in order of submission, on a dedicated thread.
+///
+/// The number of tasks waiting to be run is bounded.  Submitting a task
+/// to a full queue blocks until the thread has started on the oldest
+/// task.  If a task throws, the remaining queued tasks are discarded and
+/// the exception is rethrown from the next call to push() or flush().
+///
+/// OpmLog is not thread safe, so messages logged by the tasks are kept
+/// and passed to OpmLog by the next call to push(), flush() or
+/// logMessages() on the thread owning the OutputThread.
+class OutputThread
+{
+public:
+    using Task = std::function<void()>;
+
+    explicit OutputThread(const std::size_t maxPending)
+        : maxPending_{ std::max(maxPending, std::size_t{1}) }
+        , thread_    { [this]() { this->run(); } }
+    {}
+
+    ~OutputThread()
+    {
+        {
+            std::lock_guard<std::mutex> lock{ this->mutex_ };
+            this->stop_ = true;
+        }
+
+        this->taskAvailable_.notify_one();
+        this->thread_.join();
+
+        Opm::OpmLog::addDeferredMessages(this->messages_);
+
+        if (this->error_ != nullptr) {
+            try {
+                std::rethrow_exception(this->error_);
+            }
+            catch (const std::exception& e) {
+                Opm::OpmLog::error(std::string { "Background output failed: " } + e.what());
+            }
+            catch (...) {
+                Opm::OpmLog::error("Background output failed");
+            }
+        }
+    }
+
+    OutputThread(const OutputThread&) = delete;
+    OutputThread& operator=(const OutputThread&) = delete;
+
+    void push(Task task)
+    {
+        auto messages = std::vector<Opm::OpmLog::DeferredMessage>{};
+        auto error = std::exception_ptr{};
+        {
+            std::unique_lock<std::mutex> lock{ this->mutex_ };
+            this->taskDone_.wait(lock, [this]()
+            {
+                return (this->tasks_.size() < this->maxPending_)
+                    || (this->error_ != nullptr);
+            });
+
+            messages.swap(this->messages_);
+            error = std::exchange(this->error_, nullptr);
+            if (error == nullptr) {
+                this->tasks_.push_back(std::move(task));
+            }
+        }
+
+        if (error == nullptr) {
+            this->taskAvailable_.notify_one();
+        }
+
+        Opm::OpmLog::addDeferredMessages(messages);
+
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void flush()
+    {
+        auto messages = std::vector<Opm::OpmLog::DeferredMessage>{};
+        auto error = std::exception_ptr{};
+        {
+            std::unique_lock<std::mutex> lock{ this->mutex_ };
+            this->taskDone_.wait(lock, [this]()
+            {
+                return this->tasks_.empty() && !this->busy_;
+            });
+
+            messages.swap(this->messages_);
+            error = std::exchange(this->error_, nullptr);
+        }
+
+        Opm::OpmLog::addDeferredMessages(messages);
+
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /// Pass the messages of the tasks completed so far to OpmLog.
+    void logMessages()
+    {
+        auto messages = std::vector<Opm::OpmLog::DeferredMessage>{};
+        {
+            std::lock_guard<std::mutex> lock{ this->mutex_ };
+            messages.swap(this->messages_);
+        }
+
+        Opm::OpmLog::addDeferredMessages(messages);
+    }
+
+private:
+    std::size_t maxPending_;
+    std::deque<Task> tasks_{};
+    bool busy_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+    std::vector<Opm::OpmLog::DeferredMessage> messages_{};
+
+    std::mutex mutex_{};
+    std::condition_variable taskAvailable_{};
+    std::condition_variable taskDone_{};
+
+    // Must be last, the thread starts running in the constructor.
+    std::thread thread_;
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock{ this->mutex_ };
+
+        while (true) {
+            this->taskAvailable_.wait(lock, [this]()
+            {
+                return this->stop_ || !this->tasks_.empty();
+            });
+
+            if (this->tasks_.empty()) {
+                // Stop requested and all tasks done.
+                return;
+            }
+
+            auto task = std::move(this->tasks_.front());
+            this->tasks_.pop_front();
+            this->busy_ = true;
+
+            lock.unlock();
+
+            auto messages = std::vector<Opm::OpmLog::DeferredMessage>{};
+            auto error = std::exception_ptr{};
+            try {
+                const Opm::OpmLog::DeferMessages defer{ messages };
+                task();
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+
+            lock.lock();
+
+            this->messages_.insert(this->messages_.end(),
+                                   std::make_move_iterator(messages.begin()),
+                                   std::make_move_iterator(messages.end()));
+
+            this->busy_ = false;
+            if (error != nullptr) {
+                if (this->error_ == nullptr) {
+                    this->error_ = error;
+                }
+
+                this->tasks_.clear();
+            }
+
+            this->taskDone_.notify_all();
+        }
+    }
+
+};
+
 }
 
 namespace Opm {
 class EclipseIO::Impl {
     public:
-    Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& , const std::string& baseName, const bool& writeEsmry);
-        void writeINITFile( const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const std::vector<NNCdata>& nnc) const;
+    Impl( const EclipseState&, EclipseGrid, const Schedule&, const SummaryConfig& , const std::string& baseName, const bool& writeEsmry, const bool& writeCsmry);
+        void writeINITFile( const Schedule& sched, const data::Solution& simProps, std::map<std::string, std::vector<int> > int_data, const std::vector<NNCdata>& nnc) const;
         void writeEGRIDFile( const std::vector<NNCdata>& nnc );
         std::pair<bool, bool> wantRFTOutput( const int report_step, const bool isSubstep ) const;
 
@@ -114,6 +304,53 @@ class EclipseIO::Impl {
 
         void recordSummaryOutput(const double secs_elapsed);
 
+        EclIO::OutputStream::Restart openRestartFile(const int report_step);
+
+        void writeTimeStep(const Schedule&      sched,
+                           const Action::State& action_state,
+                           const WellTestState& wtest_state,
+                           const SummaryState&  st,
+                           const UDQState&      udq_state,
+                           const int            report_step,
+                           const bool           isSubstep,
+                           const double         secs_elapsed,
+                           const bool           writeSummary,
+                           const std::pair<bool, bool>& rft,
+                           RestartValue         value,
+                           const bool           write_double);
+
+        void writeInitialFiles(const Schedule&                         sched,
+                               data::Solution                          simProps,
+                               std::map<std::string, std::vector<int>> int_data,
+                               const std::vector<NNCdata>&             nnc);
+
+        void enableAsyncOutput(const std::size_t maxPendingTasks);
+
+        bool asyncOutput() const
+        {
+            return this->outputThread_ != nullptr;
+        }
+
+        /// Queue output task for the output thread.  Async output must be
+        /// enabled.
+        void pushOutputTask(OutputThread::Task task);
+
+        void flushOutput();
+
+        /// Pass messages from completed output tasks to OpmLog.
+        void logOutputMessages();
+
+        /// Copy of the Schedule used by the output thread.  Taken on first
+        /// use after enableAsyncOutput() or scheduleChanged().
+        std::shared_ptr<const Schedule> scheduleSnapshot();
+
+        /// Take a new copy of the Schedule for output tasks queued from
+        /// now on.  Pending tasks keep the copy they were queued with.
+        void scheduleChanged()
+        {
+            this->scheduleSnapshot_.reset();
+        }
+
         const EclipseState& es;
         EclipseGrid grid;
         const Schedule& schedule;
@@ -129,6 +366,17 @@ private:
     mutable bool sumthin_triggered_{false};
     double last_sumthin_output_{std::numeric_limits<double>::lowest()};
 
+    /// Schedule as of the last scheduleChanged() call.  Shared by all
+    /// output tasks queued since then.
+    std::shared_ptr<const Schedule> scheduleSnapshot_{};
+
+    /// Unified restart file, kept open across report steps.
+    std::optional<EclIO::OutputStream::UnifiedRestart> unifiedRestart_{};
+
+    /// Background output thread.  Null unless async output is enabled.
+    /// Declared last since the thread's tasks access all other members.
+    std::unique_ptr<OutputThread> outputThread_{};
+
     bool checkAndRecordIfSumthinTriggered(const int report_step,
                                           const double secs_elapsed) const;
     bool summaryAtRptOnly(const int report_step) const;
@@ -139,14 +387,15 @@ EclipseIO::Impl::Impl( const EclipseState& eclipseState,
                        const Schedule& schedule_,
                        const SummaryConfig& summary_config,
                        const std::string& base_name,
-                       const bool& writeEsmry)
+                       const bool& writeEsmry,
+                       const bool& writeCsmry)
     : es( eclipseState )
     , grid( std::move( grid_ ) )
     , schedule( schedule_ )
     , outputDir( eclipseState.getIOConfig().getOutputDir() )
     , baseName( uppercase( eclipseState.getIOConfig().getBaseName() ) )
     , summaryConfig( summary_config )
-    , summary( eclipseState, summaryConfig, grid , schedule, base_name, writeEsmry )
+    , summary( eclipseState, summaryConfig, grid , schedule, base_name, writeEsmry, writeCsmry )
     , output_enabled( eclipseState.getIOConfig().getOutputEnabled() )
 {
     if (const auto& aqConfig = this->es.aquifer();
@@ -159,16 +408,20 @@ EclipseIO::Impl::Impl( const EclipseState& eclipseState,
 }
 
 
-void EclipseIO::Impl::writeINITFile(const data::Solution&                   simProps,
+void EclipseIO::Impl::writeINITFile(const Schedule&                         sched,
+                                    const data::Solution&                   simProps,
                                     std::map<std::string, std::vector<int>> int_data,
                                     const std::vector<NNCdata>&             nnc) const
 {
+    const auto& ioConfig = this->es.cfg().io();
+
     EclIO::OutputStream::Init initFile {
         EclIO::OutputStream::ResultSet { this->outputDir, this->baseName },
-        EclIO::OutputStream::Formatted { this->es.cfg().io().getFMTOUT() }
+        EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+        EclIO::OutputStream::Compressed { ioConfig.getCompressedOutput() }
     };
 
-    InitIO::write(this->es, this->grid, this->schedule,
+    InitIO::write(this->es, this->grid, sched,
                   simProps, std::move(int_data), nnc, initFile);
 }
 
@@ -224,6 +477,151 @@ void EclipseIO::Impl::recordSummaryOutput(const double secs_elapsed)
         this->last_sumthin_output_ = secs_elapsed;
 }
 
+EclIO::OutputStream::Restart
+EclipseIO::Impl::openRestartFile(const int report_step)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    const auto rset = EclIO::OutputStream::ResultSet {
+        this->outputDir, this->baseName
+    };
+
+    const auto fmt = EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() };
+    const auto compr = EclIO::OutputStream::Compressed { ioConfig.getCompressedOutput() };
+
+    if (! ioConfig.getUNIFOUT()) {
+        return EclIO::OutputStream::Restart {
+            rset, report_step, fmt, EclIO::OutputStream::Unified { false }, compr
+        };
+    }
+
+    if (! this->unifiedRestart_.has_value()) {
+        const auto indexed = EclIO::OutputStream::Indexed { ioConfig.getRestartIndex() };
+        this->unifiedRestart_.emplace(rset, fmt, compr, indexed);
+    }
+
+    return this->unifiedRestart_->prepareStep(report_step);
+}
+
+void EclipseIO::Impl::writeTimeStep(const Schedule&      sched,
+                                    const Action::State& action_state,
+                                    const WellTestState& wtest_state,
+                                    const SummaryState&  st,
+                                    const UDQState&      udq_state,
+                                    const int            report_step,
+                                    const bool           isSubstep,
+                                    const double         secs_elapsed,
+                                    const bool           writeSummary,
+                                    const std::pair<bool, bool>& rft,
+                                    RestartValue         value,
+                                    const bool           write_double)
+{
+    const auto& ioConfig = this->es.cfg().io();
+
+    const bool final_step { report_step == static_cast<int>(sched.size()) - 1 };
+    const bool is_final_summary = final_step && !isSubstep;
+
+    if (writeSummary) {
+        this->summary.add_timestep(st, report_step, isSubstep);
+        this->summary.write(is_final_summary);
+    }
+
+    if (final_step && !isSubstep && this->summaryConfig.createRunSummary()) {
+        std::filesystem::path outputDir { this->outputDir } ;
+        std::filesystem::path outputFile { outputDir / this->baseName } ;
+        EclIO::ESmry(outputFile).write_rsm_file();
+    }
+
+    // RFT file written only if requested and never for substeps.
+    if (const auto& [wantRFT, haveExistingRFT] = rft; wantRFT)
+    {
+        // Open existing RFT file if report step is after first RFT event.
+        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
+            haveExistingRFT
+        };
+
+        EclIO::OutputStream::RFT rftFile {
+            EclIO::OutputStream::ResultSet { this->outputDir,
+                                             this->baseName },
+            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
+            openExisting
+        };
+
+        RftIO::write(report_step, secs_elapsed, this->es.getUnits(),
+                     this->grid, sched, value.wells, rftFile);
+    }
+
+    /*
+      Current implementation will not write restart files for substep,
+      but there is an unsupported option to the RPTSCHED keyword which
+      will request restart output from every timestep.
+    */
+    if(!isSubstep && sched.write_rst_file(report_step))
+    {
+        auto rstFile = this->openRestartFile(report_step);
+
+        RestartIO::save(rstFile, report_step, secs_elapsed, std::move(value),
+                        this->es, this->grid, sched, action_state,
+                        wtest_state, st, udq_state, this->aquiferData,
+                        write_double);
+
+        rstFile.finish();
+    }
+}
+
+void EclipseIO::Impl::writeInitialFiles(const Schedule&                         sched,
+                                        data::Solution                          simProps,
+                                        std::map<std::string, std::vector<int>> int_data,
+                                        const std::vector<NNCdata>&             nnc)
+{
+    const IOConfig& ioConfig = this->es.cfg().io();
+
+    simProps.convertFromSI( this->es.getUnits() );
+    if( ioConfig.getWriteINITFile() )
+        this->writeINITFile( sched, simProps , std::move(int_data), nnc );
+
+    if( ioConfig.getWriteEGRIDFile( ) )
+        this->writeEGRIDFile( nnc );
+}
+
+void EclipseIO::Impl::enableAsyncOutput(const std::size_t maxPendingTasks)
+{
+    if (this->outputThread_ != nullptr) {
+        this->outputThread_->flush();
+    }
+
+    this->outputThread_ = std::make_unique<OutputThread>(maxPendingTasks);
+    this->scheduleSnapshot_.reset();
+}
+
+void EclipseIO::Impl::pushOutputTask(OutputThread::Task task)
+{
+    this->outputThread_->push(std::move(task));
+}
+
+void EclipseIO::Impl::flushOutput()
+{
+    if (this->outputThread_ != nullptr) {
+        this->outputThread_->flush();
+    }
+}
+
+void EclipseIO::Impl::logOutputMessages()
+{
+    if (this->outputThread_ != nullptr) {
+        this->outputThread_->logMessages();
+    }
+}
+
+std::shared_ptr<const Schedule> EclipseIO::Impl::scheduleSnapshot()
+{
+    if (this->scheduleSnapshot_ == nullptr) {
+        this->scheduleSnapshot_ = std::make_shared<const Schedule>(this->schedule);
+    }
+
+    return this->scheduleSnapshot_;
+}
+
 bool EclipseIO::Impl::checkAndRecordIfSumthinTriggered(const int    report_step,
                                                        const double secs_elapsed) const
 {
@@ -249,18 +647,20 @@ void EclipseIO::writeInitial( data::Solution simProps, std::map<std::string, std
     if( !this->impl->output_enabled )
         return;
 
-    {
-        const auto& es = this->impl->es;
-        const IOConfig& ioConfig = es.cfg().io();
-
-        simProps.convertFromSI( es.getUnits() );
-        if( ioConfig.getWriteINITFile() )
-            this->impl->writeINITFile( simProps , std::move(int_data), nnc );
-
-        if( ioConfig.getWriteEGRIDFile( ) )
-            this->impl->writeEGRIDFile( nnc );
+    if (! this->impl->asyncOutput()) {
+        this->impl->writeInitialFiles(this->impl->schedule, std::move(simProps),
+                                      std::move(int_data), nnc);
+        return;
     }
 
+    this->impl->pushOutputTask([impl = this->impl.get(),
+                                sched = this->impl->scheduleSnapshot(),
+                                simProps = std::move(simProps),
+                                int_data = std::move(int_data),
+                                nnc]() mutable
+    {
+        impl->writeInitialFiles(*sched, std::move(simProps), std::move(int_data), nnc);
+    });
 }
 
 // implementation of the writeTimeStep method
@@ -278,71 +678,48 @@ void EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    const auto& es = this->impl->es;
     const auto& grid = this->impl->grid;
     const auto& schedule = this->impl->schedule;
-    const auto& ioConfig = es.cfg().io();
 
-    const bool final_step { report_step == static_cast<int>(schedule.size()) - 1 };
-    const bool is_final_summary = final_step && !isSubstep;
+    this->impl->logOutputMessages();
 
-    if ((report_step > 0) &&
-        this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed))
-    {
-        this->impl->summary.add_timestep(st, report_step, isSubstep);
-        this->impl->summary.write(is_final_summary);
+    const bool writeSummary = (report_step > 0)
+        && this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed);
 
+    if (writeSummary) {
         this->impl->recordSummaryOutput(secs_elapsed);
     }
 
+    const auto rft = this->impl->wantRFTOutput(report_step, isSubstep);
 
-    if (final_step && !isSubstep && this->impl->summaryConfig.createRunSummary()) {
-        std::filesystem::path outputDir { this->impl->outputDir } ;
-        std::filesystem::path outputFile { outputDir / this->impl->baseName } ;
-        EclIO::ESmry(outputFile).write_rsm_file();
-    }
+    const bool writeFiles = writeSummary
+        || (report_step == static_cast<int>(schedule.size()) - 1)
+        || (!isSubstep && schedule.write_rst_file(report_step))
+        || rft.first;
 
-    /*
-      Current implementation will not write restart files for substep,
-      but there is an unsupported option to the RPTSCHED keyword which
-      will request restart output from every timestep.
-    */
-    if(!isSubstep && schedule.write_rst_file(report_step))
-    {
-        EclIO::OutputStream::Restart rstFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            report_step,
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            EclIO::OutputStream::Unified   { ioConfig.getUNIFOUT() }
-        };
-
-        RestartIO::save(rstFile, report_step, secs_elapsed, value,
-                        es, grid, schedule, action_state, wtest_state, st,
-                        udq_state, this->impl->aquiferData, write_double);
+    if (writeFiles && !this->impl->asyncOutput()) {
+        this->impl->writeTimeStep(schedule, action_state, wtest_state, st, udq_state,
+                                  report_step, isSubstep, secs_elapsed,
+                                  writeSummary, rft, std::move(value), write_double);
     }
-
-    // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        // Open existing RFT file if report step is after first RFT event.
-        const auto openExisting = EclIO::OutputStream::RFT::OpenExisting {
-            haveExistingRFT
-        };
-
-        EclIO::OutputStream::RFT rftFile {
-            EclIO::OutputStream::ResultSet { this->impl->outputDir,
-                                             this->impl->baseName },
-            EclIO::OutputStream::Formatted { ioConfig.getFMTOUT() },
-            openExisting
-        };
-
-        RftIO::write(report_step, secs_elapsed, es.getUnits(),
-                     grid, schedule, value.wells, rftFile);
+    else if (writeFiles) {
+        // The output task owns copies of the dynamic state objects since
+        // the caller is free to update them once we return.  The Schedule
+        // is only copied again after scheduleChanged().
+        this->impl->pushOutputTask([impl = this->impl.get(),
+                                    sched = this->impl->scheduleSnapshot(),
+                                    action_state, wtest_state, st, udq_state,
+                                    report_step, isSubstep, secs_elapsed,
+                                    writeSummary, rft, write_double,
+                                    value = std::move(value)]() mutable
+        {
+            impl->writeTimeStep(*sched, action_state, wtest_state, st, udq_state,
+                                report_step, isSubstep, secs_elapsed,
+                                writeSummary, rft, std::move(value), write_double);
+        });
     }
 
+    // Reports go to the log and are generated on the calling thread.
     if (!isSubstep) {
         for (const auto& report : schedule[report_step].rpt_config.get()) {
             std::stringstream ss;
@@ -369,6 +746,8 @@ RestartValue EclipseIO::loadRestart(Action::State& action_state, SummaryState& s
                                                                         report_step,
                                                                         false );
 
+    this->impl->flushOutput();
+
     return RestartIO::load(filename, report_step, action_state, summary_state, solution_keys,
                            es, grid, schedule, extra_keys);
 }
@@ -378,9 +757,10 @@ EclipseIO::EclipseIO( const EclipseState& es,
                       const Schedule& schedule,
                       const SummaryConfig& summary_config,
                       const std::string& baseName,
-                      const bool writeEsmry
+                      const bool writeEsmry,
+                      const bool writeCsmry
                     )
-    : impl( new Impl( es, std::move( grid ), schedule , summary_config, baseName, writeEsmry) )
+    : impl( new Impl( es, std::move( grid ), schedule , summary_config, baseName, writeEsmry, writeCsmry) )
 {
     if( !this->impl->output_enabled )
         return;
@@ -389,9 +769,23 @@ EclipseIO::EclipseIO( const EclipseState& es,
 }
 
 const out::Summary& EclipseIO::summary() {
+    this->impl->flushOutput();
+
     return this->impl->summary;
 }
 
+void EclipseIO::enableAsyncOutput(const std::size_t maxPendingSteps) {
+    this->impl->enableAsyncOutput(maxPendingSteps);
+}
+
+void EclipseIO::flushOutput() {
+    this->impl->flushOutput();
+}
+
+void EclipseIO::scheduleChanged() {
+    this->impl->scheduleChanged();
+}
+
 
 EclipseIO::~EclipseIO() {}
 
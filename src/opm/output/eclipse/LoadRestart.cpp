@@ -717,6 +717,27 @@ namespace {
         return sol;
     }
 
+    // Names of the restart file vectors which may be needed to restore
+    // the solution and extra keys.  Loaded together, before other vectors.
+    std::vector<std::string>
+    requestedVectors(const std::vector<Opm::RestartKey>& solution_keys,
+                     const std::vector<Opm::RestartKey>& extra_keys)
+    {
+        auto vectors = std::vector<std::string>{};
+
+        for (const auto* keys : { &solution_keys, &extra_keys }) {
+            for (const auto& value : *keys) {
+                vectors.push_back(value.key);
+            }
+        }
+
+        // Hysteresis vectors are preferably restored from SOMAX and SGMAX.
+        vectors.push_back("SOMAX");
+        vectors.push_back("SGMAX");
+
+        return vectors;
+    }
+
     void restoreExtra(const std::vector<Opm::RestartKey>& extra_keys,
                       const Opm::UnitSystem&              usys,
                       const Opm::EclIO::RestartFileView&  rst_view,
@@ -1664,6 +1685,8 @@ namespace Opm { namespace RestartIO  {
         auto rst_view = std::make_shared<Opm::EclIO::RestartFileView>
             (std::move(rst_file), report_step);
 
+        rst_view->loadKeywords(requestedVectors(solution_keys, extra_keys));
+
         auto xr = restoreSOLUTION(solution_keys,
                                   grid.getNumActive(), *rst_view);
 
@@ -54,6 +54,7 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <opm/io/eclipse/ColumnSmryOutput.hpp>
 #include <opm/io/eclipse/EclUtil.hpp>
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/OutputStream.hpp>
@@ -90,6 +91,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 template <> struct fmt::formatter<Opm::EclIO::SummaryNode::Category>: fmt::formatter<string_view> {
     // parse is inherited from formatter<string_view>.
     template <typename FormatContext>
@@ -508,7 +513,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector< std::pair< std::string, double > > eff_factors;
+    const std::vector< std::pair< std::string, double > >& eff_factors;
     const Opm::Inplace& initial_inplace;
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -571,15 +576,16 @@ measure rate_unit<Opm::data::GuideRateValue::Item::Gas>() { return measure::gas_
 template <> constexpr
 measure rate_unit<Opm::data::GuideRateValue::Item::ResV>() { return measure::rate; }
 
+// The efficiency factors are sorted by well name, see EfficiencyFactor.
 double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name)
 {
-    auto it = std::find_if(eff_factors.begin(), eff_factors.end(),
-        [&name](const std::pair<std::string, double>& elem)
+    auto it = std::lower_bound(eff_factors.begin(), eff_factors.end(), name,
+        [](const std::pair<std::string, double>& elem, const std::string& key)
     {
-        return elem.first == name;
+        return elem.first < key;
     });
 
-    return (it != eff_factors.end()) ? it->second : 1.0;
+    return ((it != eff_factors.end()) && (it->first == name)) ? it->second : 1.0;
 }
 
 inline bool
@@ -2940,6 +2946,9 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 
         this->factors.emplace_back(well->name(), eff_factor);
     }
+
+    // Sorted for lookup by name in efac().
+    std::sort(this->factors.begin(), this->factors.end());
 }
 
 namespace Evaluator {
@@ -2965,16 +2974,72 @@ namespace Evaluator {
         const std::unordered_map<std::string, Opm::data::InterRegFlowMap>& ireg;
     };
 
+    // Summary values computed by the evaluators.  Applied to the
+    // SummaryState in the order they were added, which lets evaluators run
+    // concurrently while reading the SummaryState of the previous step.
+    class ValueBuffer
+    {
+    public:
+        void add(const Opm::EclIO::SummaryNode& node, const double value)
+        {
+            this->values_.push_back({ &node, std::string{}, value });
+        }
+
+        void add(std::string key, const double value)
+        {
+            this->values_.push_back({ nullptr, std::move(key), value });
+        }
+
+        void apply(Opm::SummaryState& st)
+        {
+            for (const auto& value : this->values_) {
+                if (value.node != nullptr) {
+                    updateValue(*value.node, value.value, st);
+                }
+                else {
+                    st.update(value.key, value.value);
+                }
+            }
+
+            this->values_.clear();
+        }
+
+    private:
+        struct Value
+        {
+            const Opm::EclIO::SummaryNode* node;
+            std::string key;
+            double value;
+        };
+
+        std::vector<Value> values_{};
+    };
+
     class Base
     {
     public:
         virtual ~Base() {}
 
+        // Whether update() reads values which other evaluators compute
+        // in the same step.  Such evaluators run after all others.
+        virtual bool readsCurrentValues() const
+        {
+            return false;
+        }
+
+        // Resolve the parts of the evaluation which only depend on the
+        // schedule at sim_step.  Called before update() whenever the
+        // report step, or the wells and groups in it, change.
+        virtual void prepare(const std::size_t /* sim_step */,
+                             const InputData&  /* input */)
+        {}
+
         virtual void update(const std::size_t       sim_step,
                             const double            stepSize,
                             const InputData&        input,
                             const SimulatorResults& simRes,
-                            Opm::SummaryState&      st) const = 0;
+                            const Opm::SummaryState& st,
+                            ValueBuffer&             values) const = 0;
     };
 
     class FunctionRelation : public Base
@@ -2983,34 +3048,48 @@ namespace Evaluator {
         explicit FunctionRelation(Opm::EclIO::SummaryNode node, ofun fcn)
             : node_(std::move(node))
             , fcn_ (std::move(fcn))
+            , need_wells_(need_wells(this->node_))
+            , group_name_(this->group_name())
         {
             if (this->use_number()) {
                 this->number_ = std::max(0, this->node_.number);
             }
         }
 
-        void update(const std::size_t       sim_step,
-                    const double            stepSize,
-                    const InputData&        input,
-                    const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+        bool readsCurrentValues() const override
+        {
+            // ROEW is derived from the COPT values of the same step.
+            return this->node_.keyword == "ROEW";
+        }
+
+        void prepare(const std::size_t sim_step,
+                     const InputData&  input) override
         {
-            const auto wells = need_wells(this->node_)
+            this->wells_ = this->need_wells_
                 ? find_wells(input.sched, this->node_,
                              static_cast<int>(sim_step), input.reg)
                 : std::vector<const Opm::Well*>{};
 
             EfficiencyFactor efac{};
-            efac.setFactors(this->node_, input.sched, wells, sim_step);
+            efac.setFactors(this->node_, input.sched, this->wells_, sim_step);
+            this->eff_factors_ = std::move(efac.factors);
+        }
 
+        void update(const std::size_t       sim_step,
+                    const double            stepSize,
+                    const InputData&        input,
+                    const SimulatorResults& simRes,
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
+        {
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                this->wells_, this->group_name_, this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number_, this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(efac.factors),
+                this->eff_factors_,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits()
             };
@@ -3018,14 +3097,20 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            values.add(this->node_, usys.from_si(prm.unit, prm.value));
         }
 
     private:
         Opm::EclIO::SummaryNode node_;
         ofun                    fcn_;
+        bool                    need_wells_{false};
+        std::string             group_name_{};
         int                     number_{0};
 
+        // Resolved by prepare().
+        std::vector<const Opm::Well*> wells_{};
+        EfficiencyFactor::FacColl     eff_factors_{};
+
         std::string group_name() const
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
@@ -3064,7 +3149,8 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             values) const override
         {
             auto xPos = simRes.block.find(this->lookupKey());
             if (xPos == simRes.block.end()) {
@@ -3072,7 +3158,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            values.add(this->node_, usys.from_si(this->m_, xPos->second));
         }
 
     private:
@@ -3098,7 +3184,8 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             values) const override
         {
             auto xPos = simRes.aquifers.find(this->node_.number);
             if (xPos == simRes.aquifers.end()) {
@@ -3106,7 +3193,7 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            values.add(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)));
         }
     private:
         Opm::EclIO::SummaryNode  node_;
@@ -3126,7 +3213,8 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             values) const override
         {
             if (this->node_.number < 0)
                 return;
@@ -3142,7 +3230,7 @@ namespace Evaluator {
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            values.add(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3173,7 +3261,8 @@ namespace Evaluator {
                     const double            stepSize,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             values) const override
         {
             if (this->component_ == Component::NumComponents) {
                 return;
@@ -3192,7 +3281,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            values.add(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3361,7 +3450,8 @@ namespace Evaluator {
                     const double         /* stepSize */,
                     const InputData&        input,
                     const SimulatorResults& simRes,
-                    Opm::SummaryState&      st) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             values) const override
         {
             auto xPos = simRes.single.find(this->node_.keyword);
             if (xPos == simRes.single.end())
@@ -3370,7 +3460,7 @@ namespace Evaluator {
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            values.add(this->node_, usys.from_si(this->m_, val));
         }
 
     private:
@@ -3385,10 +3475,17 @@ namespace Evaluator {
                     const double            /* stepSize */,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&      /* st */) const override
+                    const Opm::SummaryState& /* st */,
+                    ValueBuffer&             /* values */) const override
         {
             // No-op
         }
+
+        bool readsCurrentValues() const override
+        {
+            // UDQs are defined in terms of the other summary vectors.
+            return true;
+        }
     };
 
     class Time : public Base
@@ -3402,15 +3499,16 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
         {
             const auto& usys = input.es.getUnits();
 
             const auto m   = ::Opm::UnitSystem::measure::time;
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, usys.from_si(m, val));
-            st.update("TIME", usys.from_si(m, val));
+            values.add(this->saveKey_, usys.from_si(m, val));
+            values.add("TIME", usys.from_si(m, val));
         }
 
     private:
@@ -3428,10 +3526,11 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.day());
+            values.add(this->saveKey_, sim_time.day());
         }
 
     private:
@@ -3449,10 +3548,11 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.month());
+            values.add(this->saveKey_, sim_time.month());
         }
 
     private:
@@ -3470,10 +3570,11 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&           input,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
         {
             auto sim_time = make_sim_time(input.sched, st, stepSize);
-            st.update(this->saveKey_, sim_time.year());
+            values.add(this->saveKey_, sim_time.year());
         }
 
     private:
@@ -3491,13 +3592,14 @@ namespace Evaluator {
                     const double               stepSize,
                     const InputData&        /* input */,
                     const SimulatorResults& /* simRes */,
-                    Opm::SummaryState&         st) const override
+                    const Opm::SummaryState& st,
+                    ValueBuffer&             values) const override
         {
             using namespace ::Opm::unit;
 
             const auto val = st.get_elapsed() + stepSize;
 
-            st.update(this->saveKey_, convert::to(val, ecl_year));
+            values.add(this->saveKey_, convert::to(val, ecl_year));
         }
 
     private:
@@ -4087,7 +4189,8 @@ public:
                                    const EclipseGrid&   grid,
                                    const Schedule&      sched,
                                    const std::string&   basename,
-                                   const bool           writeEsmry);
+                                   const bool           writeEsmry,
+                                   const bool           writeCsmry);
 
     SummaryImplementation(const SummaryImplementation& rhs) = delete;
     SummaryImplementation(SummaryImplementation&& rhs) = default;
@@ -4111,6 +4214,16 @@ public:
     void internal_store(const SummaryState& st, const int report_step, bool isSubstep);
     void write(const bool is_final_summary);
 
+    void setMinEvaluatorsPerRange(const std::size_t count)
+    {
+        this->minEvaluatorsPerRange_ = std::max(count, std::size_t{1});
+    }
+
+    std::size_t numEvaluationRanges() const
+    {
+        return this->numEvaluationRanges_;
+    }
+
 private:
     struct MiniStep
     {
@@ -4136,6 +4249,27 @@ private:
     mutable int miniStepID_{0};
     mutable double prevEvalTime_{std::numeric_limits<double>::lowest()};
 
+    // Report step and schedule objects the evaluators were last prepared
+    // for.  Wells and groups are replaced, not modified, when their
+    // structure or efficiency factors change, e.g. by an ACTIONX.  Holding
+    // on to the prepared objects keeps their addresses from being reused
+    // by replacements, so comparing the pointers detects when the prepared
+    // well sets are stale.  This also keeps the wells the evaluators refer
+    // to alive until they are prepared again.
+    mutable int preparedStep_{-1};
+    mutable std::vector<std::shared_ptr<const void>> preparedObjects_{};
+
+    // All evaluators in evaluation order, split into those which only read
+    // values of previous steps and may run concurrently, and those which
+    // read values computed in the same step and run afterwards.
+    std::vector<const Evaluator::Base*> concurrentEvaluators_{};
+    std::vector<const Evaluator::Base*> sequentialEvaluators_{};
+
+    // Smallest number of concurrent evaluators per thread, and the number
+    // of ranges used by the last evaluation.
+    std::size_t minEvaluatorsPerRange_{512};
+    mutable std::size_t numEvaluationRanges_{0};
+
     int prevCreate_{-1};
     int prevReportStepID_{-1};
     std::vector<MiniStep>::size_type numUnwritten_{0};
@@ -4150,6 +4284,7 @@ private:
     std::unique_ptr<Opm::EclIO::EclOutput> stream_{};
 
     std::unique_ptr<Opm::EclIO::ExtSmryOutput> esmry_;
+    std::unique_ptr<Opm::EclIO::ColumnSmryOutput> csmry_;
 
     void configureTimeVector(const EclipseState& es, const std::string& kw);
     void configureTimeVectors(const EclipseState& es, const SummaryConfig& sumcfg);
@@ -4169,6 +4304,14 @@ private:
 
     void write(const MiniStep& ms);
 
+    void prepareEvaluators(const int sim_step, const Evaluator::InputData& input) const;
+    void partitionEvaluators();
+    void evaluate(const int                           sim_step,
+                  const double                        duration,
+                  const Evaluator::InputData&         input,
+                  const Evaluator::SimulatorResults&  simRes,
+                  SummaryState&                       st) const;
+
     void createSMSpecIfNecessary();
     void createSmryStreamIfNecessary(const int report_step);
 };
@@ -4179,7 +4322,8 @@ SummaryImplementation(const EclipseState&  es,
                       const EclipseGrid&   grid,
                       const Schedule&      sched,
                       const std::string&   basename,
-                      const bool           writeEsmry)
+                      const bool           writeEsmry,
+                      const bool           writeCsmry)
     : grid_          (std::cref(grid))
     , es_            (std::cref(es))
     , sched_         (std::cref(sched))
@@ -4202,6 +4346,7 @@ SummaryImplementation(const EclipseState&  es,
     this->configureRequiredRestartParameters(sumcfg, es.aquifer(),
                                              sched, evaluatorFactory);
     this->configureUDQ(es, sumcfg, sched);
+    this->partitionEvaluators();
 
     std::string esmryFileName = EclIO::OutputStream::outputFileName(this->rset_, "ESMRY");
 
@@ -4213,6 +4358,24 @@ SummaryImplementation(const EclipseState&  es,
 
     if ((writeEsmry) and (es.cfg().io().getFMTOUT()))
         OpmLog::warning("ESMRY only supported for unformatted output.  Request ignored.");
+
+    const auto csmryFileName = EclIO::OutputStream::outputFileName(this->rset_, "CSMRY");
+
+    if (std::filesystem::exists(csmryFileName))
+        std::filesystem::remove(csmryFileName);
+
+    if (writeCsmry) {
+        const auto start = TimeStampUTC { sched.getStartTime() };
+        const auto startDate = std::vector<int> {
+            start.day(), start.month(), start.year(),
+            start.hour(), start.minutes(), start.seconds(), 0
+        };
+
+        this->csmry_ = std::make_unique<Opm::EclIO::ColumnSmryOutput>
+            (csmryFileName,
+             Opm::EclIO::ExtSmryOutput::make_modified_keys(this->valueKeys_, es.gridDims()),
+             this->valueUnits_, startDate);
+    }
 }
 
 void Opm::out::Summary::SummaryImplementation::
@@ -4263,20 +4426,124 @@ eval(const int                              sim_step,
         region_values, block_values, aquifer_values, interreg_flows
     };
 
+    this->prepareEvaluators(sim_step, input);
+    this->evaluate(sim_step, duration, input, simRes, st);
+
+    st.update_elapsed(duration);
+
+    if (secs_elapsed > this->prevEvalTime_) {
+        this->prevEvalTime_ = secs_elapsed;
+        ++this->miniStepID_;
+    }
+}
+
+void Opm::out::Summary::SummaryImplementation::
+prepareEvaluators(const int sim_step, const Evaluator::InputData& input) const
+{
+    const auto& schedState = this->sched_.get()[sim_step];
+
+    auto objects = std::vector<std::shared_ptr<const void>>{};
+    for (const auto& [_, well] : schedState.wells) {
+        (void)_;
+        objects.push_back(well);
+    }
+    for (const auto& [_, group] : schedState.groups) {
+        (void)_;
+        objects.push_back(group);
+    }
+
+    if ((sim_step == this->preparedStep_) && (objects == this->preparedObjects_)) {
+        return;
+    }
+
     for (auto& evalPtr : this->outputParameters_.getEvaluators()) {
-        evalPtr->update(sim_step, duration, input, simRes, st);
+        evalPtr->prepare(sim_step, input);
     }
 
     for (auto& [_, evalPtr] : this->extra_parameters) {
         (void)_;
-        evalPtr->update(sim_step, duration, input, simRes, st);
+        evalPtr->prepare(sim_step, input);
     }
 
-    st.update_elapsed(duration);
+    this->preparedStep_ = sim_step;
+    this->preparedObjects_ = std::move(objects);
+}
 
-    if (secs_elapsed > this->prevEvalTime_) {
-        this->prevEvalTime_ = secs_elapsed;
-        ++this->miniStepID_;
+void Opm::out::Summary::SummaryImplementation::partitionEvaluators()
+{
+    auto add = [this](const EvalPtr& evalPtr)
+    {
+        auto& evaluators = evalPtr->readsCurrentValues()
+            ? this->sequentialEvaluators_
+            : this->concurrentEvaluators_;
+
+        evaluators.push_back(evalPtr.get());
+    };
+
+    for (const auto& evalPtr : this->outputParameters_.getEvaluators()) {
+        add(evalPtr);
+    }
+
+    for (const auto& [_, evalPtr] : this->extra_parameters) {
+        (void)_;
+        add(evalPtr);
+    }
+}
+
+void Opm::out::Summary::SummaryImplementation::
+evaluate(const int                           sim_step,
+         const double                        duration,
+         const Evaluator::InputData&         input,
+         const Evaluator::SimulatorResults&  simRes,
+         SummaryState&                       st) const
+{
+    // Each thread evaluates a contiguous range of evaluators into its own
+    // buffer.  The buffers are applied in range order, so the SummaryState
+    // is updated in the same order as a sequential evaluation.
+    const auto numEvaluators = this->concurrentEvaluators_.size();
+    auto numRanges = std::size_t{1};
+#ifdef _OPENMP
+    numRanges = std::clamp(numEvaluators / this->minEvaluatorsPerRange_,
+                           std::size_t{1},
+                           static_cast<std::size_t>(omp_get_max_threads()));
+#endif
+    this->numEvaluationRanges_ = numRanges;
+
+    std::vector<Evaluator::ValueBuffer> buffers(numRanges);
+    std::vector<std::exception_ptr> failures(numRanges);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (numRanges > 1)
+#endif
+    for (int range = 0; range < static_cast<int>(numRanges); ++range) {
+        const auto begin = numEvaluators * range / numRanges;
+        const auto end = numEvaluators * (range + 1) / numRanges;
+
+        try {
+            for (auto i = begin; i < end; ++i) {
+                this->concurrentEvaluators_[i]->update(sim_step, duration, input,
+                                                       simRes, st, buffers[range]);
+            }
+        }
+        catch (...) {
+            failures[range] = std::current_exception();
+        }
+    }
+
+    for (const auto& failure : failures) {
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+    }
+
+    for (auto& buffer : buffers) {
+        buffer.apply(st);
+    }
+
+    auto& buffer = buffers.front();
+    for (const auto* evaluator : this->sequentialEvaluators_) {
+        evaluator->update(sim_step, duration, input, simRes, st, buffer);
+        buffer.apply(st);
     }
 }
 
@@ -4307,6 +4574,16 @@ void Opm::out::Summary::SummaryImplementation::write(const bool is_final_summary
         }
     }
 
+    // Time steps are written in chunks as they accumulate, the last
+    // partial chunk is written at the end of the run.
+    if (this->csmry_ != nullptr) {
+        for (auto i = 0*this->numUnwritten_; i < this->numUnwritten_; ++i)
+            this->csmry_->write(this->unwritten_[i].params, !this->unwritten_[i].isSubstep);
+
+        if (is_final_summary)
+            this->csmry_->flush();
+    }
+
     // Reset "unwritten" counter to reflect the fact that we've
     // output all stored ministeps.
     this->numUnwritten_ = zero;
@@ -4716,8 +4993,9 @@ Summary::Summary(const EclipseState&  es,
                  const EclipseGrid&   grid,
                  const Schedule&      sched,
                  const std::string&   basename,
-                 const bool           writeEsmry)
-    : pImpl_ { std::make_unique<SummaryImplementation>(es, sumcfg, grid, sched, basename, writeEsmry) }
+                 const bool           writeEsmry,
+                 const bool           writeCsmry)
+    : pImpl_ { std::make_unique<SummaryImplementation>(es, sumcfg, grid, sched, basename, writeEsmry, writeCsmry) }
 {}
 
 void Summary::eval(SummaryState&                          st,
@@ -4765,6 +5043,16 @@ void Summary::write(const bool is_final_summary) const
     this->pImpl_->write(is_final_summary);
 }
 
+void Summary::setMinEvaluatorsPerRange(const std::size_t count)
+{
+    this->pImpl_->setMinEvaluatorsPerRange(count);
+}
+
+std::size_t Summary::numEvaluationRanges() const
+{
+    return this->pImpl_->numEvaluationRanges();
+}
+
 Summary::~Summary() {}
 
 }} // namespace Opm::out
@@ -4,6 +4,7 @@
 #include <tuple>
 #include <getopt.h>
 #include <filesystem>
+#include <memory>
 
 #include <opm/io/eclipse/EclFile.hpp>
 #include <opm/io/eclipse/ERst.hpp>
@@ -116,13 +117,16 @@ void writeArrayList(std::vector<EclEntry>& arrayList, ERst file1, int reportStep
 static void printHelp() {
 
     std::cout << "\nconvertECL needs one argument which is the input file to be converted. If this is a binary file the output file will be formatted. If the input file is formatted the output will be binary. \n"
+              << "A compressed binary file is converted to a standard binary file, which needs an output file name (option -o).\n"
               << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
               << "-h Print help and exit.\n"
               << "-l List report step numbers in the selected restart file.\n"
               << "-g Convert file to grdecl format.\n"
-              << "-o Specify output file name (only valid with grdecl option).\n"
+              << "-o Specify output file name (only valid with grdecl option, option -z or compressed input).\n"
               << "-i Enforce IX standard on output file.\n"
-              << "-r Extract and convert a specific report time step number from a unified restart file. \n\n";
+              << "-r Extract and convert a specific report time step number from a unified restart file. \n"
+              << "-z Convert file to compressed binary file. Output file name must be given with option -o\n"
+              << "   if input file is binary.\n\n";
 }
 
 
@@ -219,6 +223,7 @@ int main(int argc, char **argv) {
     bool listProperties            = false;
     bool enforce_ix_output         = false;
     bool to_grdecl                 = false;
+    bool to_compressed             = false;
 
     std::map<std::string, std::string> to_formatted = {{".EGRID", ".FEGRID"}, {".INIT", ".FINIT"}, {".SMSPEC", ".FSMSPEC"},
         {".UNSMRY", ".FUNSMRY"}, {".UNRST", ".FUNRST"}, {".RFT", ".FRFT"}, {".ESMRY", ".FESMRY"}};
@@ -230,7 +235,7 @@ int main(int argc, char **argv) {
     std::string output_fname;
 
 
-    while ((c = getopt(argc, argv, "hr:ligo:")) != -1) {
+    while ((c = getopt(argc, argv, "hr:ligo:z")) != -1) {
         switch (c) {
         case 'h':
             printHelp();
@@ -251,6 +256,9 @@ int main(int argc, char **argv) {
         case 'o':
             output_fname = optarg;
             break;
+        case 'z':
+            to_compressed=true;
+            break;
         default:
             return EXIT_FAILURE;
         }
@@ -258,17 +266,25 @@ int main(int argc, char **argv) {
 
     int argOffset = optind;
 
-    if ((!output_fname.empty()) && (!to_grdecl)){
-        std::cout << "\n!Error, option -o only valid whit option -g \n\n";
-        exit(1);
-    }
-
     // start reading
     auto start = std::chrono::system_clock::now();
     std::string filename = argv[argOffset];
 
     EclFile file1(filename);
-    bool formattedOutput = file1.formattedInput() ? false : true;
+
+    // binary to binary conversion, either to or from compressed format
+    const bool binaryToBinary = !file1.formattedInput() && (to_compressed || file1.compressedInput());
+    const bool formattedOutput = !file1.formattedInput() && !binaryToBinary;
+
+    if ((!output_fname.empty()) && (!to_grdecl) && (!binaryToBinary) && (!to_compressed)){
+        std::cout << "\n!Error, option -o only valid whit option -g, option -z or compressed input file \n\n";
+        exit(1);
+    }
+
+    if (binaryToBinary && output_fname.empty()) {
+        std::cout << "\n!Error, output file name (option -o) needed when converting between binary and compressed binary file \n\n";
+        exit(1);
+    }
 
     int p = filename.find_last_of(".");
     int l = filename.length();
@@ -352,7 +368,9 @@ int main(int argc, char **argv) {
         return 0;
     }
 
-    if (formattedOutput) {
+    if (!output_fname.empty()) {
+        resFile = output_fname;
+    } else if (formattedOutput) {
 
         auto search = to_formatted.find(extension);
 
@@ -384,7 +402,14 @@ int main(int argc, char **argv) {
 
     std::cout << "\033[1;31m" << "\nconverting  " << argv[argOffset] << " -> " << resFile << "\033[0m\n" << std::endl;
 
-    EclOutput outFile(resFile, formattedOutput);
+    std::unique_ptr<EclOutput> outFilePtr;
+
+    if (to_compressed)
+        outFilePtr = std::make_unique<EclOutput>(resFile, EclOutput::Compressed{true});
+    else
+        outFilePtr = std::make_unique<EclOutput>(resFile, formattedOutput);
+
+    EclOutput& outFile = *outFilePtr;
 
     if ((file1.is_ix()) || (enforce_ix_output)) {
         std::cout << "setting IX flag on output file \n";
@@ -0,0 +1,116 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc checkTabulatedSolubility
+ */
+#ifndef OPM_CHECK_SOLUBILITY_TABLE_HPP
+#define OPM_CHECK_SOLUBILITY_TABLE_HPP
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/SolubilityTable.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/*!
+ * \brief Compares the pre-tabulated gas dissolution factor of a brine PVT
+ *        class against the solubility model.
+ *
+ * Within the range of the table, the values must agree to within the error
+ * bound of the table. Outside of it, the model must be used unchanged. If
+ * enableSaltConcentration is true, the salt concentration is taken from the
+ * fluid state and the table is interpolated along the salinity axis as well.
+ */
+template <class BrinePvt>
+void checkTabulatedSolubility(bool enableSaltConcentration)
+{
+    using Scalar = double;
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 3>;
+    using H2O = typename BrinePvt::H2O;
+
+    const std::vector<Scalar> salinity{0.1};
+    BrinePvt modelPvt(salinity);
+    BrinePvt tablePvt(salinity);
+    modelPvt.setEnableSaltConcentration(enableSaltConcentration);
+    tablePvt.setEnableSaltConcentration(enableSaltConcentration);
+
+    Opm::SolubilityTableParameters<Scalar> params;
+    params.minTemperature = 300.0;
+    params.maxTemperature = 400.0;
+    params.minPressure = 5e6;
+    params.maxPressure = 4e7;
+    params.maxSalinity = 0.2;
+    params.maxSamples = 65;
+    params.maxSalinitySamples = 17;
+
+    const auto reports = tablePvt.tabulateSolubility(params);
+    BOOST_REQUIRE_EQUAL(reports.size(), 1u);
+    if (enableSaltConcentration)
+        BOOST_CHECK_GT(reports[0].numSalinities, 1u);
+    else
+        BOOST_CHECK_EQUAL(reports[0].numSalinities, 1u);
+    BOOST_CHECK_GT(reports[0].acceptedFraction, 0.5);
+    BOOST_CHECK_LE(reports[0].maxRelativeError, params.tolerance);
+
+    // salt concentrations [kg/m^3], the largest ones exceed the salinity range of the table
+    const std::vector<Scalar> saltConcentrations = enableSaltConcentration
+        ? std::vector<Scalar>{0.0, 17.0, 64.0, 121.0, 187.0, 240.0}
+        : std::vector<Scalar>{0.0};
+
+    for (const Scalar c : saltConcentrations) {
+        for (Scalar T = 295.0; T <= 405.0; T += 3.7) {
+            for (Scalar p = 4e6; p <= 4.1e7; p += 1.3e6) {
+                const Eval temperature = Eval::createVariable(T, 1);
+                const Eval pressure = Eval::createVariable(p, 0);
+                const Eval saltConcentration = Eval::createVariable(c, 2);
+                const Eval rsModel = modelPvt.saturatedGasDissolutionFactor(0u, temperature, pressure, saltConcentration);
+                const Eval rsTable = tablePvt.saturatedGasDissolutionFactor(0u, temperature, pressure, saltConcentration);
+
+                const Scalar S = enableSaltConcentration
+                    ? c/H2O::liquidDensity(T, p, true)
+                    : salinity[0];
+                const bool inRange =
+                    params.minTemperature <= T && T <= params.maxTemperature &&
+                    params.minPressure <= p && p <= params.maxPressure &&
+                    (!enableSaltConcentration || S <= params.maxSalinity);
+                if (inRange) {
+                    // the error bound is checked at the cell centres only
+                    const Scalar bound = 2*std::max(params.tolerance*std::abs(rsModel.value()),
+                                                    params.absoluteTolerance);
+                    BOOST_CHECK_LE(std::abs(rsTable.value() - rsModel.value()), bound);
+                }
+                else {
+                    BOOST_CHECK_EQUAL(rsTable.value(), rsModel.value());
+                    BOOST_CHECK_EQUAL(rsTable.derivative(0), rsModel.derivative(0));
+                    BOOST_CHECK_EQUAL(rsTable.derivative(2), rsModel.derivative(2));
+                }
+            }
+        }
+    }
+}
+
+#endif
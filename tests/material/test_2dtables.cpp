@@ -37,6 +37,8 @@
 #include <opm/material/common/UniformXTabulated2DFunction.hpp>
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/IntervalTabulated2DFunction.hpp>
+#include <opm/material/common/PackedTabulatedFunctions.hpp>
+#include <opm/material/densead/Evaluation.hpp>
 
 #include <memory>
 #include <cmath>
@@ -406,3 +408,80 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(IntervalTabulatedFunction3, Scalar, Types)
     test.compareTableWithAnalyticFn2(xytab, xMin, xMax, m,
                                      yMin, yMax, n, test.testFn3, tolerance);
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(PackedTabulatedFunctions, Scalar, Types)
+{
+    using Eval = Opm::DenseAd::Evaluation<Scalar, 1>;
+    using Fn1D = Opm::Tabulated1DFunction<Scalar>;
+    using Fn2D = Opm::UniformXTabulated2DFunction<Scalar>;
+
+    // tables with irregular sampling points and different sizes, including
+    // tables without interior segments
+    std::vector<Fn1D> fns1D;
+    for (unsigned n : {2, 3, 4, 7, 31}) {
+        std::vector<Scalar> x, y;
+        for (unsigned i = 0; i < n; ++i) {
+            x.push_back(-1.0 + std::pow(Scalar(i), Scalar(1.5)));
+            y.push_back(std::sin(x.back()));
+        }
+        fns1D.emplace_back(x, y);
+    }
+
+    std::vector<Fn2D> fns2D;
+    for (auto policy : {Fn2D::Vertical, Fn2D::LeftExtreme, Fn2D::RightExtreme}) {
+        Fn2D fn(policy);
+        for (unsigned i = 0; i < 9; ++i) {
+            const Scalar x = std::pow(Scalar(i), Scalar(1.3));
+            fn.appendXPos(x);
+            const unsigned n = 2 + (i*5) % 7;
+            for (unsigned j = 0; j < n; ++j) {
+                // the guide of LeftExtreme tables is set by prepending points
+                const unsigned jj = (policy == Fn2D::LeftExtreme) ? n - 1 - j : j;
+                const Scalar y = 0.5*i + std::pow(Scalar(jj), Scalar(1.2));
+                fn.appendSamplePoint(i, y, x*y + std::cos(y));
+            }
+        }
+        fns2D.push_back(fn);
+    }
+
+    const Opm::PackedTabulated1DFunctions<Scalar> packed1D(fns1D);
+    const Opm::PackedUniformXTabulated2DFunctions<Scalar> packed2D(fns2D);
+    BOOST_CHECK_EQUAL(packed1D.size(), fns1D.size());
+    BOOST_CHECK_EQUAL(packed2D.size(), fns2D.size());
+
+    // the packed functions must give exactly the same values and derivatives,
+    // including extrapolation and evaluation at the sampling points
+    std::vector<unsigned> tableIdx;
+    std::vector<Eval> xs, ys;
+    for (unsigned k = 0; k < 400; ++k) {
+        const Scalar v = -3.0 + 0.05*k;
+        for (unsigned t = 0; t < fns1D.size(); ++t) {
+            const Eval x = Eval::createVariable(v, 0);
+            const Eval expected = fns1D[t].eval(x, /*extrapolate=*/true);
+            const Eval actual = packed1D.eval(t, x);
+            BOOST_CHECK_EQUAL(actual.value(), expected.value());
+            BOOST_CHECK_EQUAL(actual.derivative(0), expected.derivative(0));
+        }
+
+        for (unsigned t = 0; t < fns2D.size(); ++t) {
+            for (Scalar w : {-1.0, 0.0, 1.0, 2.25, 4.0, 9.0}) {
+                const Eval x = Eval::createVariable(v + 3.0, 0);
+                const Eval y = w + 0.1*k;
+                const Eval expected = fns2D[t].eval(x, y, /*extrapolate=*/true);
+                const Eval actual = packed2D.eval(t, x, y);
+                BOOST_CHECK_EQUAL(actual.value(), expected.value());
+                BOOST_CHECK_EQUAL(actual.derivative(0), expected.derivative(0));
+
+                tableIdx.push_back(t);
+                xs.push_back(x);
+                ys.push_back(y);
+            }
+        }
+    }
+
+    std::vector<Eval> values(xs.size());
+    packed2D.eval(tableIdx.data(), xs.data(), ys.data(), values.data(), values.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+        BOOST_CHECK_EQUAL(values[i].value(),
+                          fns2D[tableIdx[i]].eval(xs[i], ys[i], /*extrapolate=*/true).value());
+}
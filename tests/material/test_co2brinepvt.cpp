@@ -44,6 +44,7 @@
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
 
 #include <opm/material/densead/Evaluation.hpp>
 #include <opm/material/densead/Math.hpp>
@@ -54,7 +55,12 @@
 #include <opm/input/eclipse/Python/Python.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
+#include "checkSolubilityTable.hpp"
+
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -282,3 +288,13 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+BOOST_AUTO_TEST_CASE(TabulatedSolubility)
+{
+    checkTabulatedSolubility<Opm::BrineCo2Pvt<double>>(/*enableSaltConcentration=*/false);
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedSolubilitySaltConcentration)
+{
+    checkTabulatedSolubility<Opm::BrineCo2Pvt<double>>(/*enableSaltConcentration=*/true);
+}
@@ -39,6 +39,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/material/fluidsystems/BlackOilFluidSystem.hpp>
+#include <opm/material/fluidsystems/BlackOilFluidSystemNonStatic.hpp>
 #include <opm/material/fluidstates/BlackOilFluidState.hpp>
 #include <opm/material/densead/Evaluation.hpp>
 
@@ -726,3 +727,147 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(BlackOil, Evaluation, Types)
     [[maybe_unused]] const auto& oPvt = FluidSystem::oilPvt();
     [[maybe_unused]] const auto& wPvt = FluidSystem::waterPvt();
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(StaticPvtDispatch, Evaluation, Types)
+{
+    // the fluid system with compile-time PVT classes must give the same results
+    // as the one which selects the PVT approach at runtime
+    using Scalar = typename Opm::MathToolbox<Evaluation>::Scalar;
+    using FluidSystem = Opm::BlackOilFluidSystem<double>;
+    using StaticFluidSystem = Opm::BlackOilLiveOilWetGasFluidSystem<double>;
+
+    static_assert(std::is_same_v<StaticFluidSystem::OilPvt, Opm::LiveOilPvt<double>>);
+    static_assert(std::is_same_v<StaticFluidSystem::GasPvt, Opm::WetGasPvt<double>>);
+
+    Opm::Parser parser;
+
+    auto deck = parser.parseString(deckString1);
+    auto python = std::make_shared<Opm::Python>();
+    Opm::EclipseState eclState(deck);
+    Opm::Schedule schedule(deck, eclState, python);
+
+    FluidSystem::initFromState(eclState, schedule);
+    StaticFluidSystem::initFromState(eclState, schedule);
+
+    BOOST_CHECK_EQUAL(StaticFluidSystem::numRegions(), FluidSystem::numRegions());
+
+    Opm::BlackOilFluidState<Scalar, FluidSystem> fluidState;
+    Opm::BlackOilFluidState<Scalar, StaticFluidSystem> staticFluidState;
+    Opm::Valgrind::SetUndefined(fluidState);
+    Opm::Valgrind::SetUndefined(staticFluidState);
+
+    for (unsigned regionIdx = 0; regionIdx < FluidSystem::numRegions(); ++regionIdx) {
+        for (unsigned i = 0; i < 100; ++i) {
+            Scalar p = Scalar(i)/100*350e5 + 100e5;
+
+            for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+                fluidState.setPressure(phaseIdx, p);
+                fluidState.setSaturation(phaseIdx, 1e-3);
+                staticFluidState.setPressure(phaseIdx, p);
+                staticFluidState.setSaturation(phaseIdx, 1e-3);
+            }
+
+            // use undersaturated states to exercise the unsaturated tables as well
+            const Scalar Rs = 0.8*FluidSystem::saturatedDissolutionFactor(fluidState, FluidSystem::oilPhaseIdx, regionIdx);
+            const Scalar Rv = 0.8*FluidSystem::saturatedDissolutionFactor(fluidState, FluidSystem::gasPhaseIdx, regionIdx);
+            fluidState.setRs(Rs);
+            fluidState.setRv(Rv);
+            staticFluidState.setRs(Rs);
+            staticFluidState.setRv(Rv);
+
+            for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(Opm::scalarValue(StaticFluidSystem::density(staticFluidState, phaseIdx, regionIdx)),
+                                  Opm::scalarValue(FluidSystem::density(fluidState, phaseIdx, regionIdx)));
+                BOOST_CHECK_EQUAL(Opm::scalarValue(StaticFluidSystem::viscosity(staticFluidState, phaseIdx, regionIdx)),
+                                  Opm::scalarValue(FluidSystem::viscosity(fluidState, phaseIdx, regionIdx)));
+                BOOST_CHECK_EQUAL(Opm::scalarValue(StaticFluidSystem::inverseFormationVolumeFactor(staticFluidState, phaseIdx, regionIdx)),
+                                  Opm::scalarValue(FluidSystem::inverseFormationVolumeFactor(fluidState, phaseIdx, regionIdx)));
+                BOOST_CHECK_EQUAL(Opm::scalarValue(StaticFluidSystem::saturatedDissolutionFactor(staticFluidState, phaseIdx, regionIdx)),
+                                  Opm::scalarValue(FluidSystem::saturatedDissolutionFactor(fluidState, phaseIdx, regionIdx)));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NonStaticFluidSystem)
+{
+    using FluidSystem = Opm::BlackOilFluidSystem<double>;
+    using NonStaticFluidSystem = Opm::BlackOilFluidSystemNonStatic<double>;
+    using Scalar = double;
+
+    Opm::Parser parser;
+
+    auto deck = parser.parseString(deckString1);
+    auto python = std::make_shared<Opm::Python>();
+    Opm::EclipseState eclState(deck);
+    Opm::Schedule schedule(deck, eclState, python);
+
+    FluidSystem::initFromState(eclState, schedule);
+
+    // one fluid system which is copied from the static one and one which is
+    // initialized on its own
+    const NonStaticFluidSystem copied = FluidSystem::getNonStaticInstance();
+    NonStaticFluidSystem initialized;
+    BOOST_CHECK(!initialized.isInitialized());
+    initialized.initFromState(eclState, schedule);
+
+    for (const NonStaticFluidSystem* fs : {&copied, static_cast<const NonStaticFluidSystem*>(&initialized)}) {
+        BOOST_CHECK(fs->isInitialized());
+        BOOST_CHECK_EQUAL(fs->numRegions(), FluidSystem::numRegions());
+        BOOST_CHECK_EQUAL(fs->numActivePhases(), FluidSystem::numActivePhases());
+        BOOST_CHECK_EQUAL(fs->enableDissolvedGas(), FluidSystem::enableDissolvedGas());
+        BOOST_CHECK_EQUAL(fs->enableVaporizedOil(), FluidSystem::enableVaporizedOil());
+        BOOST_CHECK_EQUAL(fs->reservoirTemperature(), FluidSystem::reservoirTemperature());
+    }
+
+    Opm::BlackOilFluidState<Scalar, FluidSystem> fluidState;
+    // the temperature cannot be taken from the fluid system through static
+    // access here, so the fluid state used with the instance stores it
+    Opm::BlackOilFluidState<Scalar, NonStaticFluidSystem, /*enableTemperature=*/true> nonStaticFluidState;
+    Opm::Valgrind::SetUndefined(fluidState);
+    Opm::Valgrind::SetUndefined(nonStaticFluidState);
+
+    const unsigned regionIdx = 1;
+    for (unsigned i = 0; i < 100; ++i) {
+        Scalar p = Scalar(i)/100*350e5 + 100e5;
+
+        for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+            fluidState.setPressure(phaseIdx, p);
+            fluidState.setSaturation(phaseIdx, 1e-3);
+            nonStaticFluidState.setPressure(phaseIdx, p);
+            nonStaticFluidState.setSaturation(phaseIdx, 1e-3);
+        }
+        nonStaticFluidState.setTemperature(FluidSystem::reservoirTemperature());
+
+        const Scalar Rs = FluidSystem::saturatedDissolutionFactor(fluidState, FluidSystem::oilPhaseIdx, regionIdx);
+        const Scalar Rv = FluidSystem::saturatedDissolutionFactor(fluidState, FluidSystem::gasPhaseIdx, regionIdx);
+        fluidState.setRs(Rs);
+        fluidState.setRv(Rv);
+        nonStaticFluidState.setRs(Rs);
+        nonStaticFluidState.setRv(Rv);
+
+        for (const NonStaticFluidSystem* fs : {&copied, static_cast<const NonStaticFluidSystem*>(&initialized)}) {
+            for (unsigned phaseIdx = 0; phaseIdx < FluidSystem::numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(fs->density(nonStaticFluidState, phaseIdx, regionIdx),
+                                  FluidSystem::density(fluidState, phaseIdx, regionIdx));
+                BOOST_CHECK_EQUAL(fs->viscosity(nonStaticFluidState, phaseIdx, regionIdx),
+                                  FluidSystem::viscosity(fluidState, phaseIdx, regionIdx));
+                BOOST_CHECK_EQUAL(fs->inverseFormationVolumeFactor(nonStaticFluidState, phaseIdx, regionIdx),
+                                  FluidSystem::inverseFormationVolumeFactor(fluidState, phaseIdx, regionIdx));
+            }
+        }
+    }
+
+    // the objects do not depend on the static fluid system after they have been set up
+    const Scalar temperature = FluidSystem::reservoirTemperature();
+    FluidSystem::initBegin(/*numPvtRegions=*/1);
+    FluidSystem::setReservoirTemperature(temperature + 10.0);
+    BOOST_CHECK_EQUAL(copied.reservoirTemperature(), temperature);
+    BOOST_CHECK_EQUAL(copied.numRegions(), 2);
+    BOOST_CHECK_EQUAL(initialized.numRegions(), 2);
+
+    // leave the static fluid system fully initialized for subsequent tests
+    FluidSystem::initFromState(eclState, schedule);
+    BOOST_CHECK(FluidSystem::isInitialized());
+    BOOST_CHECK_EQUAL(FluidSystem::reservoirTemperature(), temperature);
+}
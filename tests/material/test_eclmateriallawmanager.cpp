@@ -939,3 +939,150 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEvaluation, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    constexpr int numPhases = Fixture<Scalar>::numPhases;
+
+    Opm::Parser parser;
+
+    for (const auto* deckString : {hysterDeckString, fam1DeckStringGasOil}) {
+        const auto deck = parser.parseString(deckString);
+        const Opm::EclipseState eclState(deck);
+        const size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager materialLawManager;
+        materialLawManager.initFromState(eclState);
+        materialLawManager.initParamsForElements(eclState, n);
+
+        // every cell several times, in reverse order
+        std::vector<unsigned> elements;
+        std::vector<Scalar> saturations;
+        for (int i = 0; i <= 100; i += 5) {
+            for (unsigned elemIdx = n; elemIdx-- > 0; ) {
+                const Scalar Sw = eclState.runspec().phases().active(Opm::Phase::WATER) ? Scalar(i) / 200 : 0;
+                const Scalar Sg = Scalar(100 - i) / 200;
+                elements.push_back(elemIdx);
+                saturations.push_back(Sw);
+                saturations.push_back(1 - Sw - Sg);
+                saturations.push_back(Sg);
+            }
+        }
+
+        std::vector<Scalar> pcBatch, krBatch;
+        materialLawManager.capillaryPressures(elements, saturations, pcBatch);
+        materialLawManager.relativePermeabilities(elements, saturations, krBatch);
+        BOOST_REQUIRE_EQUAL(pcBatch.size(), saturations.size());
+        BOOST_REQUIRE_EQUAL(krBatch.size(), saturations.size());
+
+        for (size_t i = 0; i < elements.size(); ++i) {
+            typename Fixture<Scalar>::FluidState fs;
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx)
+                fs.setSaturation(phaseIdx, saturations[i*numPhases + phaseIdx]);
+
+            std::array<Scalar,numPhases> pc = {0.0, 0.0, 0.0};
+            std::array<Scalar,numPhases> kr = {0.0, 0.0, 0.0};
+            MaterialLaw::capillaryPressures(pc, materialLawManager.materialLawParams(elements[i]), fs);
+            MaterialLaw::relativePermeabilities(kr, materialLawManager.materialLawParams(elements[i]), fs);
+
+            for (unsigned phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                BOOST_CHECK_EQUAL(pcBatch[i*numPhases + phaseIdx], pc[phaseIdx]);
+                BOOST_CHECK_EQUAL(krBatch[i*numPhases + phaseIdx], kr[phaseIdx]);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(ContiguousParamStorage, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using GasOilLaw = typename MaterialLaw::GasOilMaterialLaw;
+    using OilWaterLaw = typename MaterialLaw::OilWaterMaterialLaw;
+    using Approach = Opm::EclMultiplexerApproach;
+
+    // Both approaches refer to the parameters kept contiguously by the
+    // manager. Cell dependent end points make them differ between cells.
+    std::string defaultDeckString = hysterDeckString;
+    defaultDeckString.replace(defaultDeckString.find("DISGAS\n"), 7, "DISGAS\n\nENDSCALE\n/\n");
+    defaultDeckString += "\nSWL\n  100*0.12 100*0.15 100*0.2 /\n";
+    const auto stoneDeckString = defaultDeckString + "\nSTONE1\n";
+
+    Opm::Parser parser;
+    const Opm::EclipseState defaultEclState(parser.parseString(defaultDeckString));
+    const Opm::EclipseState stoneEclState(parser.parseString(stoneDeckString));
+    const size_t n = defaultEclState.getInputGrid().getCartesianSize();
+
+    MaterialLawManager defaultManager;
+    defaultManager.initFromState(defaultEclState);
+    defaultManager.initParamsForElements(defaultEclState, n);
+
+    MaterialLawManager stoneManager;
+    stoneManager.initFromState(stoneEclState);
+    stoneManager.initParamsForElements(stoneEclState, n);
+
+    BOOST_REQUIRE(defaultManager.materialLawParams(0).approach() == Approach::Default);
+    BOOST_REQUIRE(stoneManager.materialLawParams(0).approach() == Approach::Stone1);
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const Scalar swl = elemIdx < 100 ? 0.12 : (elemIdx < 200 ? 0.15 : 0.2);
+        BOOST_CHECK_CLOSE(defaultManager.oilWaterScaledEpsInfoDrainage(elemIdx).Swl, swl, 1e-5);
+        BOOST_CHECK_CLOSE(stoneManager.oilWaterScaledEpsInfoDrainage(elemIdx).Swl, swl, 1e-5);
+    }
+
+    // The parameters of neighbouring cells are neighbours in memory.
+    for (unsigned elemIdx = 1; elemIdx < n; ++elemIdx) {
+        const auto& defaultParams = defaultManager.materialLawParams(elemIdx).template getRealParams<Approach::Default>();
+        const auto& prevDefaultParams = defaultManager.materialLawParams(elemIdx - 1).template getRealParams<Approach::Default>();
+        const auto& stoneParams = stoneManager.materialLawParams(elemIdx).template getRealParams<Approach::Stone1>();
+        const auto& prevStoneParams = stoneManager.materialLawParams(elemIdx - 1).template getRealParams<Approach::Stone1>();
+        BOOST_CHECK(&defaultParams == &prevDefaultParams + 1);
+        BOOST_CHECK(&stoneParams == &prevStoneParams + 1);
+        BOOST_CHECK(&defaultParams.oilWaterParams() == &prevDefaultParams.oilWaterParams() + 1);
+        BOOST_CHECK(&stoneParams.gasOilParams() == &prevStoneParams.gasOilParams() + 1);
+    }
+
+    for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+        const auto& defaultParams = defaultManager.materialLawParams(elemIdx).template getRealParams<Approach::Default>();
+        const auto& stoneParams = stoneManager.materialLawParams(elemIdx).template getRealParams<Approach::Stone1>();
+
+        for (int i = 0; i <= 20; ++i) {
+            const Scalar S = Scalar(i) / 20;
+            BOOST_CHECK_EQUAL(OilWaterLaw::twoPhaseSatPcnw(stoneParams.oilWaterParams(), S),
+                              OilWaterLaw::twoPhaseSatPcnw(defaultParams.oilWaterParams(), S));
+            BOOST_CHECK_EQUAL(OilWaterLaw::twoPhaseSatKrw(stoneParams.oilWaterParams(), S),
+                              OilWaterLaw::twoPhaseSatKrw(defaultParams.oilWaterParams(), S));
+            BOOST_CHECK_EQUAL(OilWaterLaw::twoPhaseSatKrn(stoneParams.oilWaterParams(), S),
+                              OilWaterLaw::twoPhaseSatKrn(defaultParams.oilWaterParams(), S));
+            BOOST_CHECK_EQUAL(GasOilLaw::twoPhaseSatPcnw(stoneParams.gasOilParams(), S),
+                              GasOilLaw::twoPhaseSatPcnw(defaultParams.gasOilParams(), S));
+            BOOST_CHECK_EQUAL(GasOilLaw::twoPhaseSatKrw(stoneParams.gasOilParams(), S),
+                              GasOilLaw::twoPhaseSatKrw(defaultParams.gasOilParams(), S));
+            BOOST_CHECK_EQUAL(GasOilLaw::twoPhaseSatKrn(stoneParams.gasOilParams(), S),
+                              GasOilLaw::twoPhaseSatKrn(defaultParams.gasOilParams(), S));
+        }
+    }
+
+    // Every cell has its own hysteresis state in the contiguous storage.
+    for (auto* manager : {&defaultManager, &stoneManager}) {
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            const Scalar value = Scalar(elemIdx + 1) / (2*n);
+            manager->setOilWaterHysteresisParams(value, value / 2, elemIdx);
+            manager->setGasOilHysteresisParams(value / 3, value / 4, elemIdx);
+        }
+
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            const Scalar value = Scalar(elemIdx + 1) / (2*n);
+            Scalar pcSwMdc = 0.0;
+            Scalar krnSwMdc = 0.0;
+            manager->oilWaterHysteresisParams(pcSwMdc, krnSwMdc, elemIdx);
+            BOOST_CHECK_EQUAL(pcSwMdc, value);
+            BOOST_CHECK_EQUAL(krnSwMdc, value / 2);
+            manager->gasOilHysteresisParams(pcSwMdc, krnSwMdc, elemIdx);
+            BOOST_CHECK_EQUAL(pcSwMdc, value / 3);
+            BOOST_CHECK_EQUAL(krnSwMdc, value / 4);
+        }
+    }
+}
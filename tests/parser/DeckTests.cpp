@@ -18,28 +18,35 @@
  */
 
 
+#include <cstdint>
+#include <fstream>
 #include <stdexcept>
 #include <sstream>
+#include <string_view>
 
 #define BOOST_TEST_MODULE DeckTests
 
 #include <boost/test/unit_test.hpp>
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
+#include <opm/input/eclipse/Deck/DeckCache.hpp>
 #include <opm/input/eclipse/Deck/DeckTree.hpp>
 #include <opm/input/eclipse/Deck/DeckOutput.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/DeckView.hpp>
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/D.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
 #include <opm/input/eclipse/Parser/ParserRecord.hpp>
 #include <opm/common/OpmLog/KeywordLocation.hpp>
+#include <opm/json/JsonObject.hpp>
 
 #include "src/opm/input/eclipse/Parser/raw/RawRecord.hpp"
+#include "tests/WorkArea.hpp"
 
 using namespace Opm;
 
@@ -846,3 +853,72 @@ DATES
     auto count = std::count_if(dw.begin(), dw.end(), is_vfpprod);
     BOOST_CHECK_EQUAL(count, 2);
 }
+
+BOOST_AUTO_TEST_CASE(DeckCacheRoundTrip) {
+    WorkArea work;
+    {
+        std::ofstream os("CACHE.DATA");
+        os << "RUNSPEC\nDIMENS\n 2 2 1 /\nGRID\nINCLUDE\n 'PORO.INC' /\nEDIT\n";
+    }
+    {
+        std::ofstream os("PORO.INC");
+        os << "PORO\n 4*0.25 /\n";
+    }
+
+    Parser parser;
+    ParseContext parseContext;
+    ErrorGuard errors;
+    const DeckCache cache(work.currentWorkingDirectory() + "/cache");
+
+    BOOST_CHECK( !cache.load(parser, "CACHE.DATA", parseContext).has_value() );
+    const auto deck = cache.parseFile(parser, "CACHE.DATA", parseContext, errors);
+    BOOST_CHECK( std::filesystem::is_regular_file(cache.cacheFile("CACHE.DATA")) );
+
+    const auto cached = cache.load(parser, "CACHE.DATA", parseContext);
+    BOOST_REQUIRE( cached.has_value() );
+    BOOST_CHECK_EQUAL( cached->getDataFile(), deck.getDataFile() );
+    BOOST_REQUIRE_EQUAL( cached->size(), deck.size() );
+    for (std::size_t index = 0; index < deck.size(); ++index)
+        BOOST_CHECK( (*cached)[index] == deck[index] );
+
+    BOOST_CHECK( cached->getActiveUnitSystem() == deck.getActiveUnitSystem() );
+    BOOST_CHECK( cached->tree().files() == deck.tree().files() );
+
+    // Different ParseContext settings invalidate the cache.
+    ParseContext strict(InputErrorAction::THROW_EXCEPTION);
+    BOOST_CHECK( !cache.load(parser, "CACHE.DATA", strict).has_value() );
+
+    ParseContext ignoring;
+    ignoring.ignoreKeyword("PORO");
+    BOOST_CHECK( !cache.load(parser, "CACHE.DATA", ignoring).has_value() );
+
+    // A Parser with additional keywords invalidates the cache.
+    Parser extended_parser;
+    extended_parser.addParserKeyword(Json::JsonObject("{\"name\" : \"EXTRAKW\", \"sections\" : [\"GRID\"], \"size\" : 1, \"items\" : [{\"name\" : \"X\", \"value_type\" : \"INT\"}]}"));
+    BOOST_CHECK( !cache.load(extended_parser, "CACHE.DATA", parseContext).has_value() );
+    BOOST_CHECK( cache.load(parser, "CACHE.DATA", parseContext).has_value() );
+
+    // Modifying an included file invalidates the cache.
+    {
+        std::ofstream os("PORO.INC");
+        os << "PORO\n 4*0.30 /\n";
+    }
+    BOOST_CHECK( !cache.load(parser, "CACHE.DATA", parseContext).has_value() );
+
+    const auto reparsed = cache.parseFile(parser, "CACHE.DATA", parseContext, errors);
+    BOOST_CHECK_CLOSE( reparsed["PORO"].back().getSIDoubleData()[0], 0.30, 1e-8 );
+    BOOST_CHECK( cache.load(parser, "CACHE.DATA", parseContext).has_value() );
+
+    // The keyword hash does not depend on the Parser instance.
+    BOOST_CHECK_EQUAL( Parser().keywordHash(), parser.keywordHash() );
+
+    // A cache file using another hash algorithm is not used.  The
+    // algorithm id follows the magic string and the format version.
+    {
+        std::fstream file(cache.cacheFile("CACHE.DATA"), std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(std::string_view("OPMDECKCACHE").size() + sizeof(std::uint32_t));
+        const std::uint32_t other_algorithm = 2;
+        file.write(reinterpret_cast<const char*>(&other_algorithm), sizeof other_algorithm);
+    }
+    BOOST_CHECK( !cache.load(parser, "CACHE.DATA", parseContext).has_value() );
+}
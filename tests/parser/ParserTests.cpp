@@ -49,10 +49,16 @@
 #include "src/opm/input/eclipse/Parser/raw/RawKeyword.hpp"
 #include "src/opm/input/eclipse/Parser/raw/RawRecord.hpp"
 
+#include "tests/WorkArea.hpp"
+
 #include <cstddef>
+#include <cstdio>
+#include <cstring>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <random>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -702,6 +708,134 @@ BOOST_AUTO_TEST_CASE(Scan_All_WithDefaults) {
     BOOST_CHECK_EQUAL(25, deckIntItem.get< int >(21));
 }
 
+BOOST_AUTO_TEST_CASE(Scan_All_DoubleData) {
+    ParserItem itemDouble("ITEM", DOUBLE);
+    itemDouble.setSizeType(ParserItem::item_size::ALL);
+    itemDouble.push_backDimension("Length");
+
+    RawRecord rawRecord( "0.25 1.5D+2 +3 2*-1.0e-1 3* 1* 4*7", KeywordLocation("KW", "File", 100) );
+    UnitSystem unit_system(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    const auto deckItem = itemDouble.scan(rawRecord, unit_system, unit_system);
+
+    BOOST_CHECK_EQUAL(13U, deckItem.data_size());
+    BOOST_CHECK_EQUAL(0.25,  deckItem.get< double >(0));
+    BOOST_CHECK_EQUAL(150.0, deckItem.get< double >(1));
+    BOOST_CHECK_EQUAL(3.0,   deckItem.get< double >(2));
+    BOOST_CHECK_EQUAL(-0.1,  deckItem.get< double >(3));
+    BOOST_CHECK_EQUAL(-0.1,  deckItem.get< double >(4));
+    BOOST_CHECK( deckItem.defaultApplied(5));
+    BOOST_CHECK( deckItem.defaultApplied(8));
+    BOOST_CHECK(!deckItem.defaultApplied(9));
+    BOOST_CHECK_EQUAL(7.0,   deckItem.get< double >(12));
+
+    RawRecord zeroCount( "1.0 0*2.0", KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK_THROW(itemDouble.scan(zeroCount, unit_system, unit_system), std::invalid_argument);
+
+    RawRecord malformed( "1.0 2*2.0x", KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK_THROW(itemDouble.scan(malformed, unit_system, unit_system), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Scan_All_DoubleData_SameAsSingle) {
+    // The ALL fast path must give bit identical values to the general
+    // per token path, including inputs where a correctly rounded
+    // conversion differs from the Fortran aware one in the last bit.
+    const auto tokens = std::vector<std::string> {
+        "0.1", "0.25", "-1.0e-1", "1.5D+2", "1.5d-2", "+3", "6.02214076E23",
+        "3.14159265358979323846", "123456789.123456789", "9007199254740993",
+        "2.2250738585072014e-308", "1e22", "1e23",
+        "-5567.32652013207371056e-7", "-9609.57e29", "2174.1D24",
+        "3219.046767916861427e-13", "4573.92496873301e-26",
+        "-0", "0.", ".5", "+.5", "1.e5", "00012.500", "1e-22", "-.25D-3",
+        "9007199254740992", "4503599627370496.5", "0.1234567890123456789",
+    };
+
+    std::string record;
+    for (const auto& token : tokens)
+        record += token + ' ';
+
+    ParserItem itemAll("ITEM", DOUBLE);
+    itemAll.setSizeType(ParserItem::item_size::ALL);
+    ParserItem itemSingle("ITEM", DOUBLE);
+
+    UnitSystem unit_system;
+    RawRecord rawRecord( record, KeywordLocation("KW", "File", 100) );
+    const auto deckItem = itemAll.scan(rawRecord, unit_system, unit_system);
+    const auto& values = deckItem.getData<double>();
+    BOOST_REQUIRE_EQUAL(tokens.size(), values.size());
+
+    for (std::size_t index = 0; index < tokens.size(); ++index) {
+        RawRecord single( tokens[index], KeywordLocation("KW", "File", 100) );
+        const auto expected = itemSingle.scan(single, unit_system, unit_system).getData<double>()[0];
+        BOOST_TEST_INFO("Token " << tokens[index]);
+        BOOST_CHECK(std::memcmp(&expected, &values[index], sizeof expected) == 0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Scan_All_DoubleData_LargeRecord) {
+    // A ZCORN like record of depths with varying precision, exponent
+    // styles and repeats must give bit identical values to the per token
+    // path.
+    std::mt19937 generator(20231016);
+    std::uniform_real_distribution<double> depth(1000.0, 3000.0);
+    std::uniform_int_distribution<int> decimals(0, 17);
+    std::uniform_int_distribution<int> style(0, 5);
+    std::uniform_int_distribution<int> repeat(2, 50);
+
+    std::vector<std::string> values;
+    std::vector<std::size_t> counts;
+    char buffer[64];
+    for (int index = 0; index < 100000; ++index) {
+        const auto precision = decimals(generator);
+        const auto value = (index % 7 == 0) ? -depth(generator) : depth(generator);
+        const auto kind = style(generator);
+        if (kind <= 2)
+            std::snprintf(buffer, sizeof buffer, "%.*f", precision, value);
+        else
+            std::snprintf(buffer, sizeof buffer, "%.*E", precision, value);
+
+        std::string token(buffer);
+        if (kind == 4)
+            token[token.find('E')] = 'D';
+
+        values.push_back(token);
+        counts.push_back((kind == 5) ? repeat(generator) : 1);
+    }
+
+    std::string record;
+    std::size_t num_values = 0;
+    for (std::size_t index = 0; index < values.size(); ++index) {
+        if (counts[index] > 1)
+            record += std::to_string(counts[index]) + '*';
+        record += values[index] + '\n';
+        num_values += counts[index];
+    }
+
+    ParserItem itemAll("ITEM", DOUBLE);
+    itemAll.setSizeType(ParserItem::item_size::ALL);
+    ParserItem itemSingle("ITEM", DOUBLE);
+
+    UnitSystem unit_system;
+    RawRecord rawRecord( record, KeywordLocation("ZCORN", "File", 100) );
+    const auto deckItem = itemAll.scan(rawRecord, unit_system, unit_system);
+    const auto& data = deckItem.getData<double>();
+    BOOST_REQUIRE_EQUAL(data.size(), num_values);
+
+    std::size_t offset = 0;
+    std::size_t mismatches = 0;
+    std::string first_mismatch;
+    for (std::size_t index = 0; index < values.size(); ++index) {
+        RawRecord single( values[index], KeywordLocation("ZCORN", "File", 100) );
+        const auto expected = itemSingle.scan(single, unit_system, unit_system).getData<double>()[0];
+        for (std::size_t repeat_index = 0; repeat_index < counts[index]; ++repeat_index, ++offset) {
+            if (std::memcmp(&expected, &data[offset], sizeof expected) != 0) {
+                if (mismatches++ == 0)
+                    first_mismatch = values[index];
+            }
+        }
+    }
+    BOOST_CHECK_MESSAGE(mismatches == 0, mismatches << " values differ, first token " << first_mismatch);
+}
+
 BOOST_AUTO_TEST_CASE(Scan_SINGLE_CorrectIntSetInDeckItem) {
     ParserItem itemInt(std::string("ITEM2"), INT);
 
@@ -2468,6 +2602,92 @@ BOOST_AUTO_TEST_CASE(parseSections) {
     BOOST_CHECK_THROW(parser.parseFile("./tests/SPE1CASE1B.DATA", parseContext, grid_section), std::runtime_error);
 }
 
+BOOST_AUTO_TEST_CASE(parseMemoryMappedInput) {
+    Opm::ParseContext parseContext;
+    parseContext.update(Opm::ParseContext::PARSE_EXTRA_DATA , Opm::InputErrorAction::IGNORE );
+    parseContext.update(Opm::ParseContext::PARSE_EXTRA_RECORDS , Opm::InputErrorAction::IGNORE );
+    parseContext.update(Opm::ParseContext::PARSE_RANDOM_SLASH , Opm::InputErrorAction::IGNORE );
+
+    Opm::Parser parser;
+    const auto deck = parser.parseFile("./tests/SPE1CASE1.DATA", parseContext);
+
+    Opm::Parser mapped_parser;
+    BOOST_CHECK(!mapped_parser.memoryMappedInput());
+    mapped_parser.setMemoryMappedInput(true);
+    BOOST_CHECK(mapped_parser.memoryMappedInput());
+
+    const auto mapped_deck = mapped_parser.parseFile("./tests/SPE1CASE1.DATA", parseContext);
+    BOOST_CHECK_EQUAL( mapped_deck.size(), 79 );
+    BOOST_CHECK( mapped_deck == deck );
+
+    const auto mapped_props = mapped_parser.parseFile("./tests/SPE1CASE1.DATA", parseContext, {Opm::Ecl::PROPS});
+    BOOST_CHECK_EQUAL( mapped_props.size(), 21 );
+
+    // Comments inside multi-line records and no trailing newline
+    const auto deck_string = std::string { R"(RUNSPEC
+DIMENS
+  -- NX NY
+  10 10  -- NZ follows
+  -- 'quoted -- comment'
+  3 / trailing text
+GRID
+PORO
+  -- comment line
+  300*0.25 / final)" };
+
+    WorkArea work;
+    {
+        std::ofstream os("mmap_input.DATA");
+        os << deck_string;
+    }
+
+    const auto string_deck = parser.parseString(deck_string);
+    const auto mapped_file_deck = mapped_parser.parseFile("mmap_input.DATA");
+    BOOST_CHECK_EQUAL( mapped_file_deck.size(), string_deck.size() );
+    for (std::size_t index = 0; index < string_deck.size(); ++index)
+        BOOST_CHECK( mapped_file_deck[index] == string_deck[index] );
+
+    const auto& dimens = mapped_file_deck["DIMENS"].back().getRecord(0);
+    BOOST_CHECK_EQUAL( dimens.getItem("NX").get<int>(0), 10 );
+    BOOST_CHECK_EQUAL( dimens.getItem("NZ").get<int>(0), 3 );
+    BOOST_CHECK_EQUAL( mapped_file_deck["PORO"].back().getRecord(0).getItem(0).data_size(), 300 );
+}
+
+
+BOOST_AUTO_TEST_CASE(parseParallelDataKeywords) {
+    Opm::ParseContext parseContext;
+    parseContext.update(Opm::ParseContext::PARSE_EXTRA_DATA , Opm::InputErrorAction::IGNORE );
+    parseContext.update(Opm::ParseContext::PARSE_EXTRA_RECORDS , Opm::InputErrorAction::IGNORE );
+    parseContext.update(Opm::ParseContext::PARSE_RANDOM_SLASH , Opm::InputErrorAction::IGNORE );
+
+    Opm::Parser parser;
+    const auto deck = parser.parseFile("./tests/SPE1CASE1.DATA", parseContext);
+
+    Opm::Parser parallel_parser;
+    BOOST_CHECK(!parallel_parser.parallelDataKeywords());
+    parallel_parser.setParallelDataKeywords(true);
+    BOOST_CHECK(parallel_parser.parallelDataKeywords());
+
+    const auto parallel_deck = parallel_parser.parseFile("./tests/SPE1CASE1.DATA", parseContext);
+    BOOST_CHECK( parallel_deck == deck );
+
+    const auto deck_string = std::string { R"(RUNSPEC
+DIMENS
+  2 2 1 /
+GRID
+PORO
+  4*0.25 /
+PERMX
+  4*100 /
+PERMY
+  1 2 3 4 /
+PERMZ
+  4*x /
+)" };
+
+    BOOST_CHECK_THROW( parallel_parser.parseString(deck_string), Opm::OpmInputError );
+}
+
 
 BOOST_AUTO_TEST_CASE(ParserKeywordSize) {
     // Default size: SLASH_TERMINATED and no special attributes
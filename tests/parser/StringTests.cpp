@@ -147,6 +147,29 @@ BOOST_AUTO_TEST_CASE(match_test) {
     BOOST_CHECK( shmatch("NAME.*", "NAME.EXT") );
     BOOST_CHECK( !shmatch("NAME.?", "NAME.") );
     BOOST_CHECK( !shmatch("NAME.*", "NAME") );
+    BOOST_CHECK( !shmatch("NAME.?", "NAMEXY") );
+
+    BOOST_CHECK( shmatch("W[!1]", "W2") );
+    BOOST_CHECK( !shmatch("W[!1]", "W1") );
+    BOOST_CHECK( shmatch("W\\*", "W*") );
+    BOOST_CHECK( !shmatch("W\\*", "WX") );
+    BOOST_CHECK( shmatch("*A*B", "XAYAB") );
+    BOOST_CHECK( !shmatch("*A*B", "XAYBA") );
+    BOOST_CHECK( shmatch("", "") );
+    BOOST_CHECK( shmatch("*", "") );
+}
+
+BOOST_AUTO_TEST_CASE(match_table) {
+    const std::vector<std::string> names = { "OP1", "INJ1", "OP2", "OPX" };
+
+    const ShellPattern pattern("OP?");
+    BOOST_CHECK( pattern.match("OP1") );
+    BOOST_CHECK( !pattern.match("OP12") );
+    BOOST_CHECK( pattern.match(names) == std::vector<std::size_t>({ 0, 2, 3 }) );
+
+    BOOST_CHECK( shmatch("OP[0-9]", names) == std::vector<std::size_t>({ 0, 2 }) );
+    BOOST_CHECK( shmatch("*1", names) == std::vector<std::size_t>({ 0, 1 }) );
+    BOOST_CHECK( shmatch("PROD*", names).empty() );
 }
 
 
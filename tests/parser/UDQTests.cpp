@@ -2613,6 +2613,48 @@ BOOST_AUTO_TEST_CASE(UDQ_DIV_TEST) {
     BOOST_CHECK_EQUAL( res_div[0].get() , 2.0);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_WELL_EXPRESSION_UNDEFINED) {
+    KeywordLocation location;
+    UDQFunctionTable udqft;
+    UDQParams udqp;
+    UDQDefine def_lin(udqp, "WU", 0, location, {"(", "WOPR", "+", "1", ")", "*", "2"});
+    UDQDefine def_sel(udqp, "WU", 0, location, {"WOPR", "'P*'", "-", "WOPR", "'I1'"});
+    UDQDefine def_sum(udqp, "WU", 0, location, {"WOPR", "/", "SUM", "(", "WOPR", ")"});
+    UDQDefine def_idv(udqp, "WU", 0, location, {"IDV", "(", "WOPR", "'P*'", ")"});
+    UDQDefine def_ln(udqp, "WU", 0, location, {"LN", "(", "WOPR", ")"});
+
+    SummaryState st(TimeService::now());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "I1"}));
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    UDQContext context(udqft, wm, {}, segmentMatcherFactory, st, udq_state);
+
+    st.update_well_var("P1", "WOPR", 1);
+    st.update_well_var("I1", "WOPR", 3);
+
+    const auto res_lin = def_lin.eval(context);
+    BOOST_CHECK_EQUAL(res_lin["P1"].get(), 4.0);
+    BOOST_CHECK(!res_lin["P2"].defined());
+    BOOST_CHECK_EQUAL(res_lin["I1"].get(), 8.0);
+
+    const auto res_sel = def_sel.eval(context);
+    BOOST_CHECK_EQUAL(res_sel["P1"].get(), -2.0);
+    BOOST_CHECK(!res_sel["P2"].defined());
+    BOOST_CHECK(!res_sel["I1"].defined());
+
+    const auto res_sum = def_sum.eval(context);
+    BOOST_CHECK_EQUAL(res_sum["P1"].get(), 0.25);
+    BOOST_CHECK_EQUAL(res_sum["I1"].get(), 0.75);
+
+    const auto res_idv = def_idv.eval(context);
+    BOOST_CHECK_EQUAL(res_idv["P1"].get(), 1.0);
+    BOOST_CHECK_EQUAL(res_idv["P2"].get(), 0.0);
+    BOOST_CHECK_EQUAL(res_idv["I1"].get(), 0.0);
+
+    st.update_well_var("P2", "WOPR", -1);
+    BOOST_CHECK_THROW(def_ln.eval(context), std::exception);
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_LEADING_SIGN) {
     std::string deck_string = R"(
 SCHEDULE
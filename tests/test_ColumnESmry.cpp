@@ -0,0 +1,159 @@
+/*
+   Copyright 2026 Equinor ASA.
+
+   This file is part of the Open Porous Media project (OPM).
+
+   OPM is free software: you can redistribute it and/or modify it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   OPM is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+   */
+
+#include "config.h"
+
+#include <opm/io/eclipse/ColumnESmry.hpp>
+#include <opm/io/eclipse/ColumnSmryOutput.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+
+#define BOOST_TEST_MODULE Test ColumnESmry
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using Opm::EclIO::ColumnESmry;
+using Opm::EclIO::ColumnSmryOutput;
+using Opm::EclIO::ESmry;
+
+BOOST_AUTO_TEST_CASE(ConvertFromESmry) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    ESmry smry("SPE1CASE1.SMSPEC");
+
+    BOOST_CHECK(smry.make_csmry_file(16));
+    BOOST_CHECK(!smry.make_csmry_file(16));
+
+    ColumnESmry csmry("SPE1CASE1.CSMRY");
+
+    BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), smry.numberOfTimeSteps());
+    BOOST_CHECK_EQUAL(csmry.numberOfVectors(), static_cast<std::size_t>(smry.numberOfVectors()));
+    BOOST_CHECK(csmry.keywordList() == smry.keywordList());
+    BOOST_CHECK(csmry.keywordList("BPR*") == smry.keywordList("BPR*"));
+    BOOST_CHECK(csmry.startdate() == smry.startdate());
+    BOOST_CHECK(csmry.dates() == smry.dates());
+
+    for (const auto& key : smry.keywordList()) {
+        BOOST_CHECK(csmry.get(key) == smry.get(key));
+        BOOST_CHECK(csmry.get_at_rstep(key) == smry.get_at_rstep(key));
+        BOOST_CHECK_EQUAL(csmry.get_unit(key), smry.get_unit(key));
+    }
+
+    BOOST_CHECK(!csmry.hasKey("NO_SUCH_KEY"));
+    BOOST_CHECK_THROW(csmry.get("NO_SUCH_KEY"), std::invalid_argument);
+
+    // Time step ranges crossing chunk boundaries
+    const auto& wbhp = smry.get("WBHP:PROD");
+    const auto range = csmry.get("WBHP:PROD", 10, 50);
+    BOOST_CHECK(range == std::vector<float>(wbhp.begin() + 10, wbhp.begin() + 50));
+    BOOST_CHECK(csmry.get("WBHP:PROD", 120, 1000) == std::vector<float>(wbhp.begin() + 120, wbhp.end()));
+    BOOST_CHECK(csmry.get("WBHP:PROD", 200, 300).empty());
+
+    const auto multi = csmry.get({"TIME", "FGOR", "WBHP:PROD"}, 15, 17);
+    BOOST_REQUIRE_EQUAL(multi.size(), 3U);
+    BOOST_CHECK(multi[1] == std::vector<float>(smry.get("FGOR").begin() + 15, smry.get("FGOR").begin() + 17));
+    BOOST_CHECK(multi[2] == std::vector<float>(wbhp.begin() + 15, wbhp.begin() + 17));
+}
+
+
+BOOST_AUTO_TEST_CASE(AppendWhileReading) {
+    WorkArea work;
+
+    const std::vector<std::string> keys = {"TIME", "FOPR", "FPR"};
+    const std::vector<std::string> units = {"DAYS", "SM3/DAY", "BARSA"};
+    const std::vector<int> start = {1, 1, 2020, 0, 0, 0, 0};
+
+    ColumnSmryOutput output("APPEND.CSMRY", keys, units, start, 4);
+
+    ColumnESmry reader("APPEND.CSMRY");
+    BOOST_CHECK_EQUAL(reader.numberOfTimeSteps(), 0U);
+    BOOST_CHECK(reader.get("FOPR").empty());
+
+    std::vector<float> fopr;
+    for (int step = 0; step < 10; step++) {
+        fopr.push_back(step < 5 ? 100.0f : 250.5f);
+        output.write({static_cast<float>(step), fopr.back(), 300.0f - std::sqrt(static_cast<float>(step))}, step % 3 == 0);
+    }
+
+    // Two full chunks are written, the last two steps are still buffered
+    reader.refresh();
+    BOOST_CHECK_EQUAL(reader.numberOfTimeSteps(), 8U);
+    BOOST_CHECK(reader.get("FOPR") == std::vector<float>(fopr.begin(), fopr.begin() + 8));
+
+    output.flush();
+    reader.refresh();
+    BOOST_CHECK_EQUAL(reader.numberOfTimeSteps(), 10U);
+    BOOST_CHECK(reader.get("FOPR") == fopr);
+    BOOST_CHECK(reader.get_at_rstep("TIME") == std::vector<float>({0.0f, 3.0f, 6.0f, 9.0f}));
+    BOOST_CHECK_EQUAL(reader.get_unit("FPR"), "BARSA");
+
+    BOOST_CHECK_THROW(output.write({1.0f}, false), std::invalid_argument);
+}
+
+
+BOOST_AUTO_TEST_CASE(UncommittedDataIgnored) {
+    WorkArea work;
+
+    const std::vector<std::string> keys = {"TIME", "FOPR"};
+    const std::vector<std::string> units = {"DAYS", "SM3/DAY"};
+    const std::vector<int> start = {1, 1, 2020, 0, 0, 0, 0};
+
+    {
+        ColumnSmryOutput output("PARTIAL.CSMRY", keys, units, start, 2);
+        for (int step = 0; step < 5; step++)
+            output.write({static_cast<float>(step), 10.0f * step}, true);
+    }
+
+    const auto size = std::filesystem::file_size("PARTIAL.CSMRY");
+
+    // Committed size is stored little endian after magic and version.
+    {
+        std::ifstream file("PARTIAL.CSMRY", std::ios::binary);
+        std::vector<unsigned char> header(24);
+        file.read(reinterpret_cast<char*>(header.data()), header.size());
+
+        std::uint64_t committed = 0;
+        for (std::size_t b = 0; b < 8; ++b)
+            committed |= static_cast<std::uint64_t>(header[16 + b]) << (8 * b);
+
+        BOOST_CHECK_EQUAL(committed, size);
+    }
+
+    // A chunk which is being written by another process.
+    {
+        std::ofstream file("PARTIAL.CSMRY", std::ios::binary | std::ios::app);
+        const std::vector<char> partial(37, '\x7f');
+        file.write(partial.data(), partial.size());
+    }
+
+    ColumnESmry reader("PARTIAL.CSMRY");
+    BOOST_CHECK_EQUAL(reader.numberOfTimeSteps(), 5U);
+    BOOST_CHECK(reader.get("FOPR") == std::vector<float>({0.0f, 10.0f, 20.0f, 30.0f, 40.0f}));
+
+    reader.refresh();
+    BOOST_CHECK_EQUAL(reader.numberOfTimeSteps(), 5U);
+}
@@ -34,6 +34,7 @@
 #include <iostream>
 #include <math.h>
 #include <stdio.h>
+#include <thread>
 #include <tuple>
 #include "tests/WorkArea.hpp"
 
@@ -420,6 +421,50 @@ BOOST_AUTO_TEST_CASE(TestESmry_5) {
 
 
 
+BOOST_AUTO_TEST_CASE(TestESmry_ConcurrentLoad) {
+
+    for (const auto& [fname, loadBase] : { std::make_pair("SPE1CASE1.SMSPEC", false),
+                                          std::make_pair("SPE1CASE1A.SMSPEC", true) }) {
+
+        ESmry ref(fname, loadBase);
+        ref.loadData();
+
+        ESmry smry1(fname, loadBase);
+        const auto& keys = smry1.keywordList();
+
+        // Partial batched load, remaining vectors are loaded concurrently,
+        // by selective loads and by a bulk load
+        smry1.loadData({keys[0], keys[keys.size() / 2], keys.back()});
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < 4; t++) {
+            threads.emplace_back([&smry1, &keys, t]() {
+                for (std::size_t n = t; n < keys.size(); n += 2)
+                    smry1.get(keys[n]);
+            });
+        }
+
+        threads.emplace_back([&smry1]() { smry1.loadData(); });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        for (const auto& key : keys) {
+            const auto& v1 = ref.get(key);
+            const auto& v2 = smry1.get(key);
+
+            BOOST_REQUIRE_EQUAL(v1.size(), v2.size());
+            for (std::size_t n = 0; n < v1.size(); n++) {
+                if (std::isnan(v1[n]))
+                    BOOST_CHECK(std::isnan(v2[n]));
+                else
+                    BOOST_CHECK_EQUAL(v1[n], v2[n]);
+            }
+        }
+    }
+}
+
+
 namespace fs = std::filesystem;
 BOOST_AUTO_TEST_CASE(TestCreateRSM) {
     ESmry smry1("SPE1CASE1.SMSPEC");
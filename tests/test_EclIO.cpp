@@ -21,6 +21,7 @@
 #include <stdio.h>
 
 #include <algorithm>
+#include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -195,6 +196,48 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY) {
 }
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MEMORY_MAPPED) {
+
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(!file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    BOOST_CHECK_THROW(file1.view<int>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.view<float>("NOSUCHKW"), std::invalid_argument);
+
+    const auto icon = file2.view<int>("ICON");
+    const auto logihead = file2.view<bool>(1);
+    const auto porv = file2.view<float>("PORV");
+    const auto xcon = file2.view<double>("XCON");
+
+    BOOST_CHECK(icon.copy() == file1.get<int>("ICON"));
+    BOOST_CHECK(logihead.copy() == file1.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(porv.copy() == file1.get<float>("PORV"));
+    BOOST_CHECK(xcon.copy() == file1.get<double>("XCON"));
+
+    // Element access across block boundaries
+    const auto& porv_ref = file1.get<float>("PORV");
+    BOOST_CHECK_EQUAL(porv.size(), porv_ref.size());
+    for (std::size_t n : {0UL, 999UL, 1000UL, 2001UL, 3145UL})
+        BOOST_CHECK_EQUAL(porv[n], porv_ref[n]);
+
+    BOOST_CHECK_THROW(porv.at(3146), std::out_of_range);
+
+    // Arrays loaded through the mapping are identical to the stream path
+    BOOST_CHECK(file2.get<float>("PORV") == porv_ref);
+    BOOST_CHECK(file2.get<std::string>("KEYWORDS") == file1.get<std::string>("KEYWORDS"));
+
+    // Views remain valid after the file object is gone
+    auto view = EclFile(testFile, EclFile::MemoryMapped{true}).view<double>("XCON");
+    BOOST_CHECK(view.copy() == file1.get<double>("XCON"));
+}
+
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED) {
 
     std::string testFile1="ECLFILE.INIT";
@@ -265,6 +308,94 @@ BOOST_AUTO_TEST_CASE(TestEclFile_IX) {
 
 
 
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadData_MultipleArrays) {
+
+    std::vector<int> inte(2500);
+    std::vector<float> real(3001);
+    std::vector<double> doub(1000);
+    std::vector<std::string> chars = {"PRESSURE", "SWAT", "SGAS"};
+
+    std::iota(inte.begin(), inte.end(), -1200);
+    for (std::size_t n = 0; n < real.size(); n++)
+        real[n] = 0.5f * n;
+
+    for (std::size_t n = 0; n < doub.size(); n++)
+        doub[n] = 1.0e5 + 0.25 * n;
+
+    WorkArea work;
+    {
+        EclOutput eclTest("MULTI.DAT", false);
+
+        eclTest.write("INTE", inte);
+        eclTest.write("REAL", real);
+        eclTest.write("NAMES", chars);
+        eclTest.write("DOUB", doub);
+        eclTest.write("EMPTY", std::vector<int>());
+        eclTest.write("REAL", real);
+    }
+
+    for (bool mmap : {false, true}) {
+        EclFile file1("MULTI.DAT", EclFile::MemoryMapped{mmap});
+        file1.loadData(std::vector<int>{5, 0, 2, 1, 3, 4, 0});
+
+        BOOST_CHECK(file1.get<int>(0) == inte);
+        BOOST_CHECK(file1.get<float>(1) == real);
+        BOOST_CHECK(file1.get<std::string>(2) == chars);
+        BOOST_CHECK(file1.get<double>(3) == doub);
+        BOOST_CHECK(file1.get<int>(4).empty());
+        BOOST_CHECK(file1.get<float>(5) == real);
+
+        EclFile file2("MULTI.DAT", EclFile::MemoryMapped{mmap});
+        file2.loadData("REAL");
+        BOOST_CHECK(file2.get<float>(1) == real);
+        BOOST_CHECK(file2.get<float>(5) == real);
+    }
+}
+
+
+BOOST_AUTO_TEST_CASE(TestEclFile_LoadData_Corrupt) {
+
+    std::vector<int> inte(2500);
+    std::vector<double> doub(1000);
+    std::iota(inte.begin(), inte.end(), 0);
+    std::iota(doub.begin(), doub.end(), 0.0);
+
+    WorkArea work;
+    {
+        EclOutput eclTest("CORRUPT.DAT", false);
+        eclTest.write("INTE", inte);
+        eclTest.write("DOUB", doub);
+    }
+
+    // Tail marker of first data record of INTE, after the array header
+    // and 1000 elements.
+    {
+        std::fstream file("CORRUPT.DAT", std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(24 + 4 + 1000 * 4);
+        const int marker = 0;
+        file.write(reinterpret_cast<const char*>(&marker), sizeof marker);
+    }
+
+    for (bool mmap : {false, true}) {
+        EclFile file1("CORRUPT.DAT", EclFile::MemoryMapped{mmap});
+        BOOST_CHECK_THROW(file1.loadData(std::vector<int>{0, 1}), std::runtime_error);
+
+        EclFile file2("CORRUPT.DAT", EclFile::MemoryMapped{mmap});
+        file2.loadData("DOUB");
+        BOOST_CHECK(file2.get<double>(1) == doub);
+    }
+
+    // Last array extends beyond end of file.
+    std::filesystem::resize_file("CORRUPT.DAT", std::filesystem::file_size("CORRUPT.DAT") - 100);
+
+    for (bool mmap : {false, true}) {
+        BOOST_CHECK_THROW(EclFile("CORRUPT.DAT", EclFile::MemoryMapped{mmap}).loadData("DOUB"),
+                          std::runtime_error);
+    }
+}
+
+
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_binary) {
 
     std::string inputFile="ECLFILE.INIT";
@@ -300,6 +431,142 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_binary) {
     BOOST_CHECK_EQUAL(compare_files(inputFile, testFile), true);
 }
 
+BOOST_AUTO_TEST_CASE(TestEcl_Write_multiple_records) {
+
+    // arrays spanning several records of the binary and formatted files,
+    // including a partially filled last record and an empty array
+
+    std::vector<int> ivec(2501);
+    std::vector<float> fvec(2501);
+    std::vector<double> dvec(2501);
+    std::vector<bool> lvec(2501);
+    std::vector<std::string> svec(250);
+
+    for (std::size_t i = 0; i < ivec.size(); i++) {
+        ivec[i] = static_cast<int>(i) - 1000;
+        fvec[i] = 0.25f * i;
+        dvec[i] = -1.5e-3 * i;
+        lvec[i] = (i % 3) == 0;
+    }
+
+    for (std::size_t i = 0; i < svec.size(); i++)
+        svec[i] = "S" + std::to_string(i);
+
+    WorkArea work;
+
+    for (const bool formatted : { false, true }) {
+        const std::string testFile = formatted ? "TEST.FDAT" : "TEST.DAT";
+
+        {
+            EclOutput eclTest(testFile, formatted);
+
+            eclTest.write("IVEC", ivec);
+            eclTest.write("EMPTY", std::vector<int>{});
+            eclTest.write("FVEC", fvec);
+            eclTest.write("DVEC", dvec);
+            eclTest.write("LVEC", lvec);
+            eclTest.write("SVEC", svec);
+            eclTest.write("LONGSTR", svec, 20);
+        }
+
+        EclFile file1(testFile);
+        file1.loadData();
+
+        BOOST_CHECK(file1.get<int>("IVEC") == ivec);
+        BOOST_CHECK(file1.get<int>("EMPTY").empty());
+        BOOST_CHECK(file1.get<float>("FVEC") == fvec);
+        BOOST_CHECK(file1.get<bool>("LVEC") == lvec);
+        BOOST_CHECK(file1.get<std::string>("SVEC") == svec);
+        BOOST_CHECK(file1.get<std::string>("LONGSTR") == svec);
+
+        const auto& dres = file1.get<double>("DVEC");
+        BOOST_REQUIRE_EQUAL(dres.size(), dvec.size());
+        for (std::size_t i = 0; i < dvec.size(); i++)
+            BOOST_CHECK_CLOSE(dres[i], dvec[i], 1.0e-10);
+    }
+}
+
+#if HAVE_ZLIB
+BOOST_AUTO_TEST_CASE(TestEcl_Write_compressed) {
+
+    // data of several compressed blocks, some arrays of every type and an
+    // empty array, written in two sessions
+
+    std::vector<double> swat(300000);
+    std::vector<int> ivec(2501);
+    std::vector<bool> lvec(2501);
+    std::vector<std::string> svec(250);
+
+    for (std::size_t i = 0; i < swat.size(); i++)
+        swat[i] = (i % 1000 < 300) ? 1.0 : 0.2 + 1.0e-6 * (i % 1000);
+
+    for (std::size_t i = 0; i < ivec.size(); i++) {
+        ivec[i] = static_cast<int>(i) - 1000;
+        lvec[i] = (i % 3) == 0;
+    }
+
+    for (std::size_t i = 0; i < svec.size(); i++)
+        svec[i] = "S" + std::to_string(i);
+
+    const std::vector<float> fvec { 1.0f, -2.5f, 3.25f };
+
+    WorkArea work;
+
+    {
+        EclOutput eclTest("TEST.DAT", EclOutput::Compressed{true});
+        BOOST_CHECK(eclTest.compressedOutput());
+
+        eclTest.write("SEQNUM", std::vector<int>{ 1 });
+        eclTest.write("SWAT", swat);
+        eclTest.write("EMPTY", std::vector<int>{});
+        eclTest.write("LVEC", lvec);
+        eclTest.message("STARTSOL");
+    }
+
+    {
+        EclOutput eclTest("TEST.DAT", EclOutput::Compressed{true}, std::ios::app);
+
+        eclTest.write("IVEC", ivec);
+        eclTest.write("FVEC", fvec);
+        eclTest.write("SVEC", svec);
+        eclTest.write("LONGSTR", svec, 20);
+    }
+
+    BOOST_CHECK_THROW(EclOutput("TEST.DAT", false, std::ios::app), std::invalid_argument);
+
+    {
+        EclOutput eclTest("REF.DAT", false);
+        eclTest.write("SWAT", swat);
+    }
+
+    BOOST_CHECK(std::filesystem::file_size("TEST.DAT") < std::filesystem::file_size("REF.DAT") / 10);
+
+    EclFile file1("TEST.DAT");
+    BOOST_CHECK(file1.compressedInput());
+
+    const auto arrayList = file1.getList();
+    BOOST_REQUIRE_EQUAL(arrayList.size(), 9U);
+    BOOST_CHECK_EQUAL(std::get<0>(arrayList[1]), "SWAT");
+    BOOST_CHECK_EQUAL(std::get<2>(arrayList[1]), static_cast<std::int64_t>(swat.size()));
+    BOOST_CHECK(std::get<1>(arrayList[4]) == MESS);
+    BOOST_CHECK(std::get<1>(arrayList[8]) == C0NN);
+
+    BOOST_CHECK(file1.get<double>("SWAT") == swat);
+    BOOST_CHECK(file1.get<int>("EMPTY").empty());
+    BOOST_CHECK(file1.get<bool>("LVEC") == lvec);
+    BOOST_CHECK(file1.get<int>("IVEC") == ivec);
+    BOOST_CHECK(file1.get<float>("FVEC") == fvec);
+    BOOST_CHECK(file1.get<std::string>("SVEC") == svec);
+    BOOST_CHECK(file1.get<std::string>("LONGSTR") == svec);
+
+    // compressed files are read through the decompressor
+    EclFile file2("TEST.DAT", EclFile::MemoryMapped{true}, true);
+    BOOST_CHECK(!file2.memoryMapped());
+    BOOST_CHECK(file2.get<double>("SWAT") == swat);
+    BOOST_CHECK(file2.get<std::string>("SVEC") == svec);
+}
+#endif // HAVE_ZLIB
+
 BOOST_AUTO_TEST_CASE(TestEcl_Write_formatted) {
 
     std::string inputFile="ECLFILE.FINIT";
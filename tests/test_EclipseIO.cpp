@@ -45,13 +45,18 @@
 #include <opm/io/eclipse/EGrid.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 
+#include <opm/common/OpmLog/LogBackend.hpp>
+#include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -238,6 +243,30 @@ time_t ecl_util_make_date( const int day, const int month, const int year )
     return static_cast<time_t>(asTimeT(Opm::TimeStampUTC{ymd}));
 }
 
+/// Records whether messages arrive on a thread other than the one which
+/// created the backend.
+class ThreadCheckLog : public LogBackend
+{
+public:
+    ThreadCheckLog()
+        : LogBackend(Log::DefaultMessageTypes)
+    {}
+
+    std::size_t numMessages{0};
+    bool otherThread{false};
+
+protected:
+    void addMessageUnconditionally(int64_t, const std::string&) override
+    {
+        ++this->numMessages;
+        this->otherThread = this->otherThread
+            || (std::this_thread::get_id() != this->owner_);
+    }
+
+private:
+    std::thread::id owner_{ std::this_thread::get_id() };
+};
+
 } // Anonymous namespace
 
 BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
@@ -284,7 +313,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         "'PROD' 'G' 3 3 1000 'OIL' /\n"
         "/\n";
 
-    auto write_and_check = [&]( int first = 1, int last = 5 ) {
+    auto write_and_check = [&]( int first = 1, int last = 5, bool async = false ) {
         auto deck = Parser().parseString( deckString);
         auto es = EclipseState( deck );
         auto& eclGrid = es.getInputGrid();
@@ -295,6 +324,8 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
         es.getIOConfig().setBaseName( "FOO" );
 
         EclipseIO eclWriter( es, eclGrid , schedule, summary_config);
+        if (async)
+            eclWriter.enableAsyncOutput(2);
 
         using measure = UnitSystem::measure;
         using TargetType = data::TargetType;
@@ -342,6 +373,7 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
                                      first_step - start_time,
                                      std::move(restart_value));
 
+            eclWriter.flushOutput();
             checkRestartFile( i );
         }
 
@@ -394,4 +426,109 @@ BOOST_AUTO_TEST_CASE(EclipseIOIntegration) {
      * the file
      */
     BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5 ) );
+
+    /* background output writes the same files */
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 1, 5, true ) );
+    BOOST_CHECK_EQUAL( file_size, write_and_check( 3, 5, true ) );
+}
+
+BOOST_AUTO_TEST_CASE(EclipseIOAsyncPendingInput) {
+    const char* deckString =
+        "RUNSPEC\n"
+        "UNIFOUT\n"
+        "OIL\n"
+        "GAS\n"
+        "WATER\n"
+        "METRIC\n"
+        "DIMENS\n"
+        "3 3 3/\n"
+        "GRID\n"
+        "DXV\n"
+        "1.0 2.0 3.0 /\n"
+        "DYV\n"
+        "4.0 5.0 6.0 /\n"
+        "DZV\n"
+        "7.0 8.0 9.0 /\n"
+        "TOPS\n"
+        "9*100 /\n"
+        "PORO\n"
+        "27*0.15 /\n"
+        "PERMX\n"
+        "27*1 /\n"
+        "SOLUTION\n"
+        "RPTRST\n"
+        "BASIC=2\n"
+        "/\n"
+        "SCHEDULE\n"
+        "WELSPECS\n"
+        "'INJ' 'G' 1 1 2000 'GAS' /\n"
+        "'PROD' 'G' 3 3 1000 'OIL' /\n"
+        "/\n"
+        "COMPDAT\n"
+        "'INJ' 1 1 1 3 'OPEN' /\n"
+        "'PROD' 3 3 1 3 'OPEN' /\n"
+        "/\n"
+        "TSTEP\n"
+        "1.0 2.0 3.0 4.0 5.0 6.0 7.0 /\n";
+
+    // Writes the restart file for report steps 1 to 4 and changes the
+    // schedule and the summary state after each writeTimeStep() call, as
+    // ACTIONX and the simulator would do.  Returns the restart file.
+    auto write = [deckString](const std::string& outputDir, const bool async)
+    {
+        auto deck = Parser().parseString(deckString);
+        auto es = EclipseState(deck);
+        auto python = std::make_shared<Python>();
+        Schedule schedule(deck, es, python);
+        SummaryConfig summary_config(deck, schedule, es.fieldProps(), es.aquifer());
+        SummaryState st(TimeService::now());
+        es.getIOConfig().setBaseName("FOO");
+        es.getIOConfig().setOutputDir(outputDir);
+
+        auto log = std::make_shared<ThreadCheckLog>();
+        OpmLog::addBackend("THREADCHECK", log);
+
+        {
+            EclipseIO eclWriter(es, es.getInputGrid(), schedule, summary_config);
+            if (async)
+                eclWriter.enableAsyncOutput(8);
+
+            const auto start_time = ecl_util_make_date(10, 10, 2008);
+            for (int i = 1; i < 5; ++i) {
+                Action::State action_state;
+                WellTestState wtest_state;
+                UDQState udq_state(1);
+                RestartValue restart_value(createBlackoilState(i, 3 * 3 * 3),
+                                           data::Wells{}, data::GroupAndNetworkValues{}, {});
+
+                eclWriter.writeTimeStep(action_state, wtest_state, st, udq_state,
+                                        i, false, ecl_util_make_date(10 + i, 11, 2008) - start_time,
+                                        std::move(restart_value));
+
+                // Output of step i may still be pending here.
+                schedule.shut_well((i % 2 == 0) ? "INJ" : "PROD", i);
+                eclWriter.scheduleChanged();
+                st.update_well_var("PROD", "WOPR", 100.0 * i);
+                st.update("FOPT", 1000.0 * i);
+            }
+
+            eclWriter.flushOutput();
+        }
+
+        OpmLog::removeBackend("THREADCHECK");
+
+        // "Restart file written" is logged for every step.
+        BOOST_CHECK_GE(log->numMessages, std::size_t{4});
+        BOOST_CHECK_MESSAGE(!log->otherThread, "Messages must be logged on the calling thread");
+
+        std::ifstream file(outputDir + "/FOO.UNRST", std::ios::binary);
+        return std::string { std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{} };
+    };
+
+    WorkArea work_area("test_ecl_writer_async");
+
+    const auto expect = write("sync", false);
+    BOOST_REQUIRE(!expect.empty());
+    BOOST_CHECK_MESSAGE(write("async", true) == expect,
+                        "Background output must not see input changed after writeTimeStep()");
 }
@@ -0,0 +1,47 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <config.h>
+
+#define BOOST_TEST_MODULE Fnv1aHashTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/Fnv1aHash.hpp>
+
+#include <cstdint>
+#include <string>
+
+BOOST_AUTO_TEST_CASE(ReferenceValues) {
+    // Values from the FNV reference test suite.  Hashes written to disk
+    // rely on them never changing.
+    BOOST_CHECK_EQUAL(Opm::Fnv1aHash::hash(""), std::uint64_t{0xcbf29ce484222325ULL});
+    BOOST_CHECK_EQUAL(Opm::Fnv1aHash::hash("a"), std::uint64_t{0xaf63dc4c8601ec8cULL});
+    BOOST_CHECK_EQUAL(Opm::Fnv1aHash::hash("foobar"), std::uint64_t{0x85944171f73967e8ULL});
+}
+
+BOOST_AUTO_TEST_CASE(Incremental) {
+    const std::string data = "RUNSPEC\nDIMENS\n 10 10 3 /\n";
+
+    Opm::Fnv1aHash hasher;
+    for (std::size_t pos = 0; pos < data.size(); pos += 5) {
+        hasher.update(std::string_view(data).substr(pos, 5));
+    }
+
+    BOOST_CHECK_EQUAL(hasher.value(), Opm::Fnv1aHash::hash(data));
+}
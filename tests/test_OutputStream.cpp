@@ -17,6 +17,8 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <config.h>
+
 #define BOOST_TEST_MODULE OutputStream
 
 #include <boost/test/unit_test.hpp>
@@ -27,13 +29,16 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 #include <opm/io/eclipse/ERst.hpp>
 #include <opm/io/eclipse/PaddedOutputString.hpp>
+#include <opm/io/eclipse/RestartIndex.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <ctime>
+#include <filesystem>
 #include <iterator>
 #include <ostream>
 #include <string>
@@ -1087,6 +1092,388 @@ BOOST_AUTO_TEST_CASE(Formatted_Separate)
     }
 }
 
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Persistent)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    const auto seqnums = [&fname]()
+    {
+        return ::Opm::EclIO::ERst{fname}.listOfReportStepNumbers();
+    };
+
+    auto writeStep = [](::Opm::EclIO::OutputStream::UnifiedRestart& unif,
+                        const int seqnum)
+    {
+        auto rst = unif.prepareStep(seqnum);
+
+        rst.write("I", std::vector<int>   (3, seqnum));
+        rst.write("D", std::vector<double>(2, 0.5 * seqnum));
+    };
+
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt };
+
+        writeStep(unif, 1);
+        writeStep(unif, 2);
+        writeStep(unif, 7);
+
+        // Output is flushed at the end of each report step.
+        {
+            const auto seqnum        = seqnums();
+            const auto expect_seqnum = std::vector<int>{1, 2, 7};
+
+            BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                          expect_seqnum.begin(),
+                                          expect_seqnum.end());
+        }
+
+        // Before 7.  Should overwrite 7
+        writeStep(unif, 4);
+        writeStep(unif, 5);
+    }
+
+    {
+        const auto seqnum        = seqnums();
+        const auto expect_seqnum = std::vector<int>{1, 2, 4, 5};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+    }
+
+    // Resume output to existing file
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt };
+
+        writeStep(unif, 3);     // Should overwrite 4 and 5
+        writeStep(unif, 6);
+    }
+
+    {
+        const auto seqnum        = seqnums();
+        const auto expect_seqnum = std::vector<int>{1, 2, 3, 6};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        for (const auto& step : expect_seqnum) {
+            rst.loadReportStepNumber(step);
+
+            const auto& I = rst.getRestartData<int>("I", step, 0);
+            const auto  expect_I = std::vector<int>(3, step);
+            BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                          expect_I.begin(),
+                                          expect_I.end());
+
+            const auto& D = rst.getRestartData<double>("D", step, 0);
+            check_is_close(D, std::vector<double>(2, 0.5 * step));
+        }
+    }
+
+    // Separate Restart object appends to file written by UnifiedRestart
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 8, fmt, ::Opm::EclIO::OutputStream::Unified { true }
+        };
+
+        rst.write("I", std::vector<int>(3, 8));
+    }
+
+    {
+        const auto seqnum        = seqnums();
+        const auto expect_seqnum = std::vector<int>{1, 2, 3, 6, 8};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Formatted_Unified_Persistent)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ true };
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "FUNRST");
+
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt };
+
+        for (const auto seqnum : {1, 2, 3, 2}) {
+            auto rst = unif.prepareStep(seqnum);
+            rst.write("I", std::vector<int>{ seqnum, 10 * seqnum });
+        }
+    }
+
+    auto rst = ::Opm::EclIO::ERst{fname};
+
+    const auto seqnum        = rst.listOfReportStepNumbers();
+    const auto expect_seqnum = std::vector<int>{1, 2};
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                  expect_seqnum.begin(),
+                                  expect_seqnum.end());
+
+    rst.loadReportStepNumber(2);
+
+    const auto& I = rst.getRestartData<int>("I", 2, 0);
+    const auto  expect_I = std::vector<int>{ 2, 20 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                  expect_I.begin(),
+                                  expect_I.end());
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Index)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt     = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto compr   = ::Opm::EclIO::OutputStream::Compressed{ false };
+    const auto indexed = ::Opm::EclIO::OutputStream::Indexed{ true };
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    using Index = ::Opm::EclIO::RestartIndex;
+
+    auto writeStep = [](::Opm::EclIO::OutputStream::UnifiedRestart& unif,
+                        const int seqnum)
+    {
+        auto rst = unif.prepareStep(seqnum);
+
+        rst.write("I", std::vector<int>   (3, seqnum));
+        rst.write("D", std::vector<double>(2500, 0.5 * seqnum));
+        rst.message("STARTSOL");
+        rst.write("S", std::vector<std::string>{ "A", "STRING" });
+        rst.message("ENDSOL");
+        rst.finish();
+    };
+
+    auto checkSteps = [&fname](const std::vector<int>& expect_seqnum)
+    {
+        auto rst = ::Opm::EclIO::ERst{fname};
+
+        const auto seqnum = rst.listOfReportStepNumbers();
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+
+        for (const auto& step : expect_seqnum) {
+            rst.loadReportStepNumber(step, { "D" });
+
+            const auto& D = rst.getRestartData<double>("D", step, 0);
+            check_is_close(D, std::vector<double>(2500, 0.5 * step));
+
+            const auto& I = rst.getRestartData<int>("I", step, 0);
+            const auto  expect_I = std::vector<int>(3, step);
+            BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                          expect_I.begin(),
+                                          expect_I.end());
+
+            const auto& S = rst.getRestartData<std::string>("S", step, 0);
+            BOOST_CHECK(S == (std::vector<std::string>{ "A", "STRING" }));
+        }
+    };
+
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr, indexed };
+
+        for (const auto seqnum : {1, 2, 7, 4}) {
+            writeStep(unif, seqnum);
+        }
+    }
+
+    // Resume output to existing file
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr, indexed };
+
+        writeStep(unif, 3);     // Should overwrite 4
+        writeStep(unif, 5);
+    }
+
+    // Index matches the arrays found by scanning the file
+    {
+        const auto steps = Index::read(fname);
+        BOOST_REQUIRE_EQUAL(steps.size(), std::size_t{4});
+
+        const auto list = ::Opm::EclIO::EclFile{fname}.getList();
+
+        auto indexed = std::vector<::Opm::EclIO::EclFile::EclEntry>{};
+        for (const auto& step : steps) {
+            for (const auto& array : step.arrays) {
+                indexed.emplace_back(array.name, array.type, array.size);
+            }
+        }
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(indexed.begin(), indexed.end(),
+                                      list.begin(), list.end());
+    }
+
+    checkSteps({1, 2, 3, 5});
+
+    // Index is ignored if the file has been written to by others
+    {
+        ::Opm::EclIO::EclOutput out { fname, false, std::ios::app };
+        out.write("X", std::vector<int>{ 1 });
+    }
+
+    BOOST_CHECK(Index::read(fname).empty());
+    checkSteps({1, 2, 3, 5});
+
+    // Index is rewritten when resuming output
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr, indexed };
+
+        writeStep(unif, 6);
+    }
+
+    BOOST_CHECK_EQUAL(Index::read(fname).size(), std::size_t{5});
+    checkSteps({1, 2, 3, 5, 6});
+
+    // Report step is not indexed unless finished
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr, indexed };
+
+        auto rst = unif.prepareStep(7);
+        rst.write("I", std::vector<int>(3, 7));
+    }
+
+    BOOST_CHECK(Index::read(fname).empty());
+    {
+        const auto seqnum        = ::Opm::EclIO::ERst{fname}.listOfReportStepNumbers();
+        const auto expect_seqnum = std::vector<int>{1, 2, 3, 5, 6, 7};
+
+        BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                      expect_seqnum.begin(),
+                                      expect_seqnum.end());
+    }
+
+    // Separate Restart object does not maintain the index
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 8, fmt, ::Opm::EclIO::OutputStream::Unified { true }
+        };
+
+        rst.write("I", std::vector<int>(3, 8));
+    }
+
+    BOOST_CHECK(! std::filesystem::exists(Index::fileName(fname)));
+}
+
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_NoIndex)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    // Index is only maintained on request
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt };
+
+        for (const auto seqnum : {1, 2}) {
+            auto rst = unif.prepareStep(seqnum);
+            rst.write("I", std::vector<int>(3, seqnum));
+            rst.finish();
+        }
+    }
+
+    BOOST_CHECK(! std::filesystem::exists(::Opm::EclIO::RestartIndex::fileName(fname)));
+
+    const auto seqnum        = ::Opm::EclIO::ERst{fname}.listOfReportStepNumbers();
+    const auto expect_seqnum = std::vector<int>{1, 2};
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                  expect_seqnum.begin(),
+                                  expect_seqnum.end());
+}
+
+#if HAVE_ZLIB
+BOOST_AUTO_TEST_CASE(Unformatted_Unified_Compressed)
+{
+    const auto rset  = RSet("CASE");
+    const auto fmt   = ::Opm::EclIO::OutputStream::Formatted{ false };
+    const auto compr = ::Opm::EclIO::OutputStream::Compressed{ true };
+    const auto fname = ::Opm::EclIO::OutputStream::
+        outputFileName(rset, "UNRST");
+
+    auto writeStep = [](::Opm::EclIO::OutputStream::Restart& rst,
+                        const int seqnum)
+    {
+        rst.write("I", std::vector<int>   (3, seqnum));
+        rst.write("D", std::vector<double>(2500, 0.5 * seqnum));
+        rst.write("L", std::vector<bool>  (5, seqnum % 2 == 0));
+        rst.message("STARTSOL");
+        rst.write("S", std::vector<std::string>{ "A", "STRING" });
+        rst.message("ENDSOL");
+    };
+
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr };
+
+        for (const auto seqnum : {1, 2, 7, 4}) {
+            auto rst = unif.prepareStep(seqnum);
+            writeStep(rst, seqnum);
+        }
+    }
+
+    // Resume output to existing file
+    {
+        auto unif = ::Opm::EclIO::OutputStream::UnifiedRestart { rset, fmt, compr };
+
+        auto rst = unif.prepareStep(3);     // Should overwrite 4
+        writeStep(rst, 3);
+    }
+
+    {
+        auto rst = ::Opm::EclIO::OutputStream::Restart {
+            rset, 5, fmt, ::Opm::EclIO::OutputStream::Unified { true }, compr
+        };
+
+        writeStep(rst, 5);
+    }
+
+    // Uncompressed output does not mix with compressed file
+    BOOST_CHECK_THROW(::Opm::EclIO::OutputStream::Restart(rset, 6, fmt,
+                          ::Opm::EclIO::OutputStream::Unified { true }),
+                      std::invalid_argument);
+
+    BOOST_CHECK(::Opm::EclIO::EclFile{fname}.compressedInput());
+
+    auto rst = ::Opm::EclIO::ERst{fname};
+
+    const auto seqnum        = rst.listOfReportStepNumbers();
+    const auto expect_seqnum = std::vector<int>{1, 2, 3, 5};
+
+    BOOST_CHECK_EQUAL_COLLECTIONS(seqnum.begin(), seqnum.end(),
+                                  expect_seqnum.begin(),
+                                  expect_seqnum.end());
+
+    for (const auto& step : expect_seqnum) {
+        rst.loadReportStepNumber(step);
+
+        const auto& I = rst.getRestartData<int>("I", step, 0);
+        const auto  expect_I = std::vector<int>(3, step);
+        BOOST_CHECK_EQUAL_COLLECTIONS(I.begin(), I.end(),
+                                      expect_I.begin(),
+                                      expect_I.end());
+
+        const auto& D = rst.getRestartData<double>("D", step, 0);
+        check_is_close(D, std::vector<double>(2500, 0.5 * step));
+
+        const auto& L = rst.getRestartData<bool>("L", step, 0);
+        BOOST_CHECK(L == std::vector<bool>(5, step % 2 == 0));
+
+        const auto& S = rst.getRestartData<std::string>("S", step, 0);
+        BOOST_CHECK(S == (std::vector<std::string>{ "A", "STRING" }));
+    }
+}
+#endif // HAVE_ZLIB
+
 BOOST_AUTO_TEST_SUITE_END() // Class_Restart
 
 // ==========================================================================
@@ -43,6 +43,7 @@
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 #include <opm/input/eclipse/Units/Units.hpp>
 
+#include <opm/io/eclipse/ColumnESmry.hpp>
 #include <opm/io/eclipse/ERsm.hpp>
 #include <opm/io/eclipse/ESmry.hpp>
 
@@ -72,6 +73,10 @@
 
 #include <fmt/format.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 using namespace Opm;
 using rt = data::Rates::opt;
 using p_cmode = Opm::Group::ProductionCMode;
@@ -1115,6 +1120,36 @@ BOOST_AUTO_TEST_CASE(udq_keywords) {
 #endif
 }
 
+BOOST_AUTO_TEST_CASE(csmry_output) {
+    setup cfg( "test_summary_csmry" );
+
+    {
+        out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name, false, true );
+        SummaryState st(TimeService::now());
+        for (int step = 0; step < 3; ++step) {
+            writer.eval( st, step, step * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+            writer.add_timestep( st, step, false);
+            writer.write(step == 2);
+        }
+    }
+
+    auto res = readsum( cfg.name );
+    EclIO::ColumnESmry csmry( cfg.name + ".CSMRY" );
+
+    BOOST_CHECK_EQUAL( csmry.numberOfTimeSteps(), 3U );
+
+    // ESmry sorts the summary keys, the columnar file is in output order.
+    auto keys = csmry.keywordList();
+    std::sort(keys.begin(), keys.end());
+    BOOST_CHECK( keys == res->keywordList() );
+    BOOST_CHECK( csmry.startdate() == res->startdate() );
+
+    for (const auto& key : res->keywordList()) {
+        BOOST_CHECK( csmry.get(key) == res->get(key) );
+        BOOST_CHECK_EQUAL( csmry.get_unit(key), res->get_unit(key) );
+    }
+}
+
 BOOST_AUTO_TEST_CASE(group_keywords) {
     setup cfg( "test_summary_group" );
 
@@ -2754,6 +2789,79 @@ BOOST_AUTO_TEST_CASE(efficiency_factor) {
         BOOST_CHECK_CLOSE( 200.1 * 0.2 * 0.01, ecl_sum_get_well_connection_var( resp, 1, "W_2", "COPT", 2, 1, 1 ), 1e-5 );
 }
 
+BOOST_AUTO_TEST_CASE(efficiency_factor_schedule_update) {
+    // The wells and efficiency factors resolved for a report step are
+    // reused by later evaluations in the same step, until the schedule is
+    // changed for that step, e.g. by an ACTIONX.
+    setup cfg( "test_efficiency_factor_update", "SUMMARY_EFF_FAC.DATA", false );
+
+    out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+    SummaryState st(TimeService::now());
+    writer.eval( st, 0, 0 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    writer.eval( st, 1, 1 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 0.2, st.get_well_var("W_2", "WEFF"), 1.0e-5 );
+
+    writer.eval( st, 1, 2 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 0.2, st.get_well_var("W_2", "WEFF"), 1.0e-5 );
+    BOOST_CHECK_CLOSE( 0.2 * 0.01, st.get_well_var("W_2", "WEFFG"), 1.0e-5 );
+
+    const auto deck = Parser{}.parseString("SCHEDULE\nWEFAC\n 'W_2' 0.5 /\n/\n");
+    auto wefac = deck["WEFAC"].back();
+    std::vector<DeckKeyword*> keywords { &wefac };
+    cfg.schedule.applyKeywords(keywords, 1);
+
+    const auto wopt = st.get_well_var("W_2", "WOPT");
+    writer.eval( st, 1, 3 * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+    BOOST_CHECK_CLOSE( 0.5, st.get_well_var("W_2", "WEFF"), 1.0e-5 );
+    BOOST_CHECK_CLOSE( 0.5 * 0.01, st.get_well_var("W_2", "WEFFG"), 1.0e-5 );
+    BOOST_CHECK_CLOSE( wopt + 20.1 * 0.5 * 0.01, st.get_well_var("W_2", "WOPT"), 1.0e-5 );
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_evaluation) {
+    // Evaluating the vectors on several threads gives the same summary
+    // state as a sequential evaluation.  The deck has far fewer vectors
+    // than the default threshold for concurrent evaluation, so every
+    // vector gets a thread of its own.
+    setup cfg( "test_concurrent_evaluation" );
+
+    const auto start = TimeService::now();
+    auto evaluate = [&cfg, start](std::size_t& numRanges)
+    {
+        out::Summary writer( cfg.es, cfg.config, cfg.grid, cfg.schedule, cfg.name );
+        writer.setMinEvaluatorsPerRange(1);
+
+        SummaryState st(start);
+        for (int step = 0; step < 3; ++step) {
+            writer.eval( st, step, step * day, cfg.wells, cfg.wbp, cfg.grp_nwrk, {}, {}, {}, {});
+        }
+        numRanges = writer.numEvaluationRanges();
+        return st;
+    };
+
+    auto sequentialRanges = std::size_t{0};
+    auto concurrentRanges = std::size_t{0};
+#ifdef _OPENMP
+    const auto max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    const auto sequential = evaluate(sequentialRanges);
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(max_threads, 4));
+#endif
+    const auto concurrent = evaluate(concurrentRanges);
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+
+    BOOST_CHECK_EQUAL( sequentialRanges, std::size_t{1} );
+#ifdef _OPENMP
+    BOOST_CHECK_GT( concurrentRanges, std::size_t{1} );
+#else
+    BOOST_CHECK_EQUAL( concurrentRanges, std::size_t{1} );
+#endif
+    BOOST_CHECK( sequential == concurrent );
+}
+
 BOOST_AUTO_TEST_CASE(Test_SummaryState) {
     Opm::SummaryState st(TimeService::now());
     st.update("WWCT:OP_2", 100);
@@ -6572,4 +6680,94 @@ BOOST_AUTO_TEST_CASE(append_summary_state) {
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Handles) {
+    SummaryState st(TimeService::now());
+
+    const auto fopt = st.register_key("FOPT");
+    const auto wopr = st.register_well_var("OP_1", "WOPR");
+    const auto gopt = st.register_group_var("G1", "GOPT");
+    const auto copr = st.register_conn_var("OP_1", "COPR", 17);
+    const auto sofr = st.register_segment_var("OP_1", "SOFR", 2);
+
+    BOOST_CHECK_EQUAL(st.register_well_var("OP_1", "WOPR"), wopr);
+
+    // Registering does not define a value
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK(!st.has("WOPR:OP_1"));
+    BOOST_CHECK(!st.has_well_var("OP_1", "WOPR"));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+    BOOST_CHECK_EQUAL(st.size(), 0U);
+    BOOST_CHECK_THROW(st.get(wopr), std::out_of_range);
+    BOOST_CHECK_EQUAL(st.get(wopr, -1.0), -1.0);
+
+    st.update(fopt, 100);
+    st.update(fopt, 100);
+    st.update(wopr, 50);
+    st.update(wopr, 60);
+    st.update(gopt, 10);
+    st.update(gopt, 10);
+    st.update(copr, 5);
+    st.update(sofr, 7);
+
+    BOOST_CHECK_EQUAL(st.get(fopt), 200);
+    BOOST_CHECK_EQUAL(st.get("FOPT"), 200);
+    BOOST_CHECK_EQUAL(st.get(wopr), 60);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_1", "WOPR"), 60);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP_1"), 60);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPT"), 20);
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP_1", "COPR", 17), 5);
+    BOOST_CHECK_EQUAL(st.get_segment_var("OP_1", "SOFR", 2), 7);
+    BOOST_CHECK_EQUAL(st.get("SOFR:OP_1:2"), 7);
+    BOOST_CHECK(st.wells() == std::vector<std::string>{"OP_1"});
+    BOOST_CHECK(st.groups() == std::vector<std::string>{"G1"});
+    BOOST_CHECK_EQUAL(st.size(), 5U);
+
+    // The string API and the handles refer to the same values
+    st.update_well_var("OP_1", "WOPR", 70);
+    BOOST_CHECK_EQUAL(st.get(wopr), 70);
+
+    BOOST_CHECK(st.erase_well_var("OP_1", "WOPR"));
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+
+    st.update(wopr, 80);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_1", "WOPR"), 80);
+    BOOST_CHECK_EQUAL(st.num_wells(), 1U);
+
+    // Handles remain valid in copies
+    auto copy = st;
+    copy.update(fopt, 1);
+    BOOST_CHECK_EQUAL(copy.get(fopt), 201);
+    BOOST_CHECK_EQUAL(st.get(fopt), 200);
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_EraseLastVar) {
+    SummaryState st(TimeService::now());
+    st.update_well_var("OP_1", "WOPR", 10);
+    st.update_well_var("OP_2", "WOPR", 20);
+    st.update_group_var("G1", "GOPR", 30);
+    const auto wopr = st.register_well_var("OP_1", "WOPR");
+
+    BOOST_CHECK(st.erase_well_var("OP_1", "WOPR"));
+    BOOST_CHECK(st.has_well_var("WOPR"));
+    BOOST_CHECK(st.wells("WOPR") == std::vector<std::string>{"OP_2"});
+
+    // Erasing the last well holding the variable removes the variable,
+    // also when a handle keeps the underlying slot alive.
+    BOOST_CHECK(st.erase_well_var("OP_2", "WOPR"));
+    BOOST_CHECK(!st.has_well_var("WOPR"));
+    BOOST_CHECK(st.wells("WOPR").empty());
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+
+    BOOST_CHECK(st.erase_group_var("G1", "GOPR"));
+    BOOST_CHECK(!st.has_group_var("GOPR"));
+    BOOST_CHECK(st.groups("GOPR").empty());
+
+    // A new value through the handle makes the variable visible again.
+    st.update(wopr, 40);
+    BOOST_CHECK(st.has_well_var("WOPR"));
+    BOOST_CHECK(st.wells("WOPR") == std::vector<std::string>{"OP_1"});
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State
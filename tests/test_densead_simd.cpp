@@ -0,0 +1,245 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Tests for dense-AD evaluations of packed values.
+ */
+#include "config.h"
+
+#define BOOST_TEST_MODULE DenseAdSimdTests
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/densead/SimdValue.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+#include <opm/material/fluidmatrixinteractions/BrooksCorey.hpp>
+#include <opm/material/fluidmatrixinteractions/BrooksCoreyParams.hpp>
+#include <opm/material/fluidmatrixinteractions/MaterialTraits.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/ConstantCompressibilityWaterPvt.hpp>
+
+#include <array>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+constexpr int width = 4;
+constexpr int numVars = 3;
+
+using Scalar = double;
+using Eval = Opm::DenseAd::Evaluation<Scalar, numVars>;
+using PackedValue = Opm::DenseAd::SimdValue<Scalar, width>;
+using PackedEval = Opm::DenseAd::Evaluation<PackedValue, numVars>;
+
+// one evaluation per lane which depends on the first and the third variable
+std::array<Eval, width> makeLanes(const std::array<Scalar, width>& values)
+{
+    std::array<Eval, width> result;
+    for (int i = 0; i < width; ++i) {
+        result[i] = Eval::createVariable(values[i], 0);
+        result[i].setDerivative(2, 0.5*values[i] - 1.0);
+    }
+    return result;
+}
+
+PackedEval pack(const std::array<Eval, width>& lanes)
+{
+    PackedEval result;
+    for (int i = 0; i < width; ++i)
+        Opm::DenseAd::setLane(result, i, lanes[i]);
+    return result;
+}
+
+void checkLanes(const PackedEval& packed, const std::array<Eval, width>& expected)
+{
+    for (int i = 0; i < width; ++i) {
+        const Eval lane = Opm::DenseAd::getLane(packed, i);
+        BOOST_CHECK_CLOSE(lane.value(), expected[i].value(), 1e-12);
+        for (int j = 0; j < numVars; ++j)
+            BOOST_CHECK_CLOSE(lane.derivative(j), expected[i].derivative(j), 1e-12);
+    }
+}
+
+template <class PackedFn, class ScalarFn>
+void checkUnary(const std::array<Eval, width>& x, PackedFn packedFn, ScalarFn scalarFn)
+{
+    std::array<Eval, width> expected;
+    for (int i = 0; i < width; ++i)
+        expected[i] = scalarFn(x[i]);
+
+    checkLanes(packedFn(pack(x)), expected);
+}
+
+template <class PackedFn, class ScalarFn>
+void checkBinary(const std::array<Eval, width>& x,
+                 const std::array<Eval, width>& y,
+                 PackedFn packedFn, ScalarFn scalarFn)
+{
+    std::array<Eval, width> expected;
+    for (int i = 0; i < width; ++i)
+        expected[i] = scalarFn(x[i], y[i]);
+
+    checkLanes(packedFn(pack(x), pack(y)), expected);
+}
+
+template <class Fn>
+void checkUnary(const std::array<Eval, width>& x, Fn fn)
+{ checkUnary(x, fn, fn); }
+
+template <class Fn>
+void checkBinary(const std::array<Eval, width>& x,
+                 const std::array<Eval, width>& y,
+                 Fn fn)
+{ checkBinary(x, y, fn, fn); }
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Arithmetic)
+{
+    const auto x = makeLanes({1.5, -2.0, 0.25, 3.0});
+    const auto y = makeLanes({0.5, 4.0, -1.25, 2.0});
+
+    checkBinary(x, y,
+                [](const auto& a, const auto& b) { return a + b; });
+    checkBinary(x, y,
+                [](const auto& a, const auto& b) { return a - 2.0*b; });
+    checkBinary(x, y,
+                [](const auto& a, const auto& b) { return a*b + 1.0; });
+    checkBinary(x, y,
+                [](const auto& a, const auto& b) { return (a/b)/3.0; });
+    checkUnary(x,
+               [](const auto& a) { return 1.0/a - a; });
+
+    // scaling by a packed value acts lane-wise
+    const PackedValue s(std::array<Scalar, width>{1.0, 2.0, 3.0, 4.0});
+    const PackedEval scaled = pack(x)*s;
+    for (int i = 0; i < width; ++i) {
+        const Eval lane = Opm::DenseAd::getLane(scaled, i);
+        BOOST_CHECK_CLOSE(lane.value(), (x[i]*(i + 1.0)).value(), 1e-12);
+        BOOST_CHECK_CLOSE(lane.derivative(2), (x[i]*(i + 1.0)).derivative(2), 1e-12);
+    }
+
+    BOOST_CHECK(pack(x) == pack(x));
+    BOOST_CHECK(pack(x) != pack(y));
+}
+
+BOOST_AUTO_TEST_CASE(MathFunctions)
+{
+    const auto x = makeLanes({1.5, 2.0, 0.25, 3.0});
+    const auto y = makeLanes({0.5, 4.0, 1.25, 2.0});
+    const auto z = makeLanes({-1.5, 2.0, 0.0, -3.0});
+
+    checkUnary(x,
+               [](const auto& a) { return Opm::exp(a); });
+    checkUnary(x,
+               [](const auto& a) { return Opm::log(a); });
+    checkUnary(x,
+               [](const auto& a) { return Opm::sqrt(a); });
+    checkUnary(x,
+               [](const auto& a) { return Opm::sin(a)*Opm::atan(a); });
+
+    // the functions which branch in the scalar case
+    checkUnary(z,
+               [](const auto& a) { return Opm::abs(a); });
+    checkBinary(x, z,
+                [](const auto& a, const auto& b) { return Opm::min(a, b); });
+    checkBinary(x, z,
+                [](const auto& a, const auto& b) { return Opm::max(a, b); });
+    checkUnary(z,
+               [](const auto& a) { return Opm::max(a, 0.5) + Opm::min(1.0, a); });
+
+    // pow() treats a base of zero separately
+    checkUnary(z,
+               [](const auto& a) { return Opm::pow(a, 2.0); });
+    checkUnary(x,
+               [](const auto& a) { return Opm::pow(2.5, a); });
+    checkBinary(y, x,
+                [](const auto& a, const auto& b) { return Opm::pow(a, b); });
+
+    const auto zAbs = makeLanes({1.5, 2.0, 0.0, 3.0});
+    checkBinary(zAbs, y,
+                [](const auto& a, const auto& b) { return Opm::pow(a, b); });
+}
+
+BOOST_AUTO_TEST_CASE(MaterialLawAndPvt)
+{
+    using Traits = Opm::TwoPhaseMaterialTraits<Scalar, /*wettingPhaseIdx=*/0, /*nonWettingPhaseIdx=*/1>;
+    using Params = Opm::BrooksCoreyParams<Traits>;
+    using MaterialLaw = Opm::BrooksCorey<Traits, Params>;
+
+    Params params(/*entryPressure=*/1e5, /*lambda=*/2.0);
+
+    const auto Sw = makeLanes({0.1, 0.35, 0.6, 0.95});
+    const auto p = makeLanes({100e5, 150e5, 200e5, 250e5});
+    const auto T = makeLanes({300.0, 310.0, 320.0, 330.0});
+
+    // branch-free parts of the material law work on packed values directly
+    checkUnary(Sw,
+               [&](const auto& a) { return MaterialLaw::twoPhaseSatKrwInv(params, a); });
+
+    // everything else is applied lane by lane
+    checkUnary(Sw,
+               [&](const auto& a)
+               {
+                   return Opm::DenseAd::applyLaneWise([&](const Eval& s)
+                                                      { return MaterialLaw::twoPhaseSatPcnw(params, s); },
+                                                      a);
+               },
+               [&](const auto& a) { return MaterialLaw::twoPhaseSatPcnw(params, a); });
+
+    Opm::Tabulated1DFunction<Scalar> table(std::vector<Scalar>{0.0, 0.5, 1.0},
+                                           std::vector<Scalar>{0.0, 0.2, 1.0});
+    checkUnary(Sw,
+               [&](const auto& a)
+               {
+                   return Opm::DenseAd::applyLaneWise([&](const Eval& s)
+                                                      { return table.eval(s, /*extrapolate=*/true); },
+                                                      a);
+               },
+               [&](const auto& a) { return table.eval(a, /*extrapolate=*/true); });
+
+    Opm::ConstantCompressibilityWaterPvt<Scalar> pvt;
+    pvt.setNumRegions(1);
+    pvt.setReferencePressure(0, 1e5);
+    pvt.setReferenceFormationVolumeFactor(0, 1.02);
+    pvt.setCompressibility(0, 4e-10);
+    pvt.setViscosity(0, 0.5e-3, 1e-9);
+    pvt.initEnd();
+
+    // the water PVT does not branch either
+    checkBinary(T, p,
+                [&](const auto& t, const auto& pw)
+                {
+                    using E = std::decay_t<decltype(pw)>;
+                    return pvt.viscosity(0, t, pw, E(0.0), E(0.0));
+                });
+    checkBinary(T, p,
+                [&](const auto& t, const auto& pw)
+                {
+                    using E = std::decay_t<decltype(pw)>;
+                    return pvt.inverseFormationVolumeFactor(0, t, pw, E(0.0), E(0.0));
+                });
+}